@@ -2,6 +2,9 @@
 // 보스 체력바 위젯 구현
 
 #include "BossHealthWidget.h"
+#include "MechaStats.h"
+#include "MechaUIUpdateSubsystem.h"
+#include "MechaUIInvalidation.h"
 #include "AbilitySystemComponent.h"
 #include "MechaAttributeSet.h"
 #include "Components/ProgressBar.h"
@@ -38,7 +41,11 @@ void UBossHealthWidget::InitWithBoss(UAbilitySystemComponent* InASC, UMechaAttri
 // ========================================
 void UBossHealthWidget::ApplyHealth(float NewHealth, float MaxHealth)
 {
-    UpdateHealthBar(NewHealth, MaxHealth);
+    // 같은 프레임의 여러 변경은 마지막 값으로 한 번만 반영
+    PendingHealth = NewHealth;
+    PendingMaxHealth = MaxHealth;
+
+    UMechaUIUpdateSubsystem::Schedule(this, [this]() { UpdateHealthBar(PendingHealth, PendingMaxHealth); });
 }
 
 // ========================================
@@ -46,6 +53,8 @@ void UBossHealthWidget::ApplyHealth(float NewHealth, float MaxHealth)
 // ========================================
 void UBossHealthWidget::UpdateHealthBar(float NewHealth, float MaxHealth)
 {
+    SCOPE_CYCLE_COUNTER(STAT_Mecha_HUDUpdate);
+
     // ========== 피격 플래시 연출 ==========
     // 체력이 줄어들었으면 플래시 애니메이션 재생
     if (bHasLastHealth && NewHealth < LastHealth)
@@ -83,14 +92,7 @@ void UBossHealthWidget::UpdateHealthBar(float NewHealth, float MaxHealth)
     }
 
     // ========== 체력 텍스트 업데이트 ==========
-    if (TxtBossHealthValue)
-    {
-        const int32 IntHealth = FMath::RoundToInt(NewHealth);
-        const int32 IntMax = FMath::RoundToInt(MaxHealth);
-        TxtBossHealthValue->SetText(FText::FromString(
-            FString::Printf(TEXT("%d / %d"), IntHealth, IntMax)
-        ));
-    }
+    HealthValueText.SetRatio(TxtBossHealthValue, FMath::RoundToInt(NewHealth), FMath::RoundToInt(MaxHealth));
 
     // 현재 체력 저장 (다음 비교용)
     LastHealth = NewHealth;
@@ -164,3 +166,13 @@ void UBossHealthWidget::NativeDestruct()
     Super::NativeDestruct();
 }
 
+// ========================================
+// Slate 생성 - 루트를 InvalidationBox로 감쌈
+// ========================================
+TSharedRef<SWidget> UBossHealthWidget::RebuildWidget()
+{
+    FMechaUIInvalidation::WrapRoot(*this);
+
+    return Super::RebuildWidget();
+}
+
@@ -5,6 +5,7 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "MechaNumericText.h"
 #include "BossHealthWidget.generated.h"
 
 class UProgressBar;
@@ -49,6 +50,9 @@ public:
 protected:
     virtual void NativeDestruct() override;
 
+    // 루트를 InvalidationBox로 감싸 체력바/텍스트가 바뀔 때만 다시 그림 (FMechaUIInvalidation)
+    virtual TSharedRef<SWidget> RebuildWidget() override;
+
     // === UMG 바인딩 ===
     // 보스 이름 텍스트
     UPROPERTY(meta = (BindWidgetOptional))
@@ -100,5 +104,11 @@ private:
 
     float LastHealth = -1.f;
     bool bHasLastHealth = false;
+
+    // ApplyHealth는 최신 값만 보관하고 갱신은 프레임당 한 번 (UMechaUIUpdateSubsystem)
+    float PendingHealth = 0.f;
+    float PendingMaxHealth = 0.f;
+
+    FMechaNumericText HealthValueText;
 };
 
@@ -3,6 +3,8 @@
 
 #include "EnemyAIController.h"
 #include "EnemyMecha.h"
+#include "MechaStats.h"
+#include "MechaBehaviorTreeComponent.h"
 
 #include "BehaviorTree/BehaviorTree.h"
 #include "BehaviorTree/BlackboardComponent.h"
@@ -14,6 +16,9 @@ AEnemyAIController::AEnemyAIController()
 {
 	// 블랙보드 컴포넌트 생성
 	BlackboardComp = CreateDefaultSubobject<UBlackboardComponent>(TEXT("BlackboardComp"));
+
+	// 시분할 BT 컴포넌트 (RunBehaviorTree가 새로 만들지 않고 이 컴포넌트를 사용)
+	BrainComponent = CreateDefaultSubobject<UMechaBehaviorTreeComponent>(TEXT("BTComponent"));
 }
 
 // ========================================
@@ -51,17 +56,30 @@ void AEnemyAIController::OnPossess(APawn* InPawn)
 		return;
 	}
 
+	// ========== 블랙보드 키 ID 해석 (빙의마다, 누락 키는 여기서 경고) ==========
+	BlackboardKeys = FMechaBlackboardKeys::Resolve(BT->BlackboardAsset);
+
 	// ========== 블랙보드 초기값 설정 ==========
 	if (BlackboardComp)
 	{
 		// 스폰 위치를 Home 위치로 설정
 		const FVector HomeLoc = Enemy->GetActorLocation();
-		BlackboardComp->SetValueAsVector(TEXT("HomeLocation"), HomeLoc);
+		FMechaBlackboardKeys::SetVector(BlackboardComp, BlackboardKeys.HomeLocation, HomeLoc);
 
 		// 죽음 플래그 초기화
-		BlackboardComp->SetValueAsBool(TEXT("IsDead"), false);
+		FMechaBlackboardKeys::SetBool(BlackboardComp, BlackboardKeys.IsDead, false);
 	}
 
 	// ========== Behavior Tree 실행 ==========
 	RunBehaviorTree(BT);
 }
+
+// ========================================
+// 틱 (컨트롤 회전 갱신 등 컨트롤러 자체 비용을 stat Mecha에 집계)
+// ========================================
+void AEnemyAIController::Tick(float DeltaSeconds)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Mecha_AITick);
+
+	Super::Tick(DeltaSeconds);
+}
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "AIController.h"
+#include "MechaBlackboardKeys.h"
 #include "EnemyAIController.generated.h"
 
 class UBlackboardComponent;
@@ -18,6 +19,12 @@ public:
 
     virtual void OnPossess(APawn* InPawn) override;
 
+    // stat Mecha AI Tick 
+    virtual void Tick(float DeltaSeconds) override;
+
+    //   ؼ  Ű ID ( Ű InvalidKey)
+    const FMechaBlackboardKeys& GetBlackboardKeys() const { return BlackboardKeys; }
+
 protected:
     // UseBlackboard  /ִ  Ʈ
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AI", meta = (AllowPrivateAccess = "true"))
@@ -25,4 +32,7 @@ protected:
 
     UPROPERTY(EditDefaultsOnly, Category = "AI")
     UBehaviorTree* DefaultBehaviorTree;
+
+private:
+    FMechaBlackboardKeys BlackboardKeys;
 };
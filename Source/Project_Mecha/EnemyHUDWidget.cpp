@@ -2,6 +2,8 @@
 // 적 HUD 위젯 - 체력바 표시, 피격 플래시, 사망 연출
 
 #include "EnemyHUDWidget.h"
+#include "MechaStats.h"
+#include "MechaUIUpdateSubsystem.h"
 
 #include "AbilitySystemComponent.h"
 #include "MechaAttributeSet.h"
@@ -33,7 +35,11 @@ void UEnemyHUDWidget::InitWithASC(UAbilitySystemComponent* InASC, UMechaAttribut
 // ========================================
 void UEnemyHUDWidget::ApplyHealth(float NewHealth, float MaxHealth)
 {
-	UpdateHP(NewHealth, MaxHealth);
+	// 같은 프레임의 여러 변경은 마지막 값으로 한 번만 반영
+	PendingHealth = NewHealth;
+	PendingMaxHealth = MaxHealth;
+
+	UMechaUIUpdateSubsystem::Schedule(this, [this]() { UpdateHP(PendingHealth, PendingMaxHealth); });
 }
 
 // ========================================
@@ -41,6 +47,8 @@ void UEnemyHUDWidget::ApplyHealth(float NewHealth, float MaxHealth)
 // ========================================
 void UEnemyHUDWidget::UpdateHP(float NewHealth, float MaxHealth)
 {
+	SCOPE_CYCLE_COUNTER(STAT_Mecha_HUDUpdate);
+
 	// ========== 피격 플래시 연출 ==========
 	// 체력이 줄어들었으면 플래시 애니메이션 재생
 	if (bHasLastHealth && NewHealth < LastHealth)
@@ -58,43 +66,36 @@ void UEnemyHUDWidget::UpdateHP(float NewHealth, float MaxHealth)
 		HPBar->SetPercent(Percent);
 
 		// 체력 비율에 따라 색상 변경
-		FLinearColor BarColor;
-
-		if (Percent > 0.7f)
-		{
-			// 70% 이상: 초록 (안전)
-			BarColor = FLinearColor(0.1f, 0.8f, 0.1f);
-		}
-		else if (Percent > 0.3f)
-		{
-			// 30~70%: 주황 (경고)
-			BarColor = FLinearColor(1.0f, 0.6f, 0.1f);
-		}
-		else
-		{
-			// 30% 이하: 빨강 (위험)
-			BarColor = FLinearColor(0.9f, 0.1f, 0.1f);
-		}
-
-		HPBar->SetFillColorAndOpacity(BarColor);
+		HPBar->SetFillColorAndOpacity(GetHealthColor(Percent));
 	}
 
 	// ========== 체력 텍스트 업데이트 ==========
-	if (HPText)
-	{
-		const int32 IntHealth = FMath::RoundToInt(NewHealth);
-		const int32 IntMax = FMath::RoundToInt(MaxHealth);
-
-		HPText->SetText(FText::FromString(
-			FString::Printf(TEXT("%d / %d"), IntHealth, IntMax)
-		));
-	}
+	HPValueText.SetRatio(HPText, FMath::RoundToInt(NewHealth), FMath::RoundToInt(MaxHealth));
 
 	// 현재 체력 저장 (다음 비교용)
 	LastHealth = NewHealth;
 	bHasLastHealth = true;
 }
 
+// ========================================
+// 체력 비율별 색상
+// ========================================
+FLinearColor UEnemyHUDWidget::GetHealthColor(float Percent)
+{
+	if (Percent > 0.7f)
+	{
+		// 70% 이상: 초록 (안전)
+		return FLinearColor(0.1f, 0.8f, 0.1f);
+	}
+	if (Percent > 0.3f)
+	{
+		// 30~70%: 주황 (경고)
+		return FLinearColor(1.0f, 0.6f, 0.1f);
+	}
+	// 30% 이하: 빨강 (위험)
+	return FLinearColor(0.9f, 0.1f, 0.1f);
+}
+
 // ========================================
 // 위젯 종료 시 정리
 // ========================================
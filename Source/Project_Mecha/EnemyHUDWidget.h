@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "MechaNumericText.h"
 #include "EnemyHUDWidget.generated.h"
 
 class UProgressBar;
@@ -12,6 +13,7 @@ class UWidgetAnimation;
 
 /**
  *   HUD  (ü¹ + ؽƮ)
+ * ⺻ UMechaHealthBarSubsystem ̰ ׸,   Mecha.UI.HealthBarOverlay 0  ü  +  
  */
 UCLASS()
 class PROJECT_MECHA_API UEnemyHUDWidget : public UUserWidget
@@ -31,6 +33,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Mecha|UI")
     void OnOwnerDead();
 
+    // ü    (ü¹ ̵   )
+    static FLinearColor GetHealthColor(float Percent);
+
 protected:
     virtual void NativeDestruct() override;
 
@@ -61,4 +66,10 @@ protected:
 
     float LastHealth = -1.f;
     bool bHasLastHealth = false;
+
+    // ApplyHealth ֽ  ϰ  Ӵ   (UMechaUIUpdateSubsystem)
+    float PendingHealth = 0.f;
+    float PendingMaxHealth = 0.f;
+
+    FMechaNumericText HPValueText;
 };
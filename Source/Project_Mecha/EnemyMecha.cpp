@@ -2,6 +2,7 @@
 // 적 메카 캐릭터 - GAS, AI, 체력 관리, 미사일/대시/호버/보스 패턴 능력
 
 #include "EnemyMecha.h"
+#include "MechaStats.h"
 
 #include "AbilitySystemComponent.h"
 #include "MechaAttributeSet.h"
@@ -10,15 +11,21 @@
 #include "GameplayTagContainer.h"
 
 #include "AIController.h"
+#include "EnemyAIController.h"
 #include "BrainComponent.h"
+#include "Navigation/PathFollowingComponent.h"
 #include "BehaviorTree/BlackboardComponent.h"
-#include "GameFramework/CharacterMovementComponent.h"
+#include "MechaMovementComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "GameFramework/ProjectileMovementComponent.h"
 #include "Engine/World.h"
 
 #include "MissionManager.h"
+#include "MechaCombatRegistrySubsystem.h"
+#include "MechaNativeTags.h"
+#include "MechaProjectilePoolSubsystem.h"
+#include "MechaHealthBarSubsystem.h"
 #include "Kismet/GameplayStatics.h"
 
 #include "Components/WidgetComponent.h"
@@ -32,13 +39,18 @@
 // ========================================
 // 생성자
 // ========================================
-AEnemyMecha::AEnemyMecha()
+// 이동 컴포넌트를 UMechaMovementComponent로 교체 (대시 커스텀 이동 모드)
+AEnemyMecha::AEnemyMecha(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer.SetDefaultSubobjectClass<UMechaMovementComponent>(ACharacter::CharacterMovementComponentName))
 {
     PrimaryActorTick.bCanEverTick = true;
     CurrentTarget = nullptr;
 
     // ========== GAS 초기화 ==========
     AbilitySystem = CreateDefaultSubobject<UAbilitySystemComponent>(TEXT("AbilitySystem"));
+    AbilitySystem->SetIsReplicated(true);
+    // Mixed: 능력/GE는 서버에만 두고 태그·큐·Attribute만 클라이언트로 복제
+    AbilitySystem->SetReplicationMode(EGameplayEffectReplicationMode::Mixed);
     AttributeSet = CreateDefaultSubobject<UMechaAttributeSet>(TEXT("AttributeSet"));
 
     // ========== AI 파라미터 기본값 ==========
@@ -82,13 +94,21 @@ UAbilitySystemComponent* AEnemyMecha::GetAbilitySystemComponent() const
 // ========================================
 void AEnemyMecha::BeginPlay()
 {
+    // ========== 체력바 오버레이 사용 시 위젯 컴포넌트 제거 (컴포넌트 BeginPlay에서 위젯이 만들어지기 전) ==========
+    if (EnemyHUDWidgetComp && UMechaHealthBarSubsystem::IsOverlayEnabled(this))
+    {
+        EnemyHUDWidgetComp->DestroyComponent();
+        EnemyHUDWidgetComp = nullptr;
+    }
+
     Super::BeginPlay();
 
     if (AbilitySystem)
     {
         AbilitySystem->InitAbilityActorInfo(this, this);
 
-        // ========== 능력 부여 ==========
+        // ========== 능력 부여 (서버만, AI 능력은 ServerOnly) ==========
+        if (HasAuthority())
         {
             // 미사일 능력 등록
             if (MissileAbilityClass_Enemy)
@@ -121,25 +141,24 @@ void AEnemyMecha::BeginPlay()
                     FGameplayAbilitySpec(BossMissileRainAbilityClass, 1, 3)
                 );
             }
+        }
 
-            // 미션 매니저 찾기
-            if (MissionManager == nullptr)
+        // 미션 매니저 찾기 (등록부 조회, 아직 등록 전이면 사망 시 다시 조회)
+        if (MissionManager == nullptr)
+        {
+            if (UMechaCombatRegistrySubsystem* Registry = UMechaCombatRegistrySubsystem::Get(this))
             {
-                AActor* Found = UGameplayStatics::GetActorOfClass(GetWorld(), AMissionManager::StaticClass());
-                if (Found)
-                {
-                    MissionManager = Cast<AMissionManager>(Found);
-                }
+                MissionManager = Registry->GetMissionManager();
             }
+        }
 
-            // HUD 초기화 (서버)
-            if (EnemyHUDWidgetComp && AbilitySystem && AttributeSet)
+        // HUD 초기화 (서버)
+        if (EnemyHUDWidgetComp && AbilitySystem && AttributeSet)
+        {
+            UUserWidget* WidgetObject = EnemyHUDWidgetComp->GetUserWidgetObject();
+            if (UEnemyHUDWidget* EnemyHUD = Cast<UEnemyHUDWidget>(WidgetObject))
             {
-                UUserWidget* WidgetObject = EnemyHUDWidgetComp->GetUserWidgetObject();
-                if (UEnemyHUDWidget* EnemyHUD = Cast<UEnemyHUDWidget>(WidgetObject))
-                {
-                    EnemyHUD->InitWithASC(AbilitySystem, AttributeSet);
-                }
+                EnemyHUD->InitWithASC(AbilitySystem, AttributeSet);
             }
         }
     }
@@ -147,8 +166,26 @@ void AEnemyMecha::BeginPlay()
     // 스폰 위치 저장 (AI 패트롤 기준점)
     HomeLocation = GetActorLocation();
 
-    // 스탯 초기화
-    InitializeAttributes();
+    // 전투 등록부에 등록 (락온/미사일 타겟 검색용)
+    if (UMechaCombatRegistrySubsystem* Registry = UMechaCombatRegistrySubsystem::Get(this))
+    {
+        Registry->RegisterCombatant(this, EMechaCombatTeam::Enemy, bIsBoss);
+    }
+
+    // 미사일 풀 미리 채우기 (시뮬레이션 미사일을 못 쓰는 네트워크 세션 포함)
+    if (MissileClass_Enemy && !(bUseSimulatedMissile_Enemy && UMechaProjectileSimSubsystem::IsSimulationAllowed(this)))
+    {
+        if (UMechaProjectilePoolSubsystem* Pool = UMechaProjectilePoolSubsystem::Get(this))
+        {
+            Pool->PrewarmPool(MissileClass_Enemy, MissilePrewarmCount_Enemy);
+        }
+    }
+
+    // 스탯 초기화 (서버만, 결과는 Attribute 복제로 전달)
+    if (HasAuthority())
+    {
+        InitializeAttributes();
+    }
 
     // ========== 보스 체력바 생성 ==========
     if (bIsBoss)
@@ -199,6 +236,19 @@ void AEnemyMecha::BeginPlay()
     }
 }
 
+// ========================================
+// EndPlay - 전투 등록부에서 제거
+// ========================================
+void AEnemyMecha::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UMechaCombatRegistrySubsystem* Registry = UMechaCombatRegistrySubsystem::Get(this))
+    {
+        Registry->UnregisterCombatant(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
 // ========================================
 // 스탯 초기화
 // ========================================
@@ -249,6 +299,13 @@ void AEnemyMecha::ReInitializeAttributes()
 // ========================================
 void AEnemyMecha::HandleDeath()
 {
+    // ========== 전투 등록부에서 제거 (더 이상 타겟이 아님) ==========
+    UMechaCombatRegistrySubsystem* Registry = UMechaCombatRegistrySubsystem::Get(this);
+    if (Registry)
+    {
+        Registry->UnregisterCombatant(this);
+    }
+
     // ========== AI/BT 정지 ==========
     if (AAIController* AICon = Cast<AAIController>(GetController()))
     {
@@ -257,9 +314,9 @@ void AEnemyMecha::HandleDeath()
             Brain->StopLogic(TEXT("Dead"));
         }
 
-        if (UBlackboardComponent* BB = AICon->GetBlackboardComponent())
+        if (AEnemyAIController* EnemyAI = Cast<AEnemyAIController>(AICon))
         {
-            BB->SetValueAsBool(TEXT("IsDead"), true);
+            FMechaBlackboardKeys::SetBool(EnemyAI->GetBlackboardComponent(), EnemyAI->GetBlackboardKeys().IsDead, true);
         }
     }
 
@@ -310,6 +367,11 @@ void AEnemyMecha::HandleDeath()
     }
 
     // ========== 미션 매니저에 킬 보고 ==========
+    if (MissionManager == nullptr && Registry)
+    {
+        MissionManager = Registry->GetMissionManager();
+    }
+
     if (MissionManager)
     {
         MissionManager->NotifyEnemyKilled(this);
@@ -354,7 +416,7 @@ void AEnemyMecha::OnHealthChanged(const FOnAttributeChangeData& Data)
         if (AbilitySystem)
         {
             AbilitySystem->AddLooseGameplayTag(
-                FGameplayTag::RequestGameplayTag(TEXT("State.Dead"))
+                MechaTags::State_Dead
             );
         }
 
@@ -376,7 +438,7 @@ void AEnemyMecha::PlayHitReact()
     // 2) 🔹 SuperArmor 중이면 HitReact 자체를 막기
     if (AbilitySystem &&
         AbilitySystem->HasMatchingGameplayTag(
-            FGameplayTag::RequestGameplayTag(TEXT("State.SuperArmor"))
+            MechaTags::State_SuperArmor
         ))
     {
         return;
@@ -431,7 +493,17 @@ void AEnemyMecha::FireMissileAbility()
 // 미사일 직접 발사 (애님 노티파이에서 호출)
 void AEnemyMecha::FireMissileFromNotify()
 {
-    if (!MissileClass_Enemy || !CurrentTarget)
+    SCOPE_CYCLE_COUNTER(STAT_Mecha_ProjectileSpawn);
+
+    // 미사일은 서버만 스폰 (클라이언트의 애님 노티파이는 무시)
+    if (!HasAuthority())
+    {
+        return;
+    }
+
+    // 시뮬레이션 미사일은 복제되지 않으므로 네트워크 세션에서는 풀 액터로 대체
+    const bool bUseSim = bUseSimulatedMissile_Enemy && UMechaProjectileSimSubsystem::IsSimulationAllowed(this);
+    if ((!MissileClass_Enemy && !bUseSim) || !CurrentTarget)
     {
         return;
     }
@@ -463,15 +535,29 @@ void AEnemyMecha::FireMissileFromNotify()
         return;
     }
 
-    FActorSpawnParameters SpawnParams;
-    SpawnParams.Owner = this;
-    SpawnParams.Instigator = this;
+    // 시뮬레이션 미사일 (액터 없음, 유도 설정은 아키타입에 포함)
+    if (bUseSim)
+    {
+        if (UMechaProjectileSimSubsystem* Sim = World->GetSubsystem<UMechaProjectileSimSubsystem>())
+        {
+            Sim->SpawnProjectile(SimMissileArchetype_Enemy, SpawnLocation, SpawnRotation.Vector(),
+                CurrentTarget, this, SimMissileDamage_Enemy);
+        }
+        return;
+    }
 
-    AActor* Missile = World->SpawnActor<AActor>(
+    UMechaProjectilePoolSubsystem* Pool = World->GetSubsystem<UMechaProjectilePoolSubsystem>();
+    if (!Pool)
+    {
+        return;
+    }
+
+    AActor* Missile = Pool->AcquireProjectile(
         MissileClass_Enemy,
         SpawnLocation,
         SpawnRotation,
-        SpawnParams
+        this,
+        this
     );
 
     if (Missile)
@@ -519,7 +605,7 @@ void AEnemyMecha::FireBossMissileRainAbility()
 
     // 이미 죽은 상태면 패턴 발동하지 않음
     if (AbilitySystem->HasMatchingGameplayTag(
-        FGameplayTag::RequestGameplayTag(TEXT("State.Dead"))))
+        MechaTags::State_Dead))
     {
         return;
     }
@@ -533,20 +619,33 @@ void AEnemyMecha::FireBossMissileRainAbility()
 
 void AEnemyMecha::ActivateHoverParticles()
 {
-    for (UParticleSystemComponent* ParticleComp : HoverParticleComponents)
-    {
-        if (ParticleComp && !ParticleComp->IsActive())
-        {
-            ParticleComp->Activate(true);
-        }
-    }
+    bWantsHoverParticles = true;
+    RefreshHoverParticles();
 }
 
 void AEnemyMecha::DeactivateHoverParticles()
 {
+    bWantsHoverParticles = false;
+    RefreshHoverParticles();
+}
+
+// 원하는 상태와 중요도 억제를 합쳐 실제 활성화 여부 결정
+void AEnemyMecha::RefreshHoverParticles()
+{
+    const bool bActive = bWantsHoverParticles && !bHoverParticlesSuppressed;
+
     for (UParticleSystemComponent* ParticleComp : HoverParticleComponents)
     {
-        if (ParticleComp && ParticleComp->IsActive())
+        if (!ParticleComp || ParticleComp->IsActive() == bActive)
+        {
+            continue;
+        }
+
+        if (bActive)
+        {
+            ParticleComp->Activate(true);
+        }
+        else
         {
             ParticleComp->Deactivate();
         }
@@ -579,6 +678,71 @@ void AEnemyMecha::SetHoverParticleRotation(FRotator NewRotation)
     }
 }
 
+// ========================================
+// 중요도(LOD) 적용
+// ========================================
+void AEnemyMecha::ApplySignificance(EMechaSignificance NewSignificance, const FMechaSignificanceSettings& Settings)
+{
+    if (NewSignificance == Significance || bIsDead)
+    {
+        return;
+    }
+    Significance = NewSignificance;
+
+    SetActorTickInterval(Settings.ActorTickInterval);
+
+    // ========== 이동 ==========
+    if (UCharacterMovementComponent* Move = GetCharacterMovement())
+    {
+        Move->SetComponentTickInterval(Settings.MovementTickInterval);
+    }
+
+    // ========== AI (서버만 컨트롤러가 있음) ==========
+    // BT 컴포넌트는 자체적으로 다음 틱을 예약하므로 틱 간격 대신 일시정지로 제어
+    if (AAIController* AICon = Cast<AAIController>(GetController()))
+    {
+        AICon->SetActorTickInterval(Settings.AIControllerTickInterval);
+
+        if (UPathFollowingComponent* PathFollowing = AICon->GetPathFollowingComponent())
+        {
+            PathFollowing->SetComponentTickInterval(Settings.AIControllerTickInterval);
+        }
+
+        if (UBrainComponent* Brain = AICon->GetBrainComponent())
+        {
+            if (Settings.bPauseBehaviorTree && !bBrainPausedBySignificance)
+            {
+                Brain->PauseLogic(TEXT("Significance"));
+                bBrainPausedBySignificance = true;
+            }
+            else if (!Settings.bPauseBehaviorTree && bBrainPausedBySignificance)
+            {
+                Brain->ResumeLogic(TEXT("Significance"));
+                bBrainPausedBySignificance = false;
+            }
+        }
+    }
+
+    // ========== 애니메이션 ==========
+    if (USkeletalMeshComponent* SkelMesh = GetMesh())
+    {
+        SkelMesh->VisibilityBasedAnimTickOption = Settings.AnimTickOption;
+        SkelMesh->bEnableUpdateRateOptimizations = Settings.bUseUpdateRateOptimizations;
+        SkelMesh->SetComponentTickInterval(Settings.AnimTickInterval);
+    }
+
+    // ========== 체력 위젯 (화면 공간 위젯은 숨겨도 틱하므로 틱도 끔) ==========
+    if (EnemyHUDWidgetComp)
+    {
+        EnemyHUDWidgetComp->SetVisibility(Settings.bShowHealthWidget);
+        EnemyHUDWidgetComp->SetComponentTickEnabled(Settings.bShowHealthWidget);
+    }
+
+    // ========== 호버 파티클 ==========
+    bHoverParticlesSuppressed = !Settings.bAllowHoverParticles;
+    RefreshHoverParticles();
+}
+
 // ========================================
 // 보스 체력바 위젯 생성
 // ========================================
@@ -684,7 +848,11 @@ void AEnemyMecha::OnDeathMontageEnded(UAnimMontage* Montage, bool bInterrupted)
             GetMesh()->bPauseAnims = true;
         }
 
-        Destroy();
+        // 파괴는 서버가 하고 클라이언트는 복제로 제거됨
+        if (HasAuthority())
+        {
+            Destroy();
+        }
     }
 }
 
@@ -693,17 +861,19 @@ void AEnemyMecha::OnDeathMontageEnded(UAnimMontage* Montage, bool bInterrupted)
 // ========================================
 void AEnemyMecha::ResetBlackboardCombatState()
 {
-    if (AAIController* AICon = Cast<AAIController>(GetController()))
+    if (AEnemyAIController* AICon = Cast<AEnemyAIController>(GetController()))
     {
         if (UBlackboardComponent* BB = AICon->GetBlackboardComponent())
         {
-            BB->SetValueAsBool(TEXT("IsAttacking"), false);
-            BB->SetValueAsBool(TEXT("IsDashing"), false);
-            BB->SetValueAsBool(TEXT("ShouldDash"), false);
+            const FMechaBlackboardKeys& Keys = AICon->GetBlackboardKeys();
+
+            FMechaBlackboardKeys::SetBool(BB, Keys.IsAttacking, false);
+            FMechaBlackboardKeys::SetBool(BB, Keys.IsDashing, false);
+            FMechaBlackboardKeys::SetBool(BB, Keys.ShouldDash, false);
 
-            BB->SetValueAsBool(TEXT("InHookRange"), false);
-            BB->SetValueAsBool(TEXT("InUppercutRange"), false);
-            BB->SetValueAsBool(TEXT("InFireRange"), false);
+            FMechaBlackboardKeys::SetBool(BB, Keys.InHookRange, false);
+            FMechaBlackboardKeys::SetBool(BB, Keys.InUppercutRange, false);
+            FMechaBlackboardKeys::SetBool(BB, Keys.InFireRange, false);
         }
     }
 }
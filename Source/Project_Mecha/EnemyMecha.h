@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
 #include "AbilitySystemInterface.h"
+#include "MechaProjectileSimSubsystem.h"
+#include "MechaSignificanceSubsystem.h"
 #include "EnemyMecha.generated.h"
 
 class UAbilitySystemComponent;
@@ -28,7 +30,7 @@ class PROJECT_MECHA_API AEnemyMecha
     GENERATED_BODY()
 
 public:
-    AEnemyMecha();
+    AEnemyMecha(const FObjectInitializer& ObjectInitializer);
 
     // === AbilitySystemInterface 구현 ===
     virtual UAbilitySystemComponent* GetAbilitySystemComponent() const override;
@@ -53,6 +55,21 @@ public:
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Combat", meta = (AllowPrivateAccess = "true"))
     float FallbackSpawnOffset = 100.f;
 
+    // 레벨 시작 시 투사체 풀에 미리 만들어 둘 미사일 개수 (같은 클래스는 적끼리 공유)
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Combat", meta = (AllowPrivateAccess = "true"))
+    int32 MissilePrewarmCount_Enemy = 4;
+
+    // true면 미사일 액터 대신 ProjectileSim 서브시스템의 시뮬레이션 투사체로 발사
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Combat|Sim", meta = (AllowPrivateAccess = "true"))
+    bool bUseSimulatedMissile_Enemy = false;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Combat|Sim", meta = (AllowPrivateAccess = "true", EditCondition = "bUseSimulatedMissile_Enemy"))
+    FMechaSimProjectileArchetype SimMissileArchetype_Enemy;
+
+    // 시뮬레이션 미사일 명중 시 데미지 (액터 미사일은 BP에서 처리)
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Combat|Sim", meta = (AllowPrivateAccess = "true", EditCondition = "bUseSimulatedMissile_Enemy"))
+    FMechaSimDamageSpec SimMissileDamage_Enemy;
+
     // AI가 채워줄 타겟
     UPROPERTY(BlueprintReadWrite, Category = "AI")
     AActor* CurrentTarget;
@@ -158,6 +175,23 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Enemy|Hover")
     void SetHoverParticleRotation(FRotator NewRotation);
 
+    // === 중요도(LOD) - UMechaSignificanceSubsystem이 호출 ===
+    // 단계가 바뀔 때만 틱 간격 / BT / 애님 / 위젯 / 호버 파티클 설정을 적용
+    void ApplySignificance(EMechaSignificance NewSignificance, const FMechaSignificanceSettings& Settings);
+
+    UFUNCTION(BlueprintPure, Category = "Enemy|Significance")
+    EMechaSignificance GetSignificance() const { return Significance; }
+
+private:
+    EMechaSignificance Significance = EMechaSignificance::High;
+    bool bBrainPausedBySignificance = false;
+
+    // 호버 파티클: 능력이 원하는 상태 / 중요도로 억제 중인지
+    bool bWantsHoverParticles = false;
+    bool bHoverParticlesSuppressed = false;
+
+    void RefreshHoverParticles();
+
 protected:
 
     // 플레이어와 같은 AttributeSet 사용 (Health, MaxHealth 등)
@@ -214,6 +248,7 @@ protected:
     FTimerHandle TimerHandle_SlowMotionRestore;
 
     // === Enemy HUD 위젯 컴포넌트 ===
+    // 체력바 오버레이(Mecha.UI.HealthBarOverlay)가 켜져 있으면 BeginPlay에서 제거되어 nullptr
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "UI", meta = (AllowPrivateAccess = "true"))
     UWidgetComponent* EnemyHUDWidgetComp;
 
@@ -235,6 +270,7 @@ protected:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
     // 보스 체력바 생성
     void CreateBossHealthWidget();
@@ -272,6 +308,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Enemy|Attributes")
     float GetMaxHealth() const;
 
+    UFUNCTION(BlueprintPure, Category = "Enemy|Attributes")
+    bool IsDead() const { return bIsDead; }
+
     UFUNCTION(BlueprintCallable, Category = "Enemy|AI")
     UBehaviorTree* GetBehaviorTree() const { return BehaviorTreeAsset; }
 
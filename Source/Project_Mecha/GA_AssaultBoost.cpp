@@ -2,17 +2,23 @@
 // 어설트 부스트 능력 - 전방 돌진, 에너지 소모, 과열 처리
 
 #include "GA_AssaultBoost.h"
+#include "MechaStats.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "TimerManager.h"
 #include "Animation/AnimInstance.h"
-#include "Kismet/GameplayStatics.h"
 #include "Particles/ParticleSystemComponent.h"
 #include "AbilitySystemComponent.h"
 #include "MechaAttributeSet.h"
 #include "GameFramework/PlayerController.h"
-#include "Camera/CameraComponent.h"
-#include "GameFramework/SpringArmComponent.h"
+#include "MechaCharacterBase.h"
+#include "MechaCameraBlendComponent.h"
+#include "MechaMovementComponent.h"
+#include "MechaFXPoolSubsystem.h"
+
+// ===== stat Mecha (능력별) =====
+DECLARE_CYCLE_STAT(TEXT("AssaultBoost Activate"), STAT_Mecha_AssaultBoost_Activate, STATGROUP_Mecha);
+DECLARE_CYCLE_STAT(TEXT("AssaultBoost End"), STAT_Mecha_AssaultBoost_End, STATGROUP_Mecha);
 
 // ========================================
 // 생성자
@@ -41,6 +47,8 @@ void UGA_AssaultBoost::ActivateAbility(
 	const FGameplayAbilityActivationInfo ActivationInfo,
 	const FGameplayEventData* TriggerEventData)
 {
+	MECHA_ABILITY_SCOPE(STAT_Mecha_AssaultBoost_Activate, Activate);
+
 	// 코스트/쿨다운 체크
 	if (!CommitAbility(Handle, ActorInfo, ActivationInfo))
 	{
@@ -79,12 +87,10 @@ void UGA_AssaultBoost::ActivateAbility(
 	// ========== 카메라 효과 적용 ==========
 	ApplyCameraEffects();
 
-	// ========== 전방 돌진 ==========
-	if (UCharacterMovementComponent* Move = OwnerChar->GetCharacterMovement())
+	// ========== 전방 돌진 (이동 컴포넌트 AssaultBoost 모드, 다음 이동 틱에 진입) ==========
+	if (UMechaMovementComponent* MechaMove = Cast<UMechaMovementComponent>(OwnerChar->GetCharacterMovement()))
 	{
-		Move->SetMovementMode(MOVE_Flying);     // 공중 상태로 전환
-		Move->StopMovementImmediately();        // 기존 속도 초기화
-		Move->Velocity = OwnerChar->GetActorForwardVector() * BoostForce;  // 전방으로 가속
+		MechaMove->StartAssaultBoost(BoostForce, BoostDuration);
 	}
 
 	// ========== 돌진 애니메이션 재생 ==========
@@ -114,10 +120,10 @@ void UGA_AssaultBoost::ActivateAbility(
 						? FRotator(270, 0, 180)
 						: FRotator::ZeroRotator;
 
-					UParticleSystemComponent* FX = UGameplayStatics::SpawnEmitterAttached(
+					// 풀 컴포넌트 재사용 (EndAbility의 DeactivateSystem 후 파티클이 끝나면 자동 반납)
+					UParticleSystemComponent* FX = UMechaFXPoolSubsystem::SpawnFXAttached(
 						BoostParticle, Mesh, SocketName,
-						FVector::ZeroVector, Rot,
-						EAttachLocation::SnapToTarget, true
+						FVector::ZeroVector, Rot
 					);
 
 					if (FX)
@@ -217,6 +223,8 @@ void UGA_AssaultBoost::EndAbility(
 	const FGameplayAbilityActivationInfo ActivationInfo,
 	bool bReplicateEndAbility, bool bWasCancelled)
 {
+	MECHA_ABILITY_SCOPE(STAT_Mecha_AssaultBoost_End, End);
+
 	// 에너지 소모 중단
 	RemoveDrainGE();
 
@@ -251,66 +259,47 @@ void UGA_AssaultBoost::EndAbility(
 			Anim->Montage_Stop(0.2f);
 		}
 
-		// 이동 모드 및 중력 복원
-		if (UCharacterMovementComponent* Move = OwnerChar->GetCharacterMovement())
+		// 돌진 종료 (정지 후 Falling은 이동 컴포넌트가 처리, 시간 만료로 이미 끝났으면 무시)
+		if (UMechaMovementComponent* MechaMove = Cast<UMechaMovementComponent>(OwnerChar->GetCharacterMovement()))
 		{
-			Move->StopMovementImmediately();
-			Move->SetMovementMode(MOVE_Falling);  // 낙하 상태로
-			Move->GravityScale = 1.0f;            // 정상 중력
+			MechaMove->StopAssaultBoost();
 		}
 	}
 
 	Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
 
-	// ========== 카메라 즉시 복원 시작 (Super::EndAbility 이후!) ==========
-	if (OwnerChar)
-	{
-		// 복원 모드 활성화
-		bIsRestoring = true;
-		TargetFOV = OriginalFOV;
-		TargetCameraDistance = OriginalCameraDistance;
-
-		// 복원 함수 호출
-		RestoreCameraEffects();
-	}
+	// ========== 카메라 복원 (Super::EndAbility 이후!) ==========
+	RestoreCameraEffects();
 }
 
 // ========================================
-// 카메라 효과 적용
+// 카메라 효과 적용 - 카메라 블렌드 컴포넌트에 요청 추가
 // ========================================
 void UGA_AssaultBoost::ApplyCameraEffects()
 {
 	if (!OwnerChar) return;
 
-	// ========== 현재 카메라 상태 저장 ==========
-	bIsRestoring = false;  // 부스트 시작 (복원 아님)
-
-	UCameraComponent* Camera = OwnerChar->FindComponentByClass<UCameraComponent>();
-	if (Camera)
-	{
-		OriginalFOV = Camera->FieldOfView;
-		CurrentFOV = OriginalFOV;
-		TargetFOV = bEnableFOVChange ? BoostFOV : OriginalFOV;
-	}
-
-	USpringArmComponent* SpringArm = OwnerChar->FindComponentByClass<USpringArmComponent>();
-	if (SpringArm)
+	// ========== FOV / 카메라 거리 요청 ==========
+	if (bEnableFOVChange || bEnableCameraDistance)
 	{
-		OriginalCameraDistance = SpringArm->TargetArmLength;
-		CurrentCameraDistance = OriginalCameraDistance;
-		TargetCameraDistance = bEnableCameraDistance ? BoostCameraDistance : OriginalCameraDistance;
-	}
-
-	// ========== 부드러운 전환 타이머 시작 ==========
-	if (UWorld* World = OwnerChar->GetWorld())
-	{
-		World->GetTimerManager().SetTimer(
-			CameraUpdateTimer,
-			this,
-			&UGA_AssaultBoost::UpdateCameraSmooth,
-			0.016f,  // ~60fps
-			true     // 반복
-		);
+		AMechaCharacterBase* Mecha = Cast<AMechaCharacterBase>(OwnerChar);
+		UMechaCameraBlendComponent* CameraBlend = Mecha ? Mecha->GetCameraBlend() : nullptr;
+		if (CameraBlend)
+		{
+			// 재활성화 시 이전 요청이 남아 있으면 교체
+			CameraBlend->PopRequest(CameraBlendHandle);
+
+			FMechaCameraBlendRequest Request;
+			Request.Priority = CameraBlendPriority;
+			Request.bOverrideFOV = bEnableFOVChange;
+			Request.FOV = BoostFOV;
+			Request.bOverrideArmLength = bEnableCameraDistance;
+			Request.ArmLength = BoostCameraDistance;
+			Request.BlendInSpeed = FOVBlendSpeed;
+			Request.BlendOutSpeed = FOVRestoreSpeed;
+
+			CameraBlendHandle = CameraBlend->PushRequest(Request);
+		}
 	}
 
 	// ========== 카메라 쉐이크 ==========
@@ -324,155 +313,16 @@ void UGA_AssaultBoost::ApplyCameraEffects()
 }
 
 // ========================================
-// 카메라 효과 복원
+// 카메라 효과 복원 - 요청 제거 (복원 보간은 컴포넌트가 처리)
 // ========================================
 void UGA_AssaultBoost::RestoreCameraEffects()
 {
-	if (!OwnerChar) return;
-
-	// ========== 즉시 복원 시작 ==========
-	bIsRestoring = true;  // 복원 모드 활성화
-	TargetFOV = OriginalFOV;
-	TargetCameraDistance = OriginalCameraDistance;
-
-	// 즉시 한번 업데이트 (복원 즉시 시작!)
-	UpdateCameraSmooth();
-
-	if (UWorld* World = OwnerChar->GetWorld())
-	{
-		// 기존 타이머 정리 후 즉시 재시작
-		World->GetTimerManager().ClearTimer(CameraUpdateTimer);
-
-		World->GetTimerManager().SetTimer(
-			CameraUpdateTimer,
-			this,
-			&UGA_AssaultBoost::UpdateCameraSmooth,
-			0.016f,  // ~60fps
-			true     // 반복
-		);
-	}
-
-	if (UWorld* World = OwnerChar->GetWorld())
-	{
-		// 기존 Cleanup 타이머 정리
-		World->GetTimerManager().ClearTimer(CleanupTimer);
-
-		// Failsafe: 10초 후에도 복원이 안 되면 강제 정리 (보통은 UpdateCameraSmooth에서 자동 정리됨)
-		World->GetTimerManager().SetTimer(
-			CleanupTimer,
-			[this]()
-			{
-				if (UWorld* World = OwnerChar ? OwnerChar->GetWorld() : nullptr)
-				{
-					// 최종 카메라 상태 확인 및 강제 설정
-					UCameraComponent* Camera = OwnerChar->FindComponentByClass<UCameraComponent>();
-					if (Camera && bEnableFOVChange)
-					{
-						// 정확하게 설정
-						Camera->SetFieldOfView(OriginalFOV);
-					}
-
-					USpringArmComponent* SpringArm = OwnerChar->FindComponentByClass<USpringArmComponent>();
-					if (SpringArm && bEnableCameraDistance)
-					{
-						SpringArm->TargetArmLength = OriginalCameraDistance;
-					}
-
-					World->GetTimerManager().ClearTimer(CameraUpdateTimer);
-				}
-			},
-			10.0f,  // 2초 → 10초 (충분한 시간, 보통은 자동 완료됨)
-			false
-		);
-	}
-}
-
-// ========================================
-// 카메라 부드러운 업데이트 (매 프레임 호출)
-// ========================================
-void UGA_AssaultBoost::UpdateCameraSmooth()
-{
-	if (!OwnerChar)
-	{
-		return;
-	}
+	if (CameraBlendHandle == INDEX_NONE) return;
 
-	const float DeltaTime = 0.016f;  // ~60fps
-
-	// ========== FOV 부드러운 전환 ==========
-	if (bEnableFOVChange)
+	AMechaCharacterBase* Mecha = Cast<AMechaCharacterBase>(OwnerChar);
+	if (UMechaCameraBlendComponent* CameraBlend = Mecha ? Mecha->GetCameraBlend() : nullptr)
 	{
-		UCameraComponent* Camera = OwnerChar->FindComponentByClass<UCameraComponent>();
-		if (Camera)
-		{
-			// 현재 FOV 가져오기
-			float OldFOV = Camera->FieldOfView;
-
-			// 복원 중일 때는 더 느린 속도 사용
-			float CurrentBlendSpeed = bIsRestoring ? FOVRestoreSpeed : FOVBlendSpeed;
-
-			// 타겟 FOV로 부드럽게 보간
-			float NewFOV = FMath::FInterpTo(OldFOV, TargetFOV, DeltaTime, CurrentBlendSpeed);
-			Camera->SetFieldOfView(NewFOV);
-
-			CurrentFOV = NewFOV;
-
-			// ========== 복원 완료 체크 (목표에 거의 도달하면 타이머 정리) ==========
-			if (bIsRestoring && FMath::Abs(NewFOV - TargetFOV) < 0.5f)
-			{
-				// 정확하게 설정
-				Camera->SetFieldOfView(TargetFOV);
-
-				// 거리도 체크
-				bool bDistanceRestored = true;
-				if (bEnableCameraDistance)
-				{
-					USpringArmComponent* SpringArm = OwnerChar->FindComponentByClass<USpringArmComponent>();
-					if (SpringArm)
-					{
-						float CurrentDist = SpringArm->TargetArmLength;
-						if (FMath::Abs(CurrentDist - TargetCameraDistance) < 5.0f)
-						{
-							SpringArm->TargetArmLength = TargetCameraDistance;
-						}
-						else
-						{
-							bDistanceRestored = false;
-						}
-					}
-				}
-
-				// 둘 다 복원 완료되면 타이머 정리
-				if (bDistanceRestored)
-				{
-					if (UWorld* World = OwnerChar->GetWorld())
-					{
-						World->GetTimerManager().ClearTimer(CameraUpdateTimer);
-						World->GetTimerManager().ClearTimer(CleanupTimer);  // Failsafe 타이머도 정리
-					}
-					bIsRestoring = false;
-				}
-			}
-		}
-	}
-
-	// ========== 카메라 거리 부드러운 전환 ==========
-	if (bEnableCameraDistance)
-	{
-		USpringArmComponent* SpringArm = OwnerChar->FindComponentByClass<USpringArmComponent>();
-		if (SpringArm)
-		{
-			// 현재 거리 가져오기
-			float OldDistance = SpringArm->TargetArmLength;
-
-			// 복원 중일 때는 더 느린 속도 사용
-			float CurrentBlendSpeed = bIsRestoring ? FOVRestoreSpeed : FOVBlendSpeed;
-
-			// 타겟 거리로 부드럽게 보간
-			float NewDistance = FMath::FInterpTo(OldDistance, TargetCameraDistance, DeltaTime, CurrentBlendSpeed);
-			SpringArm->TargetArmLength = NewDistance;
-
-			CurrentCameraDistance = NewDistance;
-		}
+		CameraBlend->PopRequest(CameraBlendHandle);
 	}
+	CameraBlendHandle = INDEX_NONE;
 }
@@ -72,6 +72,10 @@ protected:
     UPROPERTY(EditDefaultsOnly, Category = "Camera")
     TSubclassOf<class UCameraShakeBase> BoostCameraShake;
 
+    // 카메라 연출 우선순위 (호버 중 부스트하면 부스트 연출이 우선)
+    UPROPERTY(EditDefaultsOnly, Category = "Camera")
+    int32 CameraBlendPriority = 10;
+
     // ===== Energy System =====
     UPROPERTY(EditDefaultsOnly, Category = "Boost|Energy")
     TSubclassOf<UGameplayEffect> GE_AssaultBoostDrain;
@@ -105,19 +109,9 @@ protected:
     bool bPrevIgnoreLookInput = false;
 
     // ===== Camera State =====
-    float OriginalFOV = 90.f;
-    float OriginalCameraDistance = 400.f;
-    float CurrentFOV = 90.f;
-    float TargetFOV = 90.f;
-    float CurrentCameraDistance = 400.f;
-    float TargetCameraDistance = 400.f;
-
-    bool bIsRestoring = false;  // 복원 중인지 여부
-
-    FTimerHandle CameraUpdateTimer;
-    FTimerHandle CleanupTimer;  // Failsafe 타이머
+    // 카메라 블렌드 컴포넌트 요청 핸들
+    int32 CameraBlendHandle = INDEX_NONE;
 
     void ApplyCameraEffects();
     void RestoreCameraEffects();
-    void UpdateCameraSmooth();
 };
@@ -2,7 +2,10 @@
 // 근접 공격 능력 - 구체 스윕으로 적 탐지, GAS 데미지 적용
 
 #include "GA_Attack.h"
+#include "MechaStats.h"
+#include "MechaNativeTags.h"
 #include "MechaCharacterBase.h"
+#include "MechaFXPoolSubsystem.h"
 
 #include "AbilitySystemBlueprintLibrary.h"
 #include "AbilitySystemComponent.h"
@@ -13,6 +16,10 @@
 #include "Kismet/KismetSystemLibrary.h"
 #include "GameFramework/Controller.h"
 
+// ===== stat Mecha (능력별) =====
+DECLARE_CYCLE_STAT(TEXT("Attack Activate"), STAT_Mecha_Attack_Activate, STATGROUP_Mecha);
+DECLARE_CYCLE_STAT(TEXT("Attack End"), STAT_Mecha_Attack_End, STATGROUP_Mecha);
+
 // ========================================
 // 생성자
 // ========================================
@@ -22,10 +29,10 @@ UGA_Attack::UGA_Attack()
 	InstancingPolicy = EGameplayAbilityInstancingPolicy::InstancedPerActor;
 	
 	// 공격 능력 태그 추가
-	AbilityTags.AddTag(FGameplayTag::RequestGameplayTag(TEXT("Ability.Attack")));
+	AbilityTags.AddTag(MechaTags::Ability_Attack);
 
 	// === 공격 중 상태 태그 ===
-	AttackStateTag = FGameplayTag::RequestGameplayTag(TEXT("State.Attacking"));
+	AttackStateTag = MechaTags::State_Attacking;
 
 	// 이 어빌리티가 활성화되어 있는 동안 ASC에 자동으로 추가될 태그
 	ActivationOwnedTags.AddTag(AttackStateTag);
@@ -40,6 +47,8 @@ void UGA_Attack::ActivateAbility(
 	const FGameplayAbilityActivationInfo ActivationInfo,
 	const FGameplayEventData* TriggerEventData)
 {
+	MECHA_ABILITY_SCOPE(STAT_Mecha_Attack_Activate, Activate);
+
 	// 코스트/쿨다운 체크
 	if (!CommitAbility(Handle, ActorInfo, ActivationInfo))
 	{
@@ -68,6 +77,8 @@ void UGA_Attack::EndAbility(
 	const FGameplayAbilityActivationInfo ActivationInfo,
 	bool bReplicateEndAbility, bool bWasCancelled)
 {
+	MECHA_ABILITY_SCOPE(STAT_Mecha_Attack_End, End);
+
 	Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
 }
 
@@ -108,7 +119,7 @@ void UGA_Attack::PerformAttackTrace(AActor* SourceActor)
 	// ========== 히트 피드백 ==========
 	// 히트 이펙트
 	if (HitEffect) 
-		UGameplayStatics::SpawnEmitterAtLocation(World, HitEffect, Hit.ImpactPoint);
+		UMechaFXPoolSubsystem::SpawnFXAtLocation(World, HitEffect, Hit.ImpactPoint);
 	
 	// 히트 사운드
 	if (HitSound)  
@@ -140,7 +151,7 @@ void UGA_Attack::ApplyDamage_GASOrEngine(AActor* SourceActor, AActor* HitActor,
 		{
 			// SetByCaller로 데미지 값 전달
 			SpecHandle.Data->SetSetByCallerMagnitude(
-				FGameplayTag::RequestGameplayTag(*SetByCallerDamageName.ToString()), 
+				FMechaNativeTags::ResolveSetByCallerTag(SetByCallerDamageName), 
 				AttackDamage
 			);
 
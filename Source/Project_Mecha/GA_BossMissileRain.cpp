@@ -1,6 +1,8 @@
 ﻿// GA_BossMissileRain.cpp
 
 #include "GA_BossMissileRain.h"
+#include "MechaStats.h"
+#include "MechaNativeTags.h"
 
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -9,18 +11,27 @@
 #include "Kismet/KismetMathLibrary.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
-#include "AIController.h"
+#include "EnemyAIController.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "EnemyMecha.h"
+#include "MechaProjectilePoolSubsystem.h"
+#include "MechaCombatRegistrySubsystem.h"
 #include "AbilitySystemInterface.h"
 #include "AbilitySystemComponent.h"
 #include "GameplayTagContainer.h"
 #include "Animation/AnimInstance.h"
 
+// ===== stat Mecha (능력별) =====
+DECLARE_CYCLE_STAT(TEXT("BossMissileRain Activate"), STAT_Mecha_BossMissileRain_Activate, STATGROUP_Mecha);
+DECLARE_CYCLE_STAT(TEXT("BossMissileRain End"), STAT_Mecha_BossMissileRain_End, STATGROUP_Mecha);
+
 UGA_BossMissileRain::UGA_BossMissileRain()
 {
     InstancingPolicy = EGameplayAbilityInstancingPolicy::InstancedPerActor;
 
+    // AI 전용 능력: 서버에서만 실행
+    NetExecutionPolicy = EGameplayAbilityNetExecutionPolicy::ServerOnly;
+
     // 기본값 세팅
     HoverDuration = 7.0f;
     ShotsPerSide = 5;     // 좌 5발, 우 5발
@@ -29,12 +40,38 @@ UGA_BossMissileRain::UGA_BossMissileRain()
     RightMuzzleSocketName = TEXT("Muzzle02");
 }
 
+void UGA_BossMissileRain::OnGiveAbility(
+    const FGameplayAbilityActorInfo* ActorInfo,
+    const FGameplayAbilitySpec& Spec)
+{
+    Super::OnGiveAbility(ActorInfo, Spec);
+
+    AActor* Avatar = ActorInfo ? ActorInfo->AvatarActor.Get() : nullptr;
+    if (!Avatar || !MissileClass)
+    {
+        return;
+    }
+
+    if (bUseSimulatedMissiles && UMechaProjectileSimSubsystem::IsSimulationAllowed(Avatar))
+    {
+        return;
+    }
+
+    // 패턴 한 번 분량(좌/우 합계)을 미리 스폰
+    if (UMechaProjectilePoolSubsystem* Pool = UMechaProjectilePoolSubsystem::Get(Avatar))
+    {
+        Pool->PrewarmPool(MissileClass, ShotsPerSide * 2);
+    }
+}
+
 void UGA_BossMissileRain::ActivateAbility(
     const FGameplayAbilitySpecHandle Handle,
     const FGameplayAbilityActorInfo* ActorInfo,
     const FGameplayAbilityActivationInfo ActivationInfo,
     const FGameplayEventData* TriggerEventData)
 {
+    MECHA_ABILITY_SCOPE(STAT_Mecha_BossMissileRain_Activate, Activate);
+
     Super::ActivateAbility(Handle, ActorInfo, ActivationInfo, TriggerEventData);
 
     if (!CommitAbility(Handle, ActorInfo, ActivationInfo))
@@ -57,7 +94,7 @@ void UGA_BossMissileRain::ActivateAbility(
             if (UAbilitySystemComponent* ASC = ASI->GetAbilitySystemComponent())
             {
                 ASC->AddLooseGameplayTag(
-                    FGameplayTag::RequestGameplayTag(TEXT("State.SuperArmor"))
+                    MechaTags::State_SuperArmor
                 );
             }
         }
@@ -69,12 +106,9 @@ void UGA_BossMissileRain::ActivateAbility(
     // 1-1) Blackboard에 "IsUsingMissileRain" = true 세팅
     if (AEnemyMecha* BossChar = Cast<AEnemyMecha>(ActorInfo->AvatarActor.Get()))
     {
-        if (AAIController* AICon = Cast<AAIController>(BossChar->GetController()))
+        if (AEnemyAIController* AICon = Cast<AEnemyAIController>(BossChar->GetController()))
         {
-            if (UBlackboardComponent* BB = AICon->GetBlackboardComponent())
-            {
-                BB->SetValueAsBool(TEXT("IsUsingMissileRain"), true);
-            }
+            FMechaBlackboardKeys::SetBool(AICon->GetBlackboardComponent(), AICon->GetBlackboardKeys().IsUsingMissileRain, true);
         }
     }
 
@@ -116,6 +150,8 @@ void UGA_BossMissileRain::EndAbility(
     bool bReplicateEndAbility,
     bool bWasCancelled)
 {
+    MECHA_ABILITY_SCOPE(STAT_Mecha_BossMissileRain_End, End);
+
     UWorld* World = GetWorld();
     if (World)
     {
@@ -134,17 +170,14 @@ void UGA_BossMissileRain::EndAbility(
             if (UAbilitySystemComponent* ASC = BossChar->GetAbilitySystemComponent())
             {
                 ASC->RemoveLooseGameplayTag(
-                    FGameplayTag::RequestGameplayTag(TEXT("State.SuperArmor"))
+                    MechaTags::State_SuperArmor
                 );
             }
 
             // 🔹 2) Blackboard에 "IsUsingMissileRain" = false 세팅
-            if (AAIController* AICon = Cast<AAIController>(BossChar->GetController()))
+            if (AEnemyAIController* AICon = Cast<AEnemyAIController>(BossChar->GetController()))
             {
-                if (UBlackboardComponent* BB = AICon->GetBlackboardComponent())
-                {
-                    BB->SetValueAsBool(TEXT("IsUsingMissileRain"), false);
-                }
+                FMechaBlackboardKeys::SetBool(AICon->GetBlackboardComponent(), AICon->GetBlackboardKeys().IsUsingMissileRain, false);
             }
         }
     }
@@ -223,6 +256,8 @@ void UGA_BossMissileRain::EndHover(const FGameplayAbilityActorInfo* ActorInfo)
 
 void UGA_BossMissileRain::SpawnMissilePair()
 {
+    SCOPE_CYCLE_COUNTER(STAT_Mecha_ProjectileSpawn);
+
     // 쏴야 할 만큼 다 쐈으면 타이머 정지
     if (ShotsFiredPairs >= ShotsPerSide)
     {
@@ -246,13 +281,26 @@ void UGA_BossMissileRain::SpawnMissilePair()
     }
 
     UWorld* World = GetWorld();
-    if (!World || !MissileClass)
+    if (!World || !BossChar->HasAuthority())
+    {
+        return;
+    }
+
+    // 시뮬레이션 투사체는 복제되지 않으므로 네트워크 세션에서는 풀 액터로 대체
+    const bool bUseSim = bUseSimulatedMissiles && UMechaProjectileSimSubsystem::IsSimulationAllowed(BossChar);
+    if (!bUseSim && !MissileClass)
     {
         return;
     }
 
-    // 타겟: 플레이어 (0번 플레이어 기준)
-    APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(World, 0);
+    // 타겟: AI가 잡은 타겟, 없으면 가장 가까운 플레이어 (멀티플레이에서 0번 플레이어 고정 방지)
+    const AEnemyMecha* Boss = Cast<AEnemyMecha>(BossChar);
+    AActor* PlayerPawn = Boss ? Boss->CurrentTarget : nullptr;
+    if (!IsValid(PlayerPawn))
+    {
+        const UMechaCombatRegistrySubsystem* Registry = UMechaCombatRegistrySubsystem::Get(BossChar);
+        PlayerPawn = Registry ? Registry->FindNearest(EMechaCombatTeam::Player, BossChar->GetActorLocation()) : nullptr;
+    }
     const bool bHasTarget = IsValid(PlayerPawn);
 
     USkeletalMeshComponent* Mesh = BossChar->GetMesh();
@@ -291,25 +339,29 @@ void UGA_BossMissileRain::SpawnMissilePair()
         RightRot.Pitch += RandPitchOffsetR;
     }
 
-    FActorSpawnParameters SpawnParams;
-    SpawnParams.Owner = BossChar;
-    SpawnParams.Instigator = BossChar;
+    // 시뮬레이션 미사일 (액터 없음)
+    if (bUseSim)
+    {
+        if (UMechaProjectileSimSubsystem* Sim = World->GetSubsystem<UMechaProjectileSimSubsystem>())
+        {
+            Sim->SpawnProjectile(SimMissileArchetype, LeftLoc, LeftRot.Vector(), PlayerPawn, BossChar, SimMissileDamage);
+            Sim->SpawnProjectile(SimMissileArchetype, RightLoc, RightRot.Vector(), PlayerPawn, BossChar, SimMissileDamage);
+        }
+        ++ShotsFiredPairs;
+        return;
+    }
+
+    UMechaProjectilePoolSubsystem* Pool = UMechaProjectilePoolSubsystem::Get(BossChar);
+    if (!Pool)
+    {
+        return;
+    }
 
     // 왼쪽 미사일
-    World->SpawnActor<AActor>(
-        MissileClass,
-        LeftLoc,
-        LeftRot,
-        SpawnParams
-    );
+    Pool->AcquireProjectile(MissileClass, LeftLoc, LeftRot, BossChar, BossChar);
 
     // 오른쪽 미사일
-    World->SpawnActor<AActor>(
-        MissileClass,
-        RightLoc,
-        RightRot,
-        SpawnParams
-    );
+    Pool->AcquireProjectile(MissileClass, RightLoc, RightRot, BossChar, BossChar);
 
     // 한 쌍 발사 완료
     ++ShotsFiredPairs;
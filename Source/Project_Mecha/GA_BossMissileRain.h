@@ -3,6 +3,7 @@
 
 #include "CoreMinimal.h"
 #include "Abilities/GameplayAbility.h"
+#include "MechaProjectileSimSubsystem.h"
 #include "GA_BossMissileRain.generated.h"
 
 class UAnimMontage;
@@ -29,6 +30,12 @@ public:
         const FGameplayEventData* TriggerEventData
     ) override;
 
+    // ɷ ο  ̻ Ǯ ̸ ä
+    virtual void OnGiveAbility(
+        const FGameplayAbilityActorInfo* ActorInfo,
+        const FGameplayAbilitySpec& Spec
+    ) override;
+
     // ɷ 
     virtual void EndAbility(
         const FGameplayAbilitySpecHandle Handle,
@@ -45,6 +52,16 @@ protected:
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Boss|Missile")
     TSubclassOf<AActor> MissileClass;
 
+    // true ̻   ProjectileSim ý ùķ̼ ü ߻
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Boss|Missile|Sim")
+    bool bUseSimulatedMissiles = false;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Boss|Missile|Sim", meta = (EditCondition = "bUseSimulatedMissiles"))
+    FMechaSimProjectileArchetype SimMissileArchetype;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Boss|Missile|Sim", meta = (EditCondition = "bUseSimulatedMissiles"))
+    FMechaSimDamageSpec SimMissileDamage;
+
     //  /    ̸
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Boss|Missile")
     FName LeftMuzzleSocketName;
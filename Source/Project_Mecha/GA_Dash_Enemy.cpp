@@ -2,6 +2,8 @@
 // 적 메카 대시 능력 - 타겟을 향해 빠르게 돌진
 
 #include "GA_Dash_Enemy.h"
+#include "MechaStats.h"
+#include "MechaNativeTags.h"
 #include "EnemyMecha.h"
 
 #include "AbilitySystemComponent.h"
@@ -10,12 +12,16 @@
 #include "GameplayEffectTypes.h"
 #include "TimerManager.h"
 #include "BehaviorTree/BlackboardComponent.h"
-#include "AIController.h"
+#include "EnemyAIController.h"
 #include "GameFramework/Character.h"
-#include "GameFramework/CharacterMovementComponent.h"
+#include "MechaMovementComponent.h"
 #include "Animation/AnimInstance.h"
 #include "Engine/World.h"
 
+// ===== stat Mecha (능력별) =====
+DECLARE_CYCLE_STAT(TEXT("Dash_Enemy Activate"), STAT_Mecha_Dash_Enemy_Activate, STATGROUP_Mecha);
+DECLARE_CYCLE_STAT(TEXT("Dash_Enemy End"), STAT_Mecha_Dash_Enemy_End, STATGROUP_Mecha);
+
 // ========================================
 // 생성자
 // ========================================
@@ -24,10 +30,13 @@ UGA_Dash_Enemy::UGA_Dash_Enemy()
 	// 액터마다 하나의 인스턴스만 생성
 	InstancingPolicy = EGameplayAbilityInstancingPolicy::InstancedPerActor;
 
+	// AI 전용 능력: 서버에서만 실행
+	NetExecutionPolicy = EGameplayAbilityNetExecutionPolicy::ServerOnly;
+
 	// ========== 게임플레이 태그 초기화 ==========
-	Tag_AbilityDash = FGameplayTag::RequestGameplayTag(TEXT("Ability.Dash.Enemy"));
-	Tag_StateDashing = FGameplayTag::RequestGameplayTag(TEXT("State.Dashing"));
-	Tag_CooldownDash = FGameplayTag::RequestGameplayTag(TEXT("Cooldown.Dash"));
+	Tag_AbilityDash = MechaTags::Ability_Dash_Enemy;
+	Tag_StateDashing = MechaTags::State_Dashing;
+	Tag_CooldownDash = MechaTags::Cooldown_Dash;
 
 	AbilityTags.AddTag(Tag_AbilityDash);
 	ActivationOwnedTags.AddTag(Tag_StateDashing);
@@ -66,6 +75,8 @@ void UGA_Dash_Enemy::ActivateAbility(
 	const FGameplayAbilityActivationInfo ActivationInfo,
 	const FGameplayEventData* TriggerEventData)
 {
+	MECHA_ABILITY_SCOPE(STAT_Mecha_Dash_Enemy_Activate, Activate);
+
 	// 코스트/쿨다운 체크
 	if (!CommitAbility(Handle, ActorInfo, ActivationInfo))
 	{
@@ -95,21 +106,6 @@ void UGA_Dash_Enemy::ActivateAbility(
 		AICon->StopMovement();
 	}
 
-	// ========== 이동 파라미터 저장 및 조정 (미끄러지게) ==========
-	if (UCharacterMovementComponent* MoveComp = EnemyChar->GetCharacterMovement())
-	{
-		if (!bSavedMovementParams)
-		{
-			SavedBrakingFrictionFactor = MoveComp->BrakingFrictionFactor;
-			SavedBrakingDecelWalking = MoveComp->BrakingDecelerationWalking;
-			bSavedMovementParams = true;
-		}
-
-		// 브레이킹 제거 (미끄러지는 효과)
-		MoveComp->BrakingFrictionFactor = 0.0f;
-		MoveComp->BrakingDecelerationWalking = 0.0f;
-	}
-
 	// ========== 방향 및 거리 계산 ==========
 	FVector ToTarget = TargetActor->GetActorLocation() - EnemyChar->GetActorLocation();
 	ToTarget.Z = 0.0f;  // XY 평면만 사용
@@ -151,10 +147,16 @@ void UGA_Dash_Enemy::ActivateAbility(
 		return;
 	}
 
-	const FVector LaunchVelocity = ToTarget * Speed;
+	const FVector DashVelocity = ToTarget * Speed;
 
-	// ========== 캐릭터 발사 (대시) ==========
-	EnemyChar->LaunchCharacter(LaunchVelocity, true, false);
+	// ========== 대시 (이동 컴포넌트 Dash 모드: 제동 없이 DashDuration 동안 직선 이동) ==========
+	UMechaMovementComponent* MechaMove = Cast<UMechaMovementComponent>(EnemyChar->GetCharacterMovement());
+	if (!MechaMove)
+	{
+		EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
+		return;
+	}
+	MechaMove->StartDash(DashVelocity, DashDuration);
 
 	// ========== 대시 애니메이션 재생 ==========
 	if (DashMontage && EnemyChar->GetMesh())
@@ -219,28 +221,22 @@ void UGA_Dash_Enemy::StopDash()
 
 	if (EnemyChar)
 	{
-		// ========== 이동 정지 ==========
-		if (UCharacterMovementComponent* MoveComp = EnemyChar->GetCharacterMovement())
+		// ========== 이동 정지 (시간 만료로 이미 끝났으면 무시) ==========
+		if (UMechaMovementComponent* MechaMove = Cast<UMechaMovementComponent>(EnemyChar->GetCharacterMovement()))
 		{
-			MoveComp->StopMovementImmediately();
-
-			// 이동 파라미터 복원
-			if (bSavedMovementParams)
-			{
-				MoveComp->BrakingFrictionFactor = SavedBrakingFrictionFactor;
-				MoveComp->BrakingDecelerationWalking = SavedBrakingDecelWalking;
-			}
+			MechaMove->StopDash();
 		}
 
 		// ========== 블랙보드 플래그 초기화 ==========
 		if (AEnemyMecha* EnemyMecha = Cast<AEnemyMecha>(EnemyChar))
 		{
-			if (AAIController* AICon = Cast<AAIController>(EnemyMecha->GetController()))
+			if (AEnemyAIController* AICon = Cast<AEnemyAIController>(EnemyMecha->GetController()))
 			{
 				if (UBlackboardComponent* BB = AICon->GetBlackboardComponent())
 				{
-					BB->SetValueAsBool(TEXT("IsDashing"), false);
-					BB->SetValueAsBool(TEXT("ShouldDash"), false);
+					const FMechaBlackboardKeys& Keys = AICon->GetBlackboardKeys();
+					FMechaBlackboardKeys::SetBool(BB, Keys.IsDashing, false);
+					FMechaBlackboardKeys::SetBool(BB, Keys.ShouldDash, false);
 				}
 			}
 		}
@@ -275,6 +271,8 @@ void UGA_Dash_Enemy::EndAbility(
 	bool bReplicateEndAbility,
 	bool bWasCancelled)
 {
+	MECHA_ABILITY_SCOPE(STAT_Mecha_Dash_Enemy_End, End);
+
 	// 타이머 정리
 	if (UWorld* World = GetWorld())
 	{
@@ -51,12 +51,7 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Dash|Animation")
     UAnimMontage* DashMontage;
 
-    // == 대시 중 Movement 파라미터 저장 ==
-    bool bSavedMovementParams = false;
-
-    float SavedBrakingFrictionFactor = 0.0f;
-    float SavedBrakingDecelWalking = 0.0f;
-
+    // 대시 종료(블랙보드/몽타주 정리) 타이머. 이동 자체는 UMechaMovementComponent Dash 모드가 처리
     FTimerHandle DashTimerHandle;
 
     virtual void ActivateAbility(
@@ -2,9 +2,14 @@
 // 총 발사 능력 - 탄창 관리, 크로스헤어 조준, 투사체 발사
 
 #include "GA_GunFire.h"
+#include "MechaStats.h"
 
 #include "MechaAttributeSet.h"
 #include "MechaCharacterBase.h"
+#include "MechaProjectilePoolSubsystem.h"
+#include "MechaAimTraceSubsystem.h"
+#include "MechaFXPoolSubsystem.h"
+#include "MechaPooledProjectileComponent.h"
 
 #include "AbilitySystemComponent.h"
 #include "Abilities/Tasks/AbilityTask_PlayMontageAndWait.h"
@@ -12,11 +17,13 @@
 
 #include "GameFramework/Character.h"
 #include "GameFramework/ProjectileMovementComponent.h"
-#include "GameFramework/PlayerController.h"
-#include "Kismet/GameplayStatics.h"
 #include "Engine/World.h"
 #include "Animation/AnimInstance.h"
 
+// ===== stat Mecha (능력별) =====
+DECLARE_CYCLE_STAT(TEXT("GunFire Activate"), STAT_Mecha_GunFire_Activate, STATGROUP_Mecha);
+DECLARE_CYCLE_STAT(TEXT("GunFire End"), STAT_Mecha_GunFire_End, STATGROUP_Mecha);
+
 // ========================================
 // 생성자
 // ========================================
@@ -26,6 +33,22 @@ UGA_GunFire::UGA_GunFire()
 	InstancingPolicy   = EGameplayAbilityInstancingPolicy::InstancedPerActor;
 }
 
+// ========================================
+// 능력 부여 - 투사체 풀 미리 채우기
+// ========================================
+void UGA_GunFire::OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec)
+{
+	Super::OnGiveAbility(ActorInfo, Spec);
+
+	AMechaCharacterBase* Mecha = ActorInfo ? Cast<AMechaCharacterBase>(ActorInfo->AvatarActor.Get()) : nullptr;
+	if (!Mecha || !Mecha->ProjectileClass) return;
+
+	if (UMechaProjectilePoolSubsystem* Pool = UMechaProjectilePoolSubsystem::Get(Mecha))
+	{
+		Pool->PrewarmPool(Mecha->ProjectileClass, PrewarmProjectileCount);
+	}
+}
+
 // ========================================
 // 능력 활성화 - 총 발사
 // ========================================
@@ -35,6 +58,8 @@ void UGA_GunFire::ActivateAbility(
 	const FGameplayAbilityActivationInfo ActivationInfo,
 	const FGameplayEventData* TriggerEventData)
 {
+	MECHA_ABILITY_SCOPE(STAT_Mecha_GunFire_Activate, Activate);
+
 	// 코스트/쿨다운 체크
 	if (!CommitAbility(Handle, ActorInfo, ActivationInfo))
 	{
@@ -106,6 +131,8 @@ void UGA_GunFire::OnMontageNotify()
 // ========================================
 void UGA_GunFire::SpawnProjectile(const FGameplayAbilityActorInfo* ActorInfo)
 {
+	SCOPE_CYCLE_COUNTER(STAT_Mecha_ProjectileSpawn);
+
 	if (!ActorInfo || !ActorInfo->AvatarActor.IsValid()) return;
 
 	AMechaCharacterBase* Mecha = Cast<AMechaCharacterBase>(ActorInfo->AvatarActor.Get());
@@ -132,59 +159,31 @@ void UGA_GunFire::SpawnProjectile(const FGameplayAbilityActorInfo* ActorInfo)
 	}
 
 	// ========== 2. 화면 중앙 크로스헤어로 조준점 계산 ==========
-	FVector TargetPoint = SpawnLoc + Mecha->GetActorForwardVector() * 10000.f;
-	FVector LaunchDir   = Mecha->GetActorForwardVector();
+	// 조준점은 사수별로 프레임당 1회만 트레이스 (비동기 모드면 이전 프레임 결과 사용)
+	FVector LaunchDir = Mecha->GetActorForwardVector();
 
-	if (APlayerController* PC = Cast<APlayerController>(Mecha->GetController()))
+	if (UMechaAimTraceSubsystem* AimTrace = UMechaAimTraceSubsystem::Get(Mecha))
 	{
-		int32 ViewX, ViewY;
-		PC->GetViewportSize(ViewX, ViewY);
-
-		// 화면 중앙 좌표
-		const float ScreenX = ViewX / 2.0f;
-		const float ScreenY = ViewY / 2.0f;
+		const FVector TargetPoint = AimTrace->GetAimPoint(Mecha, AimTraceDistance);
 
-		FVector WorldLoc, WorldDir;
-		if (PC->DeprojectScreenPositionToWorld(ScreenX, ScreenY, WorldLoc, WorldDir))
-		{
-			const FVector TraceStart = WorldLoc;
-			const FVector TraceEnd   = WorldLoc + WorldDir * 10000.f;
-
-			// 라인 트레이스로 조준점 찾기
-			FHitResult Hit;
-			FCollisionQueryParams Params;
-			Params.AddIgnoredActor(Mecha);
-
-			if (Mecha->GetWorld()->LineTraceSingleByChannel(Hit, TraceStart, TraceEnd, ECC_Visibility, Params))
-			{
-				// 무언가 맞으면 그 지점
-				TargetPoint = Hit.ImpactPoint;
-			}
-			else
-			{
-				// 안 맞으면 트레이스 끝점
-				TargetPoint = TraceEnd;
-			}
-
-			// 총구에서 조준점으로 방향 계산
-			LaunchDir = (TargetPoint - SpawnLoc).GetSafeNormal();
-		}
+		// 총구에서 조준점으로 방향 계산
+		LaunchDir = (TargetPoint - SpawnLoc).GetSafeNormal();
 	}
 	SpawnRot = LaunchDir.Rotation();
 
 	// ========== 3. 총구 섬광 이펙트 ==========
 	if (MuzzleFlash)
 	{
-		UGameplayStatics::SpawnEmitterAtLocation(Mecha->GetWorld(), MuzzleFlash, SpawnLoc, SpawnRot);
+		UMechaFXPoolSubsystem::SpawnFXAtLocation(Mecha, MuzzleFlash, SpawnLoc, SpawnRot);
 	}
 
-	// ========== 4. 투사체 스폰 ==========
-	FActorSpawnParameters Params;
-	Params.Owner = Mecha;
-	Params.Instigator = Mecha;
-	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	// ========== 4. 투사체 스폰 (서버만, 예측 클라이언트는 섬광만 재생하고 복제된 투사체를 받음) ==========
+	if (!Mecha->HasAuthority()) return;
 
-	AActor* Projectile = Mecha->GetWorld()->SpawnActor<AActor>(Mecha->ProjectileClass, SpawnLoc, SpawnRot, Params);
+	UMechaProjectilePoolSubsystem* Pool = UMechaProjectilePoolSubsystem::Get(Mecha);
+	if (!Pool) return;
+
+	AActor* Projectile = Pool->AcquireProjectile(Mecha->ProjectileClass, SpawnLoc, SpawnRot, Mecha, Mecha);
 	if (Projectile)
 	{
 		// 발사 속도 설정
@@ -193,6 +192,12 @@ void UGA_GunFire::SpawnProjectile(const FGameplayAbilityActorInfo* ActorInfo)
 			MoveComp->Velocity = LaunchDir * MoveComp->InitialSpeed;
 			MoveComp->Activate();
 		}
+
+		// 승격 전 군중 개체는 충돌체가 없으므로 투사체 이동 구간으로 판정 (맞으면 그 자리에서 멈춤)
+		if (UMechaPooledProjectileComponent* PoolComp = Projectile->FindComponentByClass<UMechaPooledProjectileComponent>())
+		{
+			PoolComp->SetCrowdDamage(CrowdHitDamage, 0.f);
+		}
 	}
 }
 
@@ -205,6 +210,8 @@ void UGA_GunFire::EndAbility(
 	const FGameplayAbilityActivationInfo ActivationInfo,
 	bool bReplicateEndAbility, bool bWasCancelled)
 {
+	MECHA_ABILITY_SCOPE(STAT_Mecha_GunFire_End, End);
+
 	// 발사 애니메이션 정리 (필요시)
 	if (ActorInfo && ActorInfo->AvatarActor.IsValid() && FireMontage)
 	{
@@ -23,6 +23,9 @@ public:
         const FGameplayAbilityActivationInfo ActivationInfo,
         const FGameplayEventData* TriggerEventData) override;
 
+    virtual void OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo,
+        const FGameplayAbilitySpec& Spec) override;
+
     virtual void EndAbility(const FGameplayAbilitySpecHandle Handle,
         const FGameplayAbilityActorInfo* ActorInfo,
         const FGameplayAbilityActivationInfo ActivationInfo,
@@ -51,4 +54,16 @@ protected:
     // 소켓이 없을 때 사용하는 스폰 오프셋 (앞쪽 거리)
     UPROPERTY(EditDefaultsOnly, Category = "GunFire|Spawn")
     float FallbackSpawnOffset = 100.f;
+
+    // 크로스헤어 조준 트레이스 거리
+    UPROPERTY(EditDefaultsOnly, Category = "GunFire|Aim")
+    float AimTraceDistance = 10000.f;
+
+    // 능력 부여 시 투사체 풀에 미리 만들어 둘 개수
+    UPROPERTY(EditDefaultsOnly, Category = "GunFire|Spawn")
+    int32 PrewarmProjectileCount = 16;
+
+    // 승격 전 군중 개체(충돌체 없음)에 주는 데미지. 투사체 이동 구간으로 판정
+    UPROPERTY(EditDefaultsOnly, Category = "GunFire|Crowd")
+    float CrowdHitDamage = 10.f;
 };
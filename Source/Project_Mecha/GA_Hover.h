@@ -1,7 +1,8 @@
 // GA_Hover.h
 // 설명:
 // - 호버링(공중 부유) 능력 클래스.
-// - 입력을 누르고 있는 동안 Flying 모드로 전환하여 공중에 떠 있게 한다.
+// - 입력을 누르고 있는 동안 UMechaMovementComponent의 Hover 이동 모드로 공중에 떠 있게 한다.
+//   상승 보정/중력/마찰은 이동 컴포넌트가 이동 틱마다 적분한다 (타이머 없음).
 // - 에너지를 지속적으로 소모하며, 에너지가 0이 되면 과열 상태로 전환된다.
 //
 #pragma once
@@ -19,7 +20,7 @@ class UAbilitySystemComponent;
 class UGameplayEffect;
 
 // 설명:
-// - 호버링 능력. 입력 누르는 동안 Flying 모드 유지, 에너지 소모.
+// - 호버링 능력. 입력 누르는 동안 Hover 이동 모드 유지, 에너지 소모.
 // - 에너지가 0이 되면 자동으로 종료되고 과열 상태 적용.
 UCLASS()
 class PROJECT_MECHA_API UGA_Hover : public UGameplayAbility
@@ -64,7 +65,7 @@ public:
 
 	// ===== Movement =====
 
-	// Flying 모드 사용 여부.
+	// Flying 방식 사용 여부 (중력 없이 상승 보정). 끄면 GravityScaleWhileHover 중력만 적용.
 	UPROPERTY(EditDefaultsOnly, Category = "Hover|Movement")
 	bool bUseFlyingMode = true;
 
@@ -80,6 +81,10 @@ public:
 	UPROPERTY(EditDefaultsOnly, Category = "Hover|Movement")
 	float HoverLiftImpulse = 1800.f;
 
+	// 이 에너지 이하에서는 상승 보정 중단 (가속/최대 상승 속도는 UMechaMovementComponent).
+	UPROPERTY(EditDefaultsOnly, Category = "Hover|Movement")
+	float LiftMinEnergy = 1.f;
+
 	// ===== Energy =====
 
 	// 호버 시작에 필요한 최소 에너지.
@@ -128,6 +133,10 @@ public:
 	UPROPERTY(EditDefaultsOnly, Category = "Hover|Camera")
 	TSubclassOf<class UCameraShakeBase> HoverCameraShake;
 
+	// 카메라 연출 우선순위 (어설트 부스트보다 낮게).
+	UPROPERTY(EditDefaultsOnly, Category = "Hover|Camera")
+	int32 CameraBlendPriority = 0;
+
 protected:
 	// ===== Runtime Variables =====
 
@@ -143,29 +152,9 @@ protected:
 	// 에너지 변화 델리게이트 핸들.
 	FDelegateHandle EnergyChangedHandle;
 
-	// 호버 상승 보정 타이머 핸들.
-	FTimerHandle HoverAscendTimer;
-
-	// 호버 상승 보정 함수 (타이머에서 주기적 호출).
-	void ApplyHoverLift();
-
-	// 저장된 이동 설정 (호버 종료 시 복원).
-	float SavedGravityScale = 1.f;
-	float SavedBrakingFrictionFactor = 0.f;
-	float SavedGroundFriction = 0.f;
-
 	// ===== Camera State =====
-	float OriginalFOV = 90.f;
-	float OriginalCameraDistance = 400.f;
-	float CurrentFOV = 90.f;
-	float TargetFOV = 90.f;
-	float CurrentCameraDistance = 400.f;
-	float TargetCameraDistance = 400.f;
-
-	bool bIsRestoring = false;  // 복원 중인지 여부
-
-	FTimerHandle CameraUpdateTimer;
-	FTimerHandle CleanupTimer;  // Failsafe 타이머
+	// 카메라 블렌드 컴포넌트 요청 핸들
+	int32 CameraBlendHandle = INDEX_NONE;
 
 	// ===== Ability Overrides =====
 
@@ -191,10 +180,10 @@ protected:
 
 	// ===== Internal Functions =====
 
-	// 호버 시작: Flying 모드 전환, 상승 임펄스 적용.
+	// 호버 시작: 이동 컴포넌트 Hover 모드 전환, 상승 임펄스 적용.
 	void StartHover();
 
-	// 호버 중지: Falling 모드 복원, 이동 설정 복원.
+	// 호버 중지: Falling 모드 전환, 종료 중력 적용.
 	void StopHover(bool bFromEnergyDepleted);
 
 	// 에너지가 충분한지 확인.
@@ -206,14 +195,10 @@ protected:
 	// 에너지 소모 GE 제거.
 	void RemoveDrainGE();
 
-	// 카메라 효과 적용.
+	// 카메라 효과 적용 (카메라 블렌드 요청 추가).
 	void ApplyCameraEffects();
 
-	// 카메라 효과 복원.
+	// 카메라 효과 복원 (카메라 블렌드 요청 제거).
 	void RestoreCameraEffects();
 
-	// 카메라 부드러운 업데이트 (매 프레임 호출).
-	UFUNCTION()
-	void UpdateCameraSmooth();
-
 };
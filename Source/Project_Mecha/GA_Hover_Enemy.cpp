@@ -1,13 +1,21 @@
 #include "GA_Hover_Enemy.h"
+#include "MechaStats.h"
 #include "AbilitySystemComponent.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "TimerManager.h"
 #include "EnemyMecha.h"
 
+// ===== stat Mecha (능력별) =====
+DECLARE_CYCLE_STAT(TEXT("Hover_Enemy Activate"), STAT_Mecha_Hover_Enemy_Activate, STATGROUP_Mecha);
+DECLARE_CYCLE_STAT(TEXT("Hover_Enemy End"), STAT_Mecha_Hover_Enemy_End, STATGROUP_Mecha);
+
 UGA_Hover_Enemy::UGA_Hover_Enemy()
 {
     InstancingPolicy = EGameplayAbilityInstancingPolicy::InstancedPerActor;
+
+    // AI 전용 능력: 서버에서만 실행
+    NetExecutionPolicy = EGameplayAbilityNetExecutionPolicy::ServerOnly;
 }
 
 void UGA_Hover_Enemy::ActivateAbility(
@@ -16,6 +24,8 @@ void UGA_Hover_Enemy::ActivateAbility(
     const FGameplayAbilityActivationInfo ActivationInfo,
     const FGameplayEventData* TriggerEventData)
 {
+    MECHA_ABILITY_SCOPE(STAT_Mecha_Hover_Enemy_Activate, Activate);
+
     if (!CommitAbility(Handle, ActorInfo, ActivationInfo))
     {
         EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
@@ -54,6 +64,8 @@ void UGA_Hover_Enemy::EndAbility(
     const FGameplayAbilityActivationInfo ActivationInfo,
     bool bReplicateEndAbility, bool bWasCancelled)
 {
+    MECHA_ABILITY_SCOPE(STAT_Mecha_Hover_Enemy_End, End);
+
     // 타이머 정리
     if (OwnerCharacter.IsValid())
     {
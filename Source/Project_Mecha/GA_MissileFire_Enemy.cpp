@@ -2,10 +2,15 @@
 // 적 메카 미사일 발사 능력 - 애니메이션 몽타주만 재생
 
 #include "GA_MissileFire_Enemy.h"
+#include "MechaStats.h"
+#include "MechaNativeTags.h"
 #include "EnemyMecha.h"
 #include "AbilitySystemComponent.h"
 #include "GameplayTagContainer.h"
 
+// ===== stat Mecha (능력별) =====
+DECLARE_CYCLE_STAT(TEXT("MissileFire_Enemy Activate"), STAT_Mecha_MissileFire_Enemy_Activate, STATGROUP_Mecha);
+
 // ========================================
 // 생성자
 // ========================================
@@ -14,8 +19,11 @@ UGA_MissileFire_Enemy::UGA_MissileFire_Enemy()
 	// 액터마다 하나의 인스턴스만 생성
 	InstancingPolicy = EGameplayAbilityInstancingPolicy::InstancedPerActor;
 
+	// AI 전용 능력: 서버에서만 실행
+	NetExecutionPolicy = EGameplayAbilityNetExecutionPolicy::ServerOnly;
+
 	// Enemy 미사일 발사 태그 추가
-	AbilityTags.AddTag(FGameplayTag::RequestGameplayTag(TEXT("Ability.Missile.Enemy")));
+	AbilityTags.AddTag(MechaTags::Ability_Missile_Enemy);
 }
 
 // ========================================
@@ -27,6 +35,8 @@ void UGA_MissileFire_Enemy::ActivateAbility(
 	const FGameplayAbilityActivationInfo ActivationInfo,
 	const FGameplayEventData* TriggerEventData)
 {
+	MECHA_ABILITY_SCOPE(STAT_Mecha_MissileFire_Enemy_Activate, Activate);
+
 	// 코스트/쿨다운 체크
 	if (!CommitAbility(Handle, ActorInfo, ActivationInfo))
 	{
@@ -2,6 +2,7 @@
 // 미사일 순차 발사, 적 탐지, 유도 미사일 설정, 데미지 적용을 담당하는 Gameplay Ability
 
 #include "GA_MissleFire.h"
+#include "MechaStats.h"
 
 #include "GameFramework/Character.h"
 #include "GameFramework/ProjectileMovementComponent.h"
@@ -12,7 +13,18 @@
 #include "TimerManager.h"
 #include "Engine/World.h"
 #include "EnemyMecha.h"
+#include "MechaProjectilePoolSubsystem.h"
+#include "MechaPooledProjectileComponent.h"
+#include "MechaCombatRegistrySubsystem.h"
+#include "MechaNativeTags.h"
 #include "AbilitySystemComponent.h"
+#include "AbilitySystemBlueprintLibrary.h"
+#include "AbilitySystemGlobals.h"
+#include "MechaAttributeSet.h"
+
+// ===== stat Mecha (능력별) =====
+DECLARE_CYCLE_STAT(TEXT("MissleFire Activate"), STAT_Mecha_MissleFire_Activate, STATGROUP_Mecha);
+DECLARE_CYCLE_STAT(TEXT("MissleFire End"), STAT_Mecha_MissleFire_End, STATGROUP_Mecha);
 
 // ========================================
 // 생성자
@@ -23,12 +35,30 @@ UGA_MissleFire::UGA_MissleFire()
 	InstancingPolicy = EGameplayAbilityInstancingPolicy::InstancedPerActor;
 
 	// 쿨타임 태그 등록
-	Tag_CooldownMissile = FGameplayTag::RequestGameplayTag(TEXT("Cooldown.MissileFire"));
+	Tag_CooldownMissile = MechaTags::Cooldown_MissileFire;
 	
 	// 쿨타임 태그가 있으면 능력 발동 차단
 	ActivationBlockedTags.AddTag(Tag_CooldownMissile);
 }
 
+// ========================================
+// 능력 부여 - 미사일 풀 미리 채우기
+// ========================================
+void UGA_MissleFire::OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec)
+{
+	Super::OnGiveAbility(ActorInfo, Spec);
+
+	AActor* Avatar = ActorInfo ? ActorInfo->AvatarActor.Get() : nullptr;
+	if (!Avatar || !MissleProjectileClass) return;
+	if (bUseSimulatedMissiles && UMechaProjectileSimSubsystem::IsSimulationAllowed(Avatar)) return;
+
+	// 연속 두 번 발사까지는 스폰 없이 처리
+	if (UMechaProjectilePoolSubsystem* Pool = UMechaProjectilePoolSubsystem::Get(Avatar))
+	{
+		Pool->PrewarmPool(MissleProjectileClass, NumProjectiles * 2);
+	}
+}
+
 // ========================================
 // 능력 활성화 - 미사일 순차 발사 시작
 // ========================================
@@ -38,6 +68,8 @@ void UGA_MissleFire::ActivateAbility(
 	const FGameplayAbilityActivationInfo ActivationInfo,
 	const FGameplayEventData* TriggerEventData)
 {
+	MECHA_ABILITY_SCOPE(STAT_Mecha_MissleFire_Activate, Activate);
+
 	// 코스트/쿨다운 체크
 	if (!CommitAbility(Handle, ActorInfo, ActivationInfo))
 	{
@@ -46,12 +78,15 @@ void UGA_MissleFire::ActivateAbility(
 
 	// 오너 캐릭터 유효성 검사
 	ACharacter* OwnerChar = Cast<ACharacter>(ActorInfo ? ActorInfo->AvatarActor.Get() : nullptr);
-	if (!OwnerChar || !MissleProjectileClass)
+	if (!OwnerChar || (!MissleProjectileClass && !bUseSimulatedMissiles))
 	{
 		EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
 		return;
 	}
 
+	// 타겟 배정 (살보 전체에 대해 한 번만 조회)
+	PlanSalvo(OwnerChar);
+
 	// 첫 번째 미사일은 즉시 발사
 	SpawnMissle(0, OwnerChar);
 
@@ -102,14 +137,29 @@ void UGA_MissleFire::ActivateAbility(
 // ========================================
 void UGA_MissleFire::SpawnMissle(int32 Index, ACharacter* OwnerChar)
 {
+	SCOPE_CYCLE_COUNTER(STAT_Mecha_ProjectileSpawn);
+
 	// 유효성 검사
-	if (!OwnerChar || !MissleProjectileClass)
+	if (!OwnerChar || (!MissleProjectileClass && !bUseSimulatedMissiles))
 	{
 		return;
 	}
 
-	// 타겟 검색
-	AActor* Target = PickBestTarget(OwnerChar);
+	// 미사일은 서버만 스폰 (예측 클라이언트는 복제된 액터를 받음)
+	if (!OwnerChar->HasAuthority())
+	{
+		return;
+	}
+
+	// 시뮬레이션 투사체는 복제되지 않으므로 네트워크 세션에서는 풀 액터로 대체
+	const bool bUseSim = bUseSimulatedMissiles && UMechaProjectileSimSubsystem::IsSimulationAllowed(OwnerChar);
+	if (!bUseSim && !MissleProjectileClass)
+	{
+		return;
+	}
+
+	// 배정된 타겟 (발사 시작 시 PlanSalvo에서 결정)
+	AActor* Target = GetSalvoTarget(Index, OwnerChar);
 
 	FVector  SpawnLoc;
 	FRotator SpawnRot;
@@ -144,13 +194,26 @@ void UGA_MissleFire::SpawnMissle(int32 Index, ACharacter* OwnerChar)
 		SpawnRot.Pitch += FMath::RandRange(-SpreadAngle, SpreadAngle);
 	}
 
-	// ========== 미사일 스폰 ==========
-	FActorSpawnParameters Params;
-	Params.Owner = OwnerChar;
-	Params.Instigator = OwnerChar;
-	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+	// ========== 시뮬레이션 미사일 (액터 없음) ==========
+	if (bUseSim)
+	{
+		if (UMechaProjectileSimSubsystem* Sim = UMechaProjectileSimSubsystem::Get(OwnerChar))
+		{
+			FMechaSimDamageSpec DamageSpec;
+			DamageSpec.DamageEffect = GE_MissleDamage;
+			DamageSpec.SetByCallerTag = FMechaNativeTags::ResolveSetByCallerTag(SetByCallerDamageName);
+			DamageSpec.Damage = BaseDamage;
 
-	AActor* Missle = OwnerChar->GetWorld()->SpawnActor<AActor>(MissleProjectileClass, SpawnLoc, SpawnRot, Params);
+			Sim->SpawnProjectile(SimMissileArchetype, SpawnLoc, SpawnRot.Vector(), Target, OwnerChar, DamageSpec);
+		}
+		return;
+	}
+
+	// ========== 미사일 스폰 (풀에서 꺼내기) ==========
+	UMechaProjectilePoolSubsystem* Pool = UMechaProjectilePoolSubsystem::Get(OwnerChar);
+	if (!Pool) return;
+
+	AActor* Missle = Pool->AcquireProjectile(MissleProjectileClass, SpawnLoc, SpawnRot, OwnerChar, OwnerChar);
 
 	if (!Missle) return;
 
@@ -165,7 +228,7 @@ void UGA_MissleFire::SpawnMissle(int32 Index, ACharacter* OwnerChar)
 		MissilePrim->IgnoreActorWhenMoving(OwnerChar, true);
 		MissilePrim->MoveIgnoreActors.AddUnique(OwnerChar);
 		
-		// 오너의 모든 컴포넌트와 상호 무시 (양방향)
+		// 오너의 모든 컴포넌트와 상호 무시 (양방향, 오너 쪽은 풀 반납 시 해제)
 		TArray<UPrimitiveComponent*> OwnerPrims;
 		OwnerChar->GetComponents<UPrimitiveComponent>(OwnerPrims);
 		for (UPrimitiveComponent* OwnerPrim : OwnerPrims)
@@ -194,6 +257,15 @@ void UGA_MissleFire::SpawnMissle(int32 Index, ACharacter* OwnerChar)
 
 	// 데미지 설정
 	InitDamageOnMissle(Missle, OwnerChar);
+
+	// 승격 전 군중 개체는 충돌에 걸리지 않으므로 이동 구간 판정 + 착탄 범위 데미지
+	if (!OwnerChar->ActorHasTag(TEXT("Enemy")))
+	{
+		if (UMechaPooledProjectileComponent* PoolComp = Missle->FindComponentByClass<UMechaPooledProjectileComponent>())
+		{
+			PoolComp->SetCrowdDamage(BaseDamage, CrowdSplashRadius);
+		}
+	}
 }
 
 // ========================================
@@ -205,41 +277,131 @@ AActor* UGA_MissleFire::PickBestTarget(const AActor* Owner) const
 	UWorld* World = Owner->GetWorld();
 	if (!World) return nullptr;
 
+	UMechaCombatRegistrySubsystem* Registry = UMechaCombatRegistrySubsystem::Get(World);
+	if (!Registry) return nullptr;
+
 	const FVector OLoc = Owner->GetActorLocation();
 
-	// Enemy가 발사하는 경우 → 플레이어를 타겟으로
+	// Enemy가 발사하는 경우 → 가장 가까운 플레이어를 타겟으로
 	if (Owner->ActorHasTag(TEXT("Enemy")))
 	{
-		return UGameplayStatics::GetPlayerPawn(World, 0);
+		return Registry->FindNearest(EMechaCombatTeam::Player, OLoc);
 	}
 
-	// 플레이어가 발사하는 경우 → 가장 가까운 Enemy 찾기
-	// 성능 최적화: 특정 Enemy 클래스만 직접 검색 (모든 액터를 가져오지 않음)
-	TArray<AActor*> Candidates;
-	
-	// EnemyMecha 클래스로 검색
-	TArray<AActor*> EnemyMechas;
-	UGameplayStatics::GetAllActorsOfClass(World, AEnemyMecha::StaticClass(), EnemyMechas);
-	Candidates.Append(EnemyMechas);
-	
+	// 플레이어가 발사하는 경우 → 락온 거리 안의 가장 가까운 Enemy (등록부의 캐시 위치 사용)
+	return Registry->FindNearest(EMechaCombatTeam::Enemy, OLoc, MaxLockDistance, Owner);
+}
 
-	// 최단 거리의 적 선택
-	AActor* Best = nullptr;
-	const float MaxDistSq = MaxLockDistance * MaxLockDistance;
-	float BestDistSq = MaxDistSq;
+// ========================================
+// 살보 타겟 배정
+// ========================================
+void UGA_MissleFire::PlanSalvo(const AActor* Owner)
+{
+	SalvoTargets.Reset();
+	SalvoTargets.SetNum(FMath::Max(NumProjectiles, 0));
 
-	for (AActor* Candidate : Candidates)
+	if (!Owner || SalvoTargets.Num() == 0) return;
+
+	UMechaCombatRegistrySubsystem* Registry = UMechaCombatRegistrySubsystem::Get(Owner);
+	if (!Registry) return;
+
+	// Enemy가 발사하는 경우 → 모든 미사일이 플레이어를 노림
+	if (Owner->ActorHasTag(TEXT("Enemy")))
 	{
+		AActor* Player = PickBestTarget(Owner);
+		for (TWeakObjectPtr<AActor>& Slot : SalvoTargets)
+		{
+			Slot = Player;
+		}
+		return;
+	}
+
+	// ========== 후보: 가까운 적 최대 N명 (거리순) ==========
+	const int32 MaxTargets = (MaxSalvoTargets > 0) ? MaxSalvoTargets : NumProjectiles;
+
+	TArray<int32> Nearest;
+	Registry->QueryKNearestEntries(EMechaCombatTeam::Enemy, Owner->GetActorLocation(), MaxTargets, MaxLockDistance, Nearest, Owner);
+	if (Nearest.Num() == 0) return;
+
+	const TArray<FMechaCombatEntry>& Entries = Registry->GetEntries();
+
+	// ========== 타겟별 처치에 필요한 미사일 수 ==========
+	TArray<AActor*> Targets;
+	TArray<int32> MissilesNeeded;
+	for (const int32 EntryIndex : Nearest)
+	{
+		AActor* Candidate = Entries[EntryIndex].Actor.Get();
 		if (!Candidate) continue;
-		
-		const float DistSq = FVector::DistSquared(OLoc, Candidate->GetActorLocation());
-		if (DistSq < BestDistSq) 
-		{ 
-			BestDistSq = DistSq; 
-			Best = Candidate; 
+
+		float Health = BaseDamage;
+		if (const UAbilitySystemComponent* TargetASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(Candidate))
+		{
+			Health = TargetASC->GetNumericAttribute(UMechaAttributeSet::GetHealthAttribute());
+		}
+
+		Targets.Add(Candidate);
+		MissilesNeeded.Add(BaseDamage > 0.f ? FMath::Max(1, FMath::CeilToInt(Health / BaseDamage)) : 1);
+	}
+	if (Targets.Num() == 0) return;
+
+	// ========== 1차: 가까운 적부터 처치에 필요한 만큼만 배정 ==========
+	int32 Slot = 0;
+	for (int32 t = 0; t < Targets.Num() && Slot < SalvoTargets.Num(); ++t)
+	{
+		for (int32 n = 0; n < MissilesNeeded[t] && Slot < SalvoTargets.Num(); ++n)
+		{
+			SalvoTargets[Slot++] = Targets[t];
+		}
+	}
+
+	// ========== 2차: 남은 미사일은 가까운 적부터 돌아가며 추가 배정 ==========
+	for (int32 t = 0; Slot < SalvoTargets.Num(); t = (t + 1) % Targets.Num())
+	{
+		SalvoTargets[Slot++] = Targets[t];
+	}
+}
+
+AActor* UGA_MissleFire::GetSalvoTarget(int32 Index, const AActor* Owner) const
+{
+	if (SalvoTargets.IsValidIndex(Index))
+	{
+		AActor* Assigned = SalvoTargets[Index].Get();
+		if (!IsSalvoTargetGone(Assigned))
+		{
+			return Assigned;
 		}
+
+		// 배정된 타겟이 이미 죽음 → 같은 살보의 다른 살아 있는 타겟으로 (재조회 없음)
+		for (const TWeakObjectPtr<AActor>& Other : SalvoTargets)
+		{
+			if (!IsSalvoTargetGone(Other.Get()))
+			{
+				return Other.Get();
+			}
+		}
+	}
+
+	// 계획이 없으면 (노티파이 등 단독 호출) 한 번 조회
+	return SalvoTargets.Num() == 0 ? PickBestTarget(Owner) : nullptr;
+}
+
+bool UGA_MissleFire::IsSalvoTargetGone(const AActor* Target) const
+{
+	if (!IsValid(Target)) return true;
+
+	// 적은 사망 몽타주가 끝날 때까지 액터가 남아 있음
+	if (const AEnemyMecha* Enemy = Cast<AEnemyMecha>(Target))
+	{
+		if (Enemy->IsDead()) return true;
 	}
-	return Best;
+
+	if (const UAbilitySystemComponent* TargetASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Target))
+	{
+		if (TargetASC->HasMatchingGameplayTag(MechaTags::State_Dead)) return true;
+	}
+
+	const UMechaCombatRegistrySubsystem* Registry = UMechaCombatRegistrySubsystem::Get(Target);
+	return Registry && !Registry->IsRegistered(Target);
 }
 
 // ========================================
@@ -387,8 +549,11 @@ void UGA_MissleFire::EndAbility(
 	bool bReplicateEndAbility,
 	bool bWasCancelled)
 {
+	MECHA_ABILITY_SCOPE(STAT_Mecha_MissleFire_End, End);
+
 	// 모든 타이머 정리
 	ClearAllTimers();
+	SalvoTargets.Reset();
 
 	Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
 }
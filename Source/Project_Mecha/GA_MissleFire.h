@@ -1,7 +1,8 @@
 // GA_MissleFire.h
 // 설명:
 // - 미사일 발사 능력 클래스.
-// - 여러 발의 미사일을 순차적으로 발사하며, 자동으로 가장 가까운 적을 추적한다.
+// - 여러 발의 미사일을 순차적으로 발사하며, 발사 시작 시 가까운 적들에게
+//   남은 체력 기준으로 미사일을 나눠 배정한다 (한 적에게 과잉 집중 방지).
 // - ProjectileMovementComponent를 강제로 생성하여 유도 미사일 기능을 구현한다.
 
 #pragma once
@@ -9,6 +10,7 @@
 #include "CoreMinimal.h"
 #include "Abilities/GameplayAbility.h"
 #include "GameplayTagContainer.h"                // [Cooldown] 태그용
+#include "MechaProjectileSimSubsystem.h"
 #include "GA_MissleFire.generated.h"
 
 class UProjectileMovementComponent;
@@ -32,6 +34,11 @@ public:
         const FGameplayEventData* TriggerEventData
     ) override;
 
+    virtual void OnGiveAbility(
+        const FGameplayAbilityActorInfo* ActorInfo,
+        const FGameplayAbilitySpec& Spec
+    ) override;
+
     virtual void EndAbility(
         const FGameplayAbilitySpecHandle Handle,
         const FGameplayAbilityActorInfo* ActorInfo,
@@ -44,6 +51,16 @@ protected:
 
     void SpawnMissle(int32 Index, class ACharacter* OwnerChar);
     AActor* PickBestTarget(const AActor* Owner) const;
+
+    // 발사 시작 시 한 번만 조회해서 미사일별 타겟 배정 (SalvoTargets)
+    void PlanSalvo(const AActor* Owner);
+
+    // 배정된 타겟 (죽었으면 같은 살보의 다른 살아 있는 타겟)
+    AActor* GetSalvoTarget(int32 Index, const AActor* Owner) const;
+
+    // 제거됨 / 사망 (사망 몽타주 재생 중 포함) / 등록부에서 해제됨
+    bool IsSalvoTargetGone(const AActor* Target) const;
+
     void InitDamageOnMissle(AActor* Missle, AActor* Source) const;
     class UProjectileMovementComponent* ForceMakeMovableAndLaunch(class AActor* Missle, const FVector& LaunchDir) const;
 
@@ -104,6 +121,23 @@ protected:
     UPROPERTY(EditDefaultsOnly, Category = "Missle|Homing")
     float MaxLockDistance = 12000.f;
 
+    // 한 번의 발사로 나눠 노릴 최대 타겟 수 (0이면 미사일 수와 같음)
+    UPROPERTY(EditDefaultsOnly, Category = "Missle|Homing")
+    int32 MaxSalvoTargets = 0;
+
+    // 군중 개체에 닿거나 착탄한 지점 주변 승격 전 군중 개체에 BaseDamage를 주는 반경 (플레이어 미사일 액터만)
+    UPROPERTY(EditDefaultsOnly, Category = "Missle|Crowd")
+    float CrowdSplashRadius = 300.f;
+
+    // ================== [Sim] ==================
+    // true면 미사일 액터 대신 ProjectileSim 서브시스템의 일괄 시뮬레이션 투사체로 발사
+    UPROPERTY(EditDefaultsOnly, Category = "Missle|Sim")
+    bool bUseSimulatedMissiles = false;
+
+    // 시뮬레이션 미사일 외형/이동/유도 설정 (미사일마다 다시 설정하지 않음)
+    UPROPERTY(EditDefaultsOnly, Category = "Missle|Sim", meta = (EditCondition = "bUseSimulatedMissiles"))
+    FMechaSimProjectileArchetype SimMissileArchetype;
+
     // ================== [Cooldown] ==================
 
     // 쿨타임 태그
@@ -113,6 +147,10 @@ protected:
     UPROPERTY(EditDefaultsOnly, Category = "Cooldown")
     float CooldownDuration = 5.0f;
 
+    // ================== 살보 배정 ==================
+    // 미사일 인덱스별 타겟 (PlanSalvo에서 채움)
+    TArray<TWeakObjectPtr<AActor>> SalvoTargets;
+
     // ================== 타이머 핸들 관리 ==================
     // 미사일 발사 타이머 핸들들 (순차 발사용)
     TArray<FTimerHandle> MissileFireTimerHandles;
@@ -2,6 +2,7 @@
 // 장전 능력 - 예비탄에서 탄창으로 탄약 보충, 장전 중 발사 차단
 
 #include "GA_Reload.h"
+#include "MechaStats.h"
 #include "MechaAttributeSet.h"
 #include "AbilitySystemComponent.h"
 #include "Abilities/Tasks/AbilityTask_WaitDelay.h"
@@ -9,6 +10,10 @@
 #include "GameFramework/Character.h"
 #include "Animation/AnimInstance.h"
 
+// ===== stat Mecha (능력별) =====
+DECLARE_CYCLE_STAT(TEXT("Reload Activate"), STAT_Mecha_Reload_Activate, STATGROUP_Mecha);
+DECLARE_CYCLE_STAT(TEXT("Reload End"), STAT_Mecha_Reload_End, STATGROUP_Mecha);
+
 // ========================================
 // 생성자
 // ========================================
@@ -27,6 +32,8 @@ void UGA_Reload::ActivateAbility(
 	const FGameplayAbilityActivationInfo ActivationInfo,
 	const FGameplayEventData* TriggerEventData)
 {
+	MECHA_ABILITY_SCOPE(STAT_Mecha_Reload_Activate, Activate);
+
 	// 코스트/쿨다운 체크
 	if (!CommitAbility(Handle, ActorInfo, ActivationInfo))
 	{
@@ -121,6 +128,8 @@ void UGA_Reload::EndAbility(
 	const FGameplayAbilityActivationInfo ActivationInfo,
 	bool bReplicateEndAbility, bool bWasCancelled)
 {
+	MECHA_ABILITY_SCOPE(STAT_Mecha_Reload_End, End);
+
 	// 안전을 위해 태그 제거 (중복 제거해도 문제없음)
 	if (UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo())
 	{
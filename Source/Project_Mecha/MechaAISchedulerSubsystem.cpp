@@ -0,0 +1,209 @@
+// MechaAISchedulerSubsystem.cpp
+// 적 AI BT 시분할 - 프레임 예산 안에서 우선순위/라운드 로빈 순으로 BT 틱, 비용과 미룬 수 집계
+
+#include "MechaAISchedulerSubsystem.h"
+#include "MechaBehaviorTreeComponent.h"
+#include "MechaStats.h"
+#include "EnemyMecha.h"
+#include "Project_Mecha.h"
+
+#include "AIController.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("AI Scheduler"), STAT_Mecha_AIScheduler, STATGROUP_Mecha);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("AI Scheduler Cost (ms)"), STAT_Mecha_AISchedulerCostMs, STATGROUP_Mecha);
+DECLARE_DWORD_COUNTER_STAT(TEXT("AI BT Ticked"), STAT_Mecha_AIBTTicked, STATGROUP_Mecha);
+DECLARE_DWORD_COUNTER_STAT(TEXT("AI BT Deferred"), STAT_Mecha_AIBTDeferred, STATGROUP_Mecha);
+
+static TAutoConsoleVariable<int32> CVarMechaAIScheduler(
+	TEXT("Mecha.AI.Scheduler"),
+	1,
+	TEXT("1이면 적 BT 틱을 프레임 예산 안에서 시분할합니다. 0이면 각 BT가 엔진 틱에서 바로 실행됩니다."));
+
+// 콘솔 명령: 직전 프레임 / 최대 비용 출력
+static FAutoConsoleCommandWithWorld GMechaAISchedulerDumpCmd(
+	TEXT("Mecha.AI.SchedulerDump"),
+	TEXT("AI 스케줄러의 직전 프레임 비용, 실행/미룬 BT 수, 최대 비용을 출력합니다."),
+	FConsoleCommandWithWorldDelegate::CreateStatic([](UWorld* World)
+		{
+			if (const UMechaAISchedulerSubsystem* Scheduler = UMechaAISchedulerSubsystem::Get(World))
+			{
+				Scheduler->DumpStats();
+			}
+		}));
+
+namespace MechaAIScheduler
+{
+	// 낮을수록 먼저
+	enum ETier : uint8
+	{
+		Tier_Melee,
+		Tier_Ranged,
+		Tier_High,
+		Tier_Medium,
+		Tier_Low,
+		Tier_Off
+	};
+}
+
+// ========================================
+// 접근자
+// ========================================
+UMechaAISchedulerSubsystem* UMechaAISchedulerSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine || !WorldContextObject) return nullptr;
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UMechaAISchedulerSubsystem>() : nullptr;
+}
+
+bool UMechaAISchedulerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UMechaAISchedulerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMechaAISchedulerSubsystem, STATGROUP_Tickables);
+}
+
+void UMechaAISchedulerSubsystem::Deinitialize()
+{
+	Queue.Empty();
+	Work.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UMechaAISchedulerSubsystem::IsEnabled() const
+{
+	return CVarMechaAIScheduler.GetValueOnGameThread() != 0;
+}
+
+void UMechaAISchedulerSubsystem::EnqueueTick(UMechaBehaviorTreeComponent* BehaviorTree)
+{
+	if (BehaviorTree)
+	{
+		Queue.Add(BehaviorTree);
+	}
+}
+
+// ========================================
+// 매 프레임 - 우선순위 정렬 후 예산 안에서 실행
+// ========================================
+void UMechaAISchedulerSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Mecha_AIScheduler);
+
+	Super::Tick(DeltaTime);
+
+	// ========== 대기열 → 작업 목록 (사라진 컴포넌트 제외) ==========
+	Work.Reset();
+	for (const TWeakObjectPtr<UMechaBehaviorTreeComponent>& Weak : Queue)
+	{
+		UMechaBehaviorTreeComponent* BehaviorTree = Weak.Get();
+		if (BehaviorTree && BehaviorTree->HasPendingTick())
+		{
+			Work.Add({ BehaviorTree, GetPriorityTier(BehaviorTree) });
+		}
+	}
+	Queue.Reset();
+
+	// 단계 순, 같은 단계는 오래 밀린 순 (라운드 로빈)
+	Work.Sort([](const FScheduledTick& A, const FScheduledTick& B)
+		{
+			if (A.Tier != B.Tier) return A.Tier < B.Tier;
+			return A.BehaviorTree->DeferredFrames > B.BehaviorTree->DeferredFrames;
+		});
+
+	// ========== 예산 안에서 실행 ==========
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	const uint64 BudgetCycles = (uint64)(FrameBudgetMs / (FPlatformTime::GetSecondsPerCycle64() * 1000.0));
+
+	int32 Ticked = 0;
+	int32 Deferred = 0;
+
+	for (const FScheduledTick& Scheduled : Work)
+	{
+		UMechaBehaviorTreeComponent* BehaviorTree = Scheduled.BehaviorTree;
+
+		// 앞선 BT 틱에서 적이 파괴됐을 수 있음
+		if (!IsValid(BehaviorTree))
+		{
+			continue;
+		}
+
+		const bool bMustRun = Scheduled.Tier == MechaAIScheduler::Tier_Melee
+			|| BehaviorTree->DeferredFrames >= MaxDeferredFrames;
+
+		if (!bMustRun && FPlatformTime::Cycles64() - StartCycles >= BudgetCycles)
+		{
+			++BehaviorTree->DeferredFrames;
+			Queue.Add(BehaviorTree);
+			++Deferred;
+			continue;
+		}
+
+		BehaviorTree->RunScheduledTick();
+		++Ticked;
+	}
+	Work.Reset();
+
+	// ========== 계측 ==========
+	LastFrameCostMs = (float)FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+	LastFrameTicked = Ticked;
+	LastFrameDeferred = Deferred;
+	PeakFrameCostMs = FMath::Max(PeakFrameCostMs, LastFrameCostMs);
+
+	SET_FLOAT_STAT(STAT_Mecha_AISchedulerCostMs, LastFrameCostMs);
+	SET_DWORD_STAT(STAT_Mecha_AIBTTicked, Ticked);
+	SET_DWORD_STAT(STAT_Mecha_AIBTDeferred, Deferred);
+}
+
+// ========================================
+// 내부 - 우선순위 단계
+// ========================================
+uint8 UMechaAISchedulerSubsystem::GetPriorityTier(const UMechaBehaviorTreeComponent* BehaviorTree) const
+{
+	using namespace MechaAIScheduler;
+
+	const AAIController* AIOwner = BehaviorTree->GetAIOwner();
+	const AEnemyMecha* Enemy = AIOwner ? Cast<AEnemyMecha>(AIOwner->GetPawn()) : nullptr;
+	if (!Enemy)
+	{
+		return Tier_High;
+	}
+
+	// 타겟이 사거리 안이면 교전 중
+	if (const AActor* Target = Enemy->CurrentTarget; IsValid(Target))
+	{
+		const float DistSq = FVector::DistSquared(Enemy->GetActorLocation(), Target->GetActorLocation());
+		if (DistSq <= FMath::Square(Enemy->GetMeleeRange()))
+		{
+			return Tier_Melee;
+		}
+		if (DistSq <= FMath::Square(Enemy->GetRangedRange()))
+		{
+			return Tier_Ranged;
+		}
+	}
+
+	switch (Enemy->GetSignificance())
+	{
+	case EMechaSignificance::High:   return Tier_High;
+	case EMechaSignificance::Medium: return Tier_Medium;
+	case EMechaSignificance::Low:    return Tier_Low;
+	default:                         return Tier_Off;
+	}
+}
+
+// ========================================
+// 통계
+// ========================================
+void UMechaAISchedulerSubsystem::DumpStats() const
+{
+	UE_LOG(LogMecha, Log, TEXT("[AIScheduler] Budget=%.2fms Last=%.3fms Peak=%.3fms Ticked=%d Deferred=%d Enabled=%d"),
+		FrameBudgetMs, LastFrameCostMs, PeakFrameCostMs, LastFrameTicked, LastFrameDeferred, IsEnabled() ? 1 : 0);
+}
@@ -0,0 +1,76 @@
+// MechaAISchedulerSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+// 설명:
+// - 적 AI BT 시분할 스케줄러. UMechaBehaviorTreeComponent가 엔진 틱마다 대기열에 올라오고,
+//   매 프레임 FrameBudgetMs(전체 AI 합계) 안에서 우선순위 순서로 BT를 틱합니다. 예산을 넘으면 다음 프레임으로 미룹니다.
+// - 우선순위: 근접 사거리 안 > 원거리 사거리 안 > 중요도 High > Medium > Low > Off, 같은 단계는 오래 밀린 순서(라운드 로빈).
+//   근접 사거리 안의 적과 MaxDeferredFrames 이상 밀린 적은 예산과 상관없이 실행합니다.
+// - 웨이브 스폰 직후처럼 BT가 한꺼번에 시작해도 프레임당 비용이 예산 근처로 유지됩니다.
+// - 계측: stat Mecha (AI Scheduler Cost / BT Ticked / BT Deferred), 콘솔 Mecha.AI.SchedulerDump
+//   Mecha.AI.Scheduler 0이면 끔 (각 BT가 엔진 틱에서 바로 실행).
+#include "MechaAISchedulerSubsystem.generated.h"
+
+class UMechaBehaviorTreeComponent;
+
+UCLASS(Config = Game)
+class PROJECT_MECHA_API UMechaAISchedulerSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    static UMechaAISchedulerSubsystem* Get(const UObject* WorldContextObject);
+
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    bool IsEnabled() const;
+
+    // BT 컴포넌트가 이번 프레임 틱을 요청 (중복 등록은 컴포넌트가 막음)
+    void EnqueueTick(UMechaBehaviorTreeComponent* BehaviorTree);
+
+    // ===== 직전 프레임 결과 =====
+    UFUNCTION(BlueprintPure, Category = "Mecha|AI")
+    float GetLastFrameCostMs() const { return LastFrameCostMs; }
+
+    UFUNCTION(BlueprintPure, Category = "Mecha|AI")
+    int32 GetLastFrameTicked() const { return LastFrameTicked; }
+
+    UFUNCTION(BlueprintPure, Category = "Mecha|AI")
+    int32 GetLastFrameDeferred() const { return LastFrameDeferred; }
+
+    void DumpStats() const;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+    // 프레임당 전체 BT 틱 예산 (ms)
+    UPROPERTY(Config)
+    float FrameBudgetMs = 1.5f;
+
+    // 이 프레임 수 이상 밀리면 예산과 상관없이 실행
+    UPROPERTY(Config)
+    int32 MaxDeferredFrames = 4;
+
+private:
+    struct FScheduledTick
+    {
+        UMechaBehaviorTreeComponent* BehaviorTree = nullptr;
+        uint8 Tier = 0;
+    };
+
+    TArray<TWeakObjectPtr<UMechaBehaviorTreeComponent>> Queue;
+    TArray<FScheduledTick> Work;
+
+    float LastFrameCostMs = 0.f;
+    int32 LastFrameTicked = 0;
+    int32 LastFrameDeferred = 0;
+
+    // 최대 비용 (Dump용)
+    float PeakFrameCostMs = 0.f;
+
+    uint8 GetPriorityTier(const UMechaBehaviorTreeComponent* BehaviorTree) const;
+};
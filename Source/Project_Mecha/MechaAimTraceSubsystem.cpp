@@ -0,0 +1,211 @@
+// MechaAimTraceSubsystem.cpp
+// 사격 조준점 공유 - 프레임당 1회 캐시, 비동기 라인 트레이스 (다음 프레임 결과 사용)
+
+#include "MechaAimTraceSubsystem.h"
+#include "MechaStats.h"
+
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+// 비동기 조준 트레이스 사용 여부
+static TAutoConsoleVariable<int32> CVarMechaAimAsyncTrace(
+	TEXT("Mecha.Aim.AsyncTrace"),
+	1,
+	TEXT("1이면 조준점 라인 트레이스를 비동기로 처리하고 다음 프레임 결과를 사용합니다. 0이면 프레임당 1회 동기 트레이스."));
+
+namespace MechaAimTrace
+{
+	// 마지막 사격 후 이 시간이 지나면 사수 상태 정리
+	static constexpr double ActiveWindowSeconds = 1.0;
+
+	// 마지막 조준점 요청이 이 프레임 수 이내일 때만 다음 프레임용 비동기 트레이스 예약
+	static constexpr uint64 AsyncRequestFrames = 1;
+
+	// 이 프레임 수보다 오래된 비동기 결과는 사용하지 않음
+	static constexpr uint64 MaxResultAgeFrames = 2;
+}
+
+// ========================================
+// 접근자 / 수명
+// ========================================
+UMechaAimTraceSubsystem* UMechaAimTraceSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine || !WorldContextObject) return nullptr;
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UMechaAimTraceSubsystem>() : nullptr;
+}
+
+bool UMechaAimTraceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UMechaAimTraceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMechaAimTraceSubsystem, STATGROUP_Tickables);
+}
+
+void UMechaAimTraceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	AimTraceDelegate.BindUObject(this, &UMechaAimTraceSubsystem::HandleAimTraceDone);
+}
+
+void UMechaAimTraceSubsystem::Deinitialize()
+{
+	AimTraceDelegate.Unbind();
+	AimStates.Empty();
+
+	Super::Deinitialize();
+}
+
+// ========================================
+// 조준점 요청 (사격 시 호출)
+// ========================================
+FVector UMechaAimTraceSubsystem::GetAimPoint(AActor* Shooter, float TraceDistance)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Mecha_AimQuery);
+
+	if (!Shooter) return FVector::ZeroVector;
+
+	UWorld* World = GetWorld();
+	if (!World) return Shooter->GetActorLocation() + Shooter->GetActorForwardVector() * TraceDistance;
+
+	FAimState& State = AimStates.FindOrAdd(Shooter->GetUniqueID());
+	State.Shooter = Shooter;
+	State.TraceDistance = TraceDistance;
+	State.LastRequestTime = World->GetTimeSeconds();
+
+	// ========== 같은 프레임이면 캐시 공유 ==========
+	if (State.CachedFrame == GFrameCounter)
+	{
+		return State.CachedAimPoint;
+	}
+
+	FVector ViewLoc, ViewDir;
+	if (!GetShooterView(Shooter, ViewLoc, ViewDir))
+	{
+		return Shooter->GetActorLocation() + Shooter->GetActorForwardVector() * TraceDistance;
+	}
+
+	// ========== 비동기 결과가 최신이면 사용, 아니면 이번만 동기 트레이스 ==========
+	const bool bAsync = CVarMechaAimAsyncTrace.GetValueOnGameThread() != 0;
+	const bool bHasFreshResult = State.ResultFrame != 0 && State.ResultFrame + MechaAimTrace::MaxResultAgeFrames >= GFrameCounter;
+
+	State.CachedAimPoint = (bAsync && bHasFreshResult)
+		? State.ResultAimPoint
+		: TraceAimPointSync(Shooter, ViewLoc, ViewDir, TraceDistance);
+	State.CachedFrame = GFrameCounter;
+
+	return State.CachedAimPoint;
+}
+
+// ========================================
+// 매 프레임 - 연사 중인 사수들의 비동기 트레이스 예약
+// ========================================
+void UMechaAimTraceSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (AimStates.Num() == 0) return;
+
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	const bool bAsync = CVarMechaAimAsyncTrace.GetValueOnGameThread() != 0;
+	const double Now = World->GetTimeSeconds();
+
+	for (auto It = AimStates.CreateIterator(); It; ++It)
+	{
+		FAimState& State = It.Value();
+		AActor* Shooter = State.Shooter.Get();
+
+		// 사라졌거나 한동안 사격하지 않은 사수는 정리
+		if (!Shooter || Now - State.LastRequestTime > MechaAimTrace::ActiveWindowSeconds)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		if (!bAsync) continue;
+
+		// 이번/직전 프레임에 조준점을 요청한 사수만 (쉬는 사수는 다음 사격 때 동기 트레이스)
+		if (State.CachedFrame + MechaAimTrace::AsyncRequestFrames < GFrameCounter) continue;
+
+		FVector ViewLoc, ViewDir;
+		if (!GetShooterView(Shooter, ViewLoc, ViewDir)) continue;
+
+		FCollisionQueryParams Params(SCENE_QUERY_STAT(MechaAimTraceAsync), false, Shooter);
+
+		// 결과는 다음 프레임 시작 시 HandleAimTraceDone으로 전달됨
+		World->AsyncLineTraceByChannel(
+			EAsyncTraceType::Single,
+			ViewLoc,
+			ViewLoc + ViewDir * State.TraceDistance,
+			ECC_Visibility,
+			Params,
+			FCollisionResponseParams::DefaultResponseParam,
+			&AimTraceDelegate,
+			It.Key()
+		);
+	}
+}
+
+// ========================================
+// 비동기 트레이스 완료 콜백
+// ========================================
+void UMechaAimTraceSubsystem::HandleAimTraceDone(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	FAimState* State = AimStates.Find(Datum.UserData);
+	if (!State) return;
+
+	// 무언가 맞으면 그 지점, 안 맞으면 트레이스 끝점
+	const FHitResult* BlockingHit = Datum.OutHits.FindByPredicate([](const FHitResult& Hit) { return Hit.bBlockingHit; });
+	State->ResultAimPoint = BlockingHit ? FVector(BlockingHit->ImpactPoint) : FVector(Datum.End);
+	State->ResultFrame = GFrameCounter;
+}
+
+// ========================================
+// 사수 시점 (플레이어: 화면 중앙 / 그 외: 눈 위치)
+// ========================================
+bool UMechaAimTraceSubsystem::GetShooterView(AActor* Shooter, FVector& OutLocation, FVector& OutDirection) const
+{
+	const APawn* Pawn = Cast<APawn>(Shooter);
+	APlayerController* PC = Pawn ? Cast<APlayerController>(Pawn->GetController()) : nullptr;
+
+	if (PC && PC->IsLocalController())
+	{
+		int32 ViewX, ViewY;
+		PC->GetViewportSize(ViewX, ViewY);
+
+		// 화면 중앙 좌표
+		return PC->DeprojectScreenPositionToWorld(ViewX / 2.0f, ViewY / 2.0f, OutLocation, OutDirection);
+	}
+
+	FRotator ViewRot;
+	Shooter->GetActorEyesViewPoint(OutLocation, ViewRot);
+	OutDirection = ViewRot.Vector();
+	return true;
+}
+
+// ========================================
+// 동기 트레이스 (비동기 결과가 없을 때 / 비동기 비활성화 시)
+// ========================================
+FVector UMechaAimTraceSubsystem::TraceAimPointSync(AActor* Shooter, const FVector& ViewLocation, const FVector& ViewDirection, float TraceDistance) const
+{
+	const FVector TraceEnd = ViewLocation + ViewDirection * TraceDistance;
+
+	FHitResult Hit;
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(MechaAimTraceSync), false, Shooter);
+
+	if (GetWorld()->LineTraceSingleByChannel(Hit, ViewLocation, TraceEnd, ECC_Visibility, Params))
+	{
+		return Hit.ImpactPoint;
+	}
+	return TraceEnd;
+}
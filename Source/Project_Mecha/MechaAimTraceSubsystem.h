@@ -0,0 +1,62 @@
+// MechaAimTraceSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+// 설명:
+// - 사격 조준점(화면 중앙 크로스헤어 → 월드) 계산을 공유하는 서브시스템.
+// - 조준점은 사수별로 프레임당 1회만 계산되어 같은 프레임의 모든 사격이 공유합니다.
+// - 비동기 모드(Mecha.Aim.AsyncTrace=1)에서는 이번 또는 직전 프레임에 조준점을 요청한(연사 중인) 사수만
+//   AsyncLineTraceByChannel을 걸어 두고, 다음 프레임에 도착한 결과를 사용합니다.
+//   (결과가 아직 없으면 - 첫 발이나 사격 간격이 긴 무기 - 그 한 번만 동기 트레이스)
+// - 플레이어는 뷰포트 중앙, AI 등 로컬 플레이어가 아닌 사수는 눈 위치 시점 기준.
+#include "MechaAimTraceSubsystem.generated.h"
+
+UCLASS()
+class PROJECT_MECHA_API UMechaAimTraceSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    static UMechaAimTraceSubsystem* Get(const UObject* WorldContextObject);
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // 사수의 현재 조준점 (이번 프레임에 이미 계산했으면 캐시 반환)
+    UFUNCTION(BlueprintCallable, Category = "Mecha|Aim")
+    FVector GetAimPoint(AActor* Shooter, float TraceDistance = 10000.f);
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    struct FAimState
+    {
+        TWeakObjectPtr<AActor> Shooter;
+        float TraceDistance = 10000.f;
+
+        // 마지막 사격 요청 시각 (일정 시간 사격이 없으면 상태 정리)
+        double LastRequestTime = 0.0;
+
+        // 이번 프레임 캐시
+        uint64 CachedFrame = 0;
+        FVector CachedAimPoint = FVector::ZeroVector;
+
+        // 가장 최근 도착한 비동기 결과
+        uint64 ResultFrame = 0;
+        FVector ResultAimPoint = FVector::ZeroVector;
+    };
+
+    // 키: 사수 UniqueID (비동기 트레이스 UserData로도 사용)
+    TMap<uint32, FAimState> AimStates;
+
+    FTraceDelegate AimTraceDelegate;
+
+    bool GetShooterView(AActor* Shooter, FVector& OutLocation, FVector& OutDirection) const;
+    FVector TraceAimPointSync(AActor* Shooter, const FVector& ViewLocation, const FVector& ViewDirection, float TraceDistance) const;
+    void HandleAimTraceDone(const FTraceHandle& Handle, FTraceDatum& Datum);
+};
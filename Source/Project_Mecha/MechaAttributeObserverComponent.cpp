@@ -0,0 +1,151 @@
+// MechaAttributeObserverComponent.cpp
+// HUD용 Attribute 관찰 - 변경 항목 표시 후 프레임당 한 번 스냅샷 방송
+
+#include "MechaAttributeObserverComponent.h"
+#include "MechaAttributeSet.h"
+#include "MechaStats.h"
+#include "MechaUIUpdateSubsystem.h"
+
+#include "AbilitySystemComponent.h"
+#include "GameplayEffectTypes.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Observed Attribute Changes"), STAT_Mecha_ObservedAttributeChanges, STATGROUP_Mecha);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Attribute Snapshots Flushed"), STAT_Mecha_AttributeSnapshotsFlushed, STATGROUP_Mecha);
+
+// ========================================
+// 생성자 / EndPlay
+// ========================================
+UMechaAttributeObserverComponent::UMechaAttributeObserverComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UMechaAttributeObserverComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	StopObserving();
+	OnAttributesFlushedNative.Clear();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+// ========================================
+// 바인딩 / 해제
+// ========================================
+FGameplayAttribute UMechaAttributeObserverComponent::GetAttribute(EMechaObservedAttribute Attribute)
+{
+	switch (Attribute)
+	{
+	case EMechaObservedAttribute::Health:       return UMechaAttributeSet::GetHealthAttribute();
+	case EMechaObservedAttribute::MaxHealth:    return UMechaAttributeSet::GetMaxHealthAttribute();
+	case EMechaObservedAttribute::Energy:       return UMechaAttributeSet::GetEnergyAttribute();
+	case EMechaObservedAttribute::MaxEnergy:    return UMechaAttributeSet::GetMaxEnergyAttribute();
+	case EMechaObservedAttribute::AmmoMagazine: return UMechaAttributeSet::GetAmmoMagazineAttribute();
+	case EMechaObservedAttribute::MaxMagazine:  return UMechaAttributeSet::GetMaxMagazineAttribute();
+	case EMechaObservedAttribute::AmmoReserve:  return UMechaAttributeSet::GetAmmoReserveAttribute();
+	default:                                    return FGameplayAttribute();
+	}
+}
+
+void UMechaAttributeObserverComponent::Observe(UAbilitySystemComponent* InASC)
+{
+	if (ObservedASC.Get() == InASC) return;
+
+	StopObserving();
+
+	ObservedASC = InASC;
+	if (!InASC) return;
+
+	for (int32 i = 0; i < (int32)EMechaObservedAttribute::Num; ++i)
+	{
+		const EMechaObservedAttribute Attribute = (EMechaObservedAttribute)i;
+		Handles[i] = InASC->GetGameplayAttributeValueChangeDelegate(GetAttribute(Attribute))
+			.AddUObject(this, &UMechaAttributeObserverComponent::OnAttributeChanged, Attribute);
+	}
+}
+
+void UMechaAttributeObserverComponent::StopObserving()
+{
+	if (UAbilitySystemComponent* OldASC = ObservedASC.Get())
+	{
+		for (int32 i = 0; i < (int32)EMechaObservedAttribute::Num; ++i)
+		{
+			OldASC->GetGameplayAttributeValueChangeDelegate(GetAttribute((EMechaObservedAttribute)i)).Remove(Handles[i]);
+		}
+	}
+
+	for (FDelegateHandle& Handle : Handles)
+	{
+		Handle.Reset();
+	}
+
+	ObservedASC.Reset();
+	PendingDirtyMask = 0;
+	PendingDamage = 0.f;
+}
+
+// ========================================
+// 스냅샷
+// ========================================
+FMechaAttributeSnapshot UMechaAttributeObserverComponent::ReadSnapshot() const
+{
+	FMechaAttributeSnapshot Snapshot;
+
+	const UAbilitySystemComponent* ASC = ObservedASC.Get();
+	if (!ASC) return Snapshot;
+
+	Snapshot.Health = ASC->GetNumericAttribute(UMechaAttributeSet::GetHealthAttribute());
+	Snapshot.MaxHealth = ASC->GetNumericAttribute(UMechaAttributeSet::GetMaxHealthAttribute());
+	Snapshot.Energy = ASC->GetNumericAttribute(UMechaAttributeSet::GetEnergyAttribute());
+	Snapshot.MaxEnergy = ASC->GetNumericAttribute(UMechaAttributeSet::GetMaxEnergyAttribute());
+	Snapshot.AmmoMagazine = FMath::RoundToInt(ASC->GetNumericAttribute(UMechaAttributeSet::GetAmmoMagazineAttribute()));
+	Snapshot.MaxMagazine = FMath::RoundToInt(ASC->GetNumericAttribute(UMechaAttributeSet::GetMaxMagazineAttribute()));
+	Snapshot.AmmoReserve = FMath::RoundToInt(ASC->GetNumericAttribute(UMechaAttributeSet::GetAmmoReserveAttribute()));
+	Snapshot.DirtyMask = (1 << (int32)EMechaObservedAttribute::Num) - 1;
+
+	return Snapshot;
+}
+
+// ========================================
+// 변경 표시 → 프레임 끝에 한 번 방송
+// ========================================
+void UMechaAttributeObserverComponent::OnAttributeChanged(const FOnAttributeChangeData& Data, EMechaObservedAttribute Attribute)
+{
+	// 받을 위젯이 없으면 아무것도 안 함
+	if (!OnAttributesFlushedNative.IsBound() && !OnAttributesFlushed.IsBound())
+	{
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_Mecha_ObservedAttributeChanges);
+
+	if (Attribute == EMechaObservedAttribute::Health && Data.NewValue < Data.OldValue)
+	{
+		PendingDamage += Data.OldValue - Data.NewValue;
+	}
+
+	const bool bAlreadyPending = PendingDirtyMask != 0;
+	PendingDirtyMask |= 1 << (int32)Attribute;
+
+	if (!bAlreadyPending)
+	{
+		UMechaUIUpdateSubsystem::Schedule(this, [this]() { Flush(); });
+	}
+}
+
+void UMechaAttributeObserverComponent::Flush()
+{
+	if (PendingDirtyMask == 0) return;
+
+	FMechaAttributeSnapshot Snapshot = ReadSnapshot();
+	Snapshot.DirtyMask = PendingDirtyMask;
+	Snapshot.DamageTaken = PendingDamage;
+
+	// 방송 중 변경은 다음 프레임으로
+	PendingDirtyMask = 0;
+	PendingDamage = 0.f;
+
+	INC_DWORD_STAT(STAT_Mecha_AttributeSnapshotsFlushed);
+
+	OnAttributesFlushedNative.Broadcast(Snapshot);
+	OnAttributesFlushed.Broadcast(Snapshot);
+}
@@ -0,0 +1,126 @@
+// MechaAttributeObserverComponent.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "AttributeSet.h"
+// 설명:
+// - HUD용 Attribute 관찰 컴포넌트. Attribute 변경 델리게이트는 수정 한 번마다 바로 불리므로
+//   (재장전의 탄창+예비탄, 다단히트 등) 위젯이 각각 바인딩하면 한 프레임에 같은 UI를 여러 번 다시 그립니다.
+// - 이 컴포넌트가 관찰 대상 Attribute의 델리게이트를 대신 받아 변경된 항목만 표시(DirtyMask)해 두고,
+//   UMechaUIUpdateSubsystem으로 프레임 끝에 한 번 스냅샷을 만들어 방송합니다.
+// - 위젯은 OnAttributesFlushed(네이티브/BP)를 구독하고 스냅샷의 DirtyMask로 바뀐 부분만 갱신합니다.
+// - 체력 감소량은 프레임 동안 합산해서 DamageTaken으로 전달합니다 (피격 연출 1회).
+// - 구독자가 없으면(서버/다른 클라이언트의 프록시) 표시/예약 없이 바로 반환합니다.
+// - 사망 판정처럼 즉시 처리해야 하는 게임플레이 로직은 기존처럼 ASC 델리게이트를 직접 씁니다.
+#include "MechaAttributeObserverComponent.generated.h"
+
+class UAbilitySystemComponent;
+struct FOnAttributeChangeData;
+
+// 관찰 대상 Attribute (DirtyMask의 비트 번호)
+UENUM(BlueprintType)
+enum class EMechaObservedAttribute : uint8
+{
+    Health,
+    MaxHealth,
+    Energy,
+    MaxEnergy,
+    AmmoMagazine,
+    MaxMagazine,
+    AmmoReserve,
+    Num UMETA(Hidden)
+};
+
+// 프레임당 한 번 전달되는 Attribute 값 묶음
+USTRUCT(BlueprintType)
+struct FMechaAttributeSnapshot
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Mecha|Attributes")
+    float Health = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Mecha|Attributes")
+    float MaxHealth = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Mecha|Attributes")
+    float Energy = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Mecha|Attributes")
+    float MaxEnergy = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Mecha|Attributes")
+    int32 AmmoMagazine = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Mecha|Attributes")
+    int32 MaxMagazine = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Mecha|Attributes")
+    int32 AmmoReserve = 0;
+
+    // 지난 방송 이후 체력 감소량 합계
+    UPROPERTY(BlueprintReadOnly, Category = "Mecha|Attributes")
+    float DamageTaken = 0.f;
+
+    // 지난 방송 이후 바뀐 항목 (1 << EMechaObservedAttribute)
+    UPROPERTY(BlueprintReadOnly, Category = "Mecha|Attributes", meta = (Bitmask, BitmaskEnum = "/Script/Project_Mecha.EMechaObservedAttribute"))
+    int32 DirtyMask = 0;
+
+    bool IsDirty(EMechaObservedAttribute Attribute) const
+    {
+        return (DirtyMask & (1 << (int32)Attribute)) != 0;
+    }
+
+    float GetHealthPercent() const { return MaxHealth > 0.f ? Health / MaxHealth : 0.f; }
+    float GetEnergyPercent() const { return MaxEnergy > 0.f ? Energy / MaxEnergy : 0.f; }
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnMechaAttributesFlushedNative, const FMechaAttributeSnapshot&);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnMechaAttributesFlushed, const FMechaAttributeSnapshot&, Snapshot);
+
+UCLASS(ClassGroup = (Mecha), meta = (BlueprintSpawnableComponent))
+class PROJECT_MECHA_API UMechaAttributeObserverComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UMechaAttributeObserverComponent();
+
+    // ASC의 관찰 대상 Attribute 델리게이트 바인딩 (이전 ASC는 해제)
+    void Observe(UAbilitySystemComponent* InASC);
+    void StopObserving();
+
+    // 현재 값 전체 (DirtyMask는 모든 항목). 위젯 초기화용
+    UFUNCTION(BlueprintPure, Category = "Mecha|Attributes")
+    FMechaAttributeSnapshot ReadSnapshot() const;
+
+    UFUNCTION(BlueprintPure, Category = "Mecha|Attributes")
+    static bool IsAttributeDirty(const FMechaAttributeSnapshot& Snapshot, EMechaObservedAttribute Attribute)
+    {
+        return Snapshot.IsDirty(Attribute);
+    }
+
+    // C++ 위젯 구독용
+    FOnMechaAttributesFlushedNative OnAttributesFlushedNative;
+
+    // 프레임 끝에 한 번 (바뀐 항목이 있을 때만)
+    UPROPERTY(BlueprintAssignable, Category = "Mecha|Attributes")
+    FOnMechaAttributesFlushed OnAttributesFlushed;
+
+protected:
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+    TWeakObjectPtr<UAbilitySystemComponent> ObservedASC;
+    FDelegateHandle Handles[(int32)EMechaObservedAttribute::Num];
+
+    // 다음 방송까지 누적
+    int32 PendingDirtyMask = 0;
+    float PendingDamage = 0.f;
+
+    static FGameplayAttribute GetAttribute(EMechaObservedAttribute Attribute);
+
+    void OnAttributeChanged(const FOnAttributeChangeData& Data, EMechaObservedAttribute Attribute);
+    void Flush();
+};
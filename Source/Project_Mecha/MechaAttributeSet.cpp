@@ -2,6 +2,7 @@
 // GAS Attribute Set - 체력, 에너지, 이동 속도, 탄약 관리
 
 #include "MechaAttributeSet.h"
+#include "Net/UnrealNetwork.h"
 
 // ========================================
 // 생성자 - 기본값 설정
@@ -27,6 +28,72 @@ UMechaAttributeSet::UMechaAttributeSet()
 	InitAmmoReserve(90.f);    // 예비탄
 }
 
+// ========================================
+// 리플리케이션 - 값이 같아도 OnRep 호출 (예측 값 보정 후 델리게이트 발생)
+// ========================================
+void UMechaAttributeSet::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	// 적 체력바/보스 HUD는 다른 클라이언트에도 필요
+	DOREPLIFETIME_CONDITION_NOTIFY(UMechaAttributeSet, Health, COND_None, REPNOTIFY_Always);
+	DOREPLIFETIME_CONDITION_NOTIFY(UMechaAttributeSet, MaxHealth, COND_None, REPNOTIFY_Always);
+
+	// HUD/이동 예측용 - 소유 클라이언트만
+	DOREPLIFETIME_CONDITION_NOTIFY(UMechaAttributeSet, Energy, COND_OwnerOnly, REPNOTIFY_Always);
+	DOREPLIFETIME_CONDITION_NOTIFY(UMechaAttributeSet, MaxEnergy, COND_OwnerOnly, REPNOTIFY_Always);
+	DOREPLIFETIME_CONDITION_NOTIFY(UMechaAttributeSet, MoveSpeed, COND_OwnerOnly, REPNOTIFY_Always);
+	DOREPLIFETIME_CONDITION_NOTIFY(UMechaAttributeSet, MoveSpeedMultiplier, COND_OwnerOnly, REPNOTIFY_Always);
+	DOREPLIFETIME_CONDITION_NOTIFY(UMechaAttributeSet, AmmoMagazine, COND_OwnerOnly, REPNOTIFY_Always);
+	DOREPLIFETIME_CONDITION_NOTIFY(UMechaAttributeSet, MaxMagazine, COND_OwnerOnly, REPNOTIFY_Always);
+	DOREPLIFETIME_CONDITION_NOTIFY(UMechaAttributeSet, AmmoReserve, COND_OwnerOnly, REPNOTIFY_Always);
+}
+
+void UMechaAttributeSet::OnRep_Health(const FGameplayAttributeData& OldValue)
+{
+	GAMEPLAYATTRIBUTE_REPNOTIFY(UMechaAttributeSet, Health, OldValue);
+}
+
+void UMechaAttributeSet::OnRep_MaxHealth(const FGameplayAttributeData& OldValue)
+{
+	GAMEPLAYATTRIBUTE_REPNOTIFY(UMechaAttributeSet, MaxHealth, OldValue);
+}
+
+void UMechaAttributeSet::OnRep_Energy(const FGameplayAttributeData& OldValue)
+{
+	GAMEPLAYATTRIBUTE_REPNOTIFY(UMechaAttributeSet, Energy, OldValue);
+}
+
+void UMechaAttributeSet::OnRep_MaxEnergy(const FGameplayAttributeData& OldValue)
+{
+	GAMEPLAYATTRIBUTE_REPNOTIFY(UMechaAttributeSet, MaxEnergy, OldValue);
+}
+
+void UMechaAttributeSet::OnRep_MoveSpeed(const FGameplayAttributeData& OldValue)
+{
+	GAMEPLAYATTRIBUTE_REPNOTIFY(UMechaAttributeSet, MoveSpeed, OldValue);
+}
+
+void UMechaAttributeSet::OnRep_MoveSpeedMultiplier(const FGameplayAttributeData& OldValue)
+{
+	GAMEPLAYATTRIBUTE_REPNOTIFY(UMechaAttributeSet, MoveSpeedMultiplier, OldValue);
+}
+
+void UMechaAttributeSet::OnRep_AmmoMagazine(const FGameplayAttributeData& OldValue)
+{
+	GAMEPLAYATTRIBUTE_REPNOTIFY(UMechaAttributeSet, AmmoMagazine, OldValue);
+}
+
+void UMechaAttributeSet::OnRep_MaxMagazine(const FGameplayAttributeData& OldValue)
+{
+	GAMEPLAYATTRIBUTE_REPNOTIFY(UMechaAttributeSet, MaxMagazine, OldValue);
+}
+
+void UMechaAttributeSet::OnRep_AmmoReserve(const FGameplayAttributeData& OldValue)
+{
+	GAMEPLAYATTRIBUTE_REPNOTIFY(UMechaAttributeSet, AmmoReserve, OldValue);
+}
+
 // ========================================
 // Attribute 변경 전 클램프
 // ========================================
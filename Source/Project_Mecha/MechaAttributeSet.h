@@ -9,6 +9,7 @@
 
 // 역할(Role)
 // - 캐릭터의 핵심 수치(Health/Energy/MoveSpeed)와 탄약(탄창/예비탄)을 GAS Attribute로 보관
+// - 서버 권한 값이 클라이언트로 복제됨 (Health/MaxHealth는 전원, 나머지는 소유자만)
 // - ATTRIBUTE_ACCESSORS로 BP/C++에서 손쉽게 접근 가능
 
 #define ATTRIBUTE_ACCESSORS(ClassName, PropertyName) \
@@ -26,45 +27,46 @@ public:
     UMechaAttributeSet();
 
     // Vital
-    UPROPERTY(BlueprintReadOnly, Category="Attributes|Vital")
+    UPROPERTY(BlueprintReadOnly, ReplicatedUsing = OnRep_Health, Category="Attributes|Vital")
     FGameplayAttributeData Health;
     ATTRIBUTE_ACCESSORS(UMechaAttributeSet, Health)
 
-    UPROPERTY(BlueprintReadOnly, Category="Attributes|Vital")
+    UPROPERTY(BlueprintReadOnly, ReplicatedUsing = OnRep_MaxHealth, Category="Attributes|Vital")
     FGameplayAttributeData MaxHealth;
     ATTRIBUTE_ACCESSORS(UMechaAttributeSet, MaxHealth)
 
-    UPROPERTY(BlueprintReadOnly, Category="Attributes|Vital")
+    UPROPERTY(BlueprintReadOnly, ReplicatedUsing = OnRep_Energy, Category="Attributes|Vital")
     FGameplayAttributeData Energy;
     ATTRIBUTE_ACCESSORS(UMechaAttributeSet, Energy)
 
-    UPROPERTY(BlueprintReadOnly, Category="Attributes|Vital")
+    UPROPERTY(BlueprintReadOnly, ReplicatedUsing = OnRep_MaxEnergy, Category="Attributes|Vital")
     FGameplayAttributeData MaxEnergy;
     ATTRIBUTE_ACCESSORS(UMechaAttributeSet, MaxEnergy)
 
     // Movement
-    UPROPERTY(BlueprintReadOnly, Category="Attributes|Movement")
+    UPROPERTY(BlueprintReadOnly, ReplicatedUsing = OnRep_MoveSpeed, Category="Attributes|Movement")
     FGameplayAttributeData MoveSpeed;
     ATTRIBUTE_ACCESSORS(UMechaAttributeSet, MoveSpeed)
 
-    UPROPERTY(BlueprintReadOnly, Category="Attributes|Movement")
+    UPROPERTY(BlueprintReadOnly, ReplicatedUsing = OnRep_MoveSpeedMultiplier, Category="Attributes|Movement")
     FGameplayAttributeData MoveSpeedMultiplier;
     ATTRIBUTE_ACCESSORS(UMechaAttributeSet, MoveSpeedMultiplier)
 
     // Ammo (탄창 + 예비탄)
-    UPROPERTY(BlueprintReadOnly, Category="Attributes|Ammo")
+    UPROPERTY(BlueprintReadOnly, ReplicatedUsing = OnRep_AmmoMagazine, Category="Attributes|Ammo")
     FGameplayAttributeData AmmoMagazine;
     ATTRIBUTE_ACCESSORS(UMechaAttributeSet, AmmoMagazine)
 
-    UPROPERTY(BlueprintReadOnly, Category="Attributes|Ammo")
+    UPROPERTY(BlueprintReadOnly, ReplicatedUsing = OnRep_MaxMagazine, Category="Attributes|Ammo")
     FGameplayAttributeData MaxMagazine;
     ATTRIBUTE_ACCESSORS(UMechaAttributeSet, MaxMagazine)
 
-    UPROPERTY(BlueprintReadOnly, Category="Attributes|Ammo")
+    UPROPERTY(BlueprintReadOnly, ReplicatedUsing = OnRep_AmmoReserve, Category="Attributes|Ammo")
     FGameplayAttributeData AmmoReserve;
     ATTRIBUTE_ACCESSORS(UMechaAttributeSet, AmmoReserve)
 
     // Overrides
+    virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
     virtual void PreAttributeChange(const FGameplayAttribute& Attribute, float& NewValue) override;
     virtual void PostGameplayEffectExecute(const struct FGameplayEffectModCallbackData& Data) override;
 
@@ -77,4 +79,34 @@ public:
     
     // 최소 탄창 크기
     static constexpr float MinMagazineSize = 1.f;
+
+protected:
+    // ================== 리플리케이션 ==================
+    // 체력은 모든 클라이언트(적 체력바), 나머지는 소유 클라이언트(HUD/이동 예측)만
+    UFUNCTION()
+    void OnRep_Health(const FGameplayAttributeData& OldValue);
+
+    UFUNCTION()
+    void OnRep_MaxHealth(const FGameplayAttributeData& OldValue);
+
+    UFUNCTION()
+    void OnRep_Energy(const FGameplayAttributeData& OldValue);
+
+    UFUNCTION()
+    void OnRep_MaxEnergy(const FGameplayAttributeData& OldValue);
+
+    UFUNCTION()
+    void OnRep_MoveSpeed(const FGameplayAttributeData& OldValue);
+
+    UFUNCTION()
+    void OnRep_MoveSpeedMultiplier(const FGameplayAttributeData& OldValue);
+
+    UFUNCTION()
+    void OnRep_AmmoMagazine(const FGameplayAttributeData& OldValue);
+
+    UFUNCTION()
+    void OnRep_MaxMagazine(const FGameplayAttributeData& OldValue);
+
+    UFUNCTION()
+    void OnRep_AmmoReserve(const FGameplayAttributeData& OldValue);
 };
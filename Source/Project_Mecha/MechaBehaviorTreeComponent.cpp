@@ -0,0 +1,45 @@
+// MechaBehaviorTreeComponent.cpp
+// 시분할 BT 컴포넌트 - 엔진 틱은 시간만 모으고 실제 평가는 AI 스케줄러가 예산 안에서 실행
+
+#include "MechaBehaviorTreeComponent.h"
+#include "MechaAISchedulerSubsystem.h"
+
+// ========================================
+// 엔진 틱 - 스케줄러 대기열에 등록
+// ========================================
+void UMechaBehaviorTreeComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	UMechaAISchedulerSubsystem* Scheduler = UMechaAISchedulerSubsystem::Get(this);
+	if (!Scheduler || !Scheduler->IsEnabled())
+	{
+		// 대기 중이던 시간이 있으면 합쳐서 바로 실행
+		Super::TickComponent(DeltaTime + PendingDeltaTime, TickType, ThisTickFunction);
+		PendingDeltaTime = 0.f;
+		bPendingTick = false;
+		DeferredFrames = 0;
+		return;
+	}
+
+	PendingDeltaTime += DeltaTime;
+
+	if (!bPendingTick)
+	{
+		bPendingTick = true;
+		Scheduler->EnqueueTick(this);
+	}
+}
+
+// ========================================
+// 스케줄러 실행
+// ========================================
+void UMechaBehaviorTreeComponent::RunScheduledTick()
+{
+	if (!bPendingTick) return;
+
+	const float DeltaTime = PendingDeltaTime;
+	PendingDeltaTime = 0.f;
+	bPendingTick = false;
+	DeferredFrames = 0;
+
+	Super::TickComponent(DeltaTime, LEVELTICK_All, nullptr);
+}
@@ -0,0 +1,32 @@
+// MechaBehaviorTreeComponent.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BehaviorTree/BehaviorTreeComponent.h"
+// 설명:
+// - 적 AI 컨트롤러용 BT 컴포넌트. 엔진 틱에서는 경과 시간만 모아 UMechaAISchedulerSubsystem 대기열에 올리고,
+//   실제 BT 틱(서비스/데코레이터/태스크 평가)은 스케줄러가 프레임 예산 안에서 우선순위 순서로 실행합니다.
+// - 밀린 시간은 다음 실행 때 한꺼번에 넘기므로 서비스 간격/대기 태스크 시간은 그대로 유지됩니다.
+// - Mecha.AI.Scheduler 0이면 스케줄러 없이 엔진 틱에서 바로 실행합니다.
+#include "MechaBehaviorTreeComponent.generated.h"
+
+UCLASS()
+class PROJECT_MECHA_API UMechaBehaviorTreeComponent : public UBehaviorTreeComponent
+{
+    GENERATED_BODY()
+
+public:
+    virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+    // 스케줄러가 호출: 모아 둔 시간으로 BT 한 번 틱
+    void RunScheduledTick();
+
+    bool HasPendingTick() const { return bPendingTick; }
+
+    // 연속으로 미뤄진 프레임 수 (스케줄러 우선순위용)
+    int32 DeferredFrames = 0;
+
+private:
+    bool bPendingTick = false;
+    float PendingDeltaTime = 0.f;
+};
@@ -0,0 +1,681 @@
+// MechaBenchmarkSubsystem.cpp
+// 헤드리스 전투 벤치마크 - 적 스폰, 스크립트 봇, 보스 페이즈 유도, JSON/CSV 리포트
+
+#include "MechaBenchmarkSubsystem.h"
+
+#include "Project_Mecha.h"
+#include "EnemyMecha.h"
+#include "MechaCharacterBase.h"
+#include "MechaAttributeSet.h"
+#include "MechaCombatRegistrySubsystem.h"
+#include "MissionManager.h"
+#include "MechaUIInvalidation.h"
+#include "AbilitySystemComponent.h"
+#include "InputActionValue.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Framework/Application/SlateApplication.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "RenderCore.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace MechaBenchmark
+{
+	// 봇 입력 주기 (초)
+	constexpr double LockOnRetryInterval = 0.5;
+	constexpr double GunHoldSeconds = 2.0;
+	constexpr double GunReleaseSeconds = 0.5;
+	constexpr double MissileInterval = 6.0;
+	constexpr double HoverHoldSeconds = 3.0;
+	constexpr double HoverReleaseSeconds = 3.0;
+
+	// 이 거리보다 멀면 가장 가까운 적 쪽으로 이동
+	constexpr float EngageDistance = 4000.f;
+
+	// 보스 페이즈 시작 후 맵 BP가 보스를 스폰할 때까지 기다리는 시간
+	constexpr double BossSpawnGrace = 2.0;
+
+	// 메모리 샘플 간격 (프레임)
+	constexpr int32 MemorySampleInterval = 30;
+
+	// 정렬된 배열의 백분위 (P: 0 ~ 100)
+	static float Percentile(const TArray<float>& Sorted, float P)
+	{
+		if (Sorted.Num() == 0) return 0.f;
+
+		const int32 Index = FMath::Clamp(FMath::CeilToInt(P / 100.f * Sorted.Num()) - 1, 0, Sorted.Num() - 1);
+		return Sorted[Index];
+	}
+
+	static TSharedRef<FJsonObject> MakeDistribution(TArray<float> Values)
+	{
+		Values.Sort();
+
+		double Sum = 0.0;
+		for (const float V : Values) Sum += V;
+
+		TSharedRef<FJsonObject> Obj = MakeShared<FJsonObject>();
+		Obj->SetNumberField(TEXT("avg"), Values.Num() > 0 ? Sum / Values.Num() : 0.0);
+		Obj->SetNumberField(TEXT("p50"), Percentile(Values, 50.f));
+		Obj->SetNumberField(TEXT("p90"), Percentile(Values, 90.f));
+		Obj->SetNumberField(TEXT("p95"), Percentile(Values, 95.f));
+		Obj->SetNumberField(TEXT("p99"), Percentile(Values, 99.f));
+		Obj->SetNumberField(TEXT("max"), Values.Num() > 0 ? Values.Last() : 0.f);
+		return Obj;
+	}
+}
+
+// ========================================
+// 생성 조건 / 수명
+// ========================================
+bool UMechaBenchmarkSubsystem::IsBenchmarkRequested()
+{
+	return FParse::Param(FCommandLine::Get(), TEXT("MechaBenchmark"));
+}
+
+bool UMechaBenchmarkSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (!Super::ShouldCreateSubsystem(Outer) || !IsBenchmarkRequested())
+	{
+		return false;
+	}
+
+	// HUD는 맵 로드 중 폰 BeginPlay에서 만들어지므로 월드 생성 시점에 꺼야 비교가 됨
+	if (FParse::Param(FCommandLine::Get(), TEXT("MechaBenchNoUIInvalidation")))
+	{
+		FMechaUIInvalidation::SetEnabled(false);
+	}
+	return true;
+}
+
+bool UMechaBenchmarkSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UMechaBenchmarkSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMechaBenchmarkSubsystem, STATGROUP_Tickables);
+}
+
+void UMechaBenchmarkSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	ParseCommandLine();
+	FMechaUIInvalidation::ResetCounters();
+
+	PreGCHandle = FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddUObject(this, &UMechaBenchmarkSubsystem::OnPreGarbageCollect);
+	PostGCHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &UMechaBenchmarkSubsystem::OnPostGarbageCollect);
+
+	if (FSlateApplication::IsInitialized())
+	{
+		SlatePreTickHandle = FSlateApplication::Get().OnPreTick().AddUObject(this, &UMechaBenchmarkSubsystem::OnSlatePreTick);
+		SlatePostTickHandle = FSlateApplication::Get().OnPostTick().AddUObject(this, &UMechaBenchmarkSubsystem::OnSlatePostTick);
+	}
+
+	RunStartTime = FPlatformTime::Seconds();
+	LastTickTime = RunStartTime;
+
+	UE_LOG(LogMecha, Display, TEXT("[Benchmark] Enabled: %d enemies, warm-up %.0fs, combat %.0fs, boss %.0fs"),
+		EnemyCount, WarmUpSeconds, CombatSeconds, BossSeconds);
+}
+
+void UMechaBenchmarkSubsystem::Deinitialize()
+{
+	FCoreUObjectDelegates::GetPreGarbageCollectDelegate().Remove(PreGCHandle);
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGCHandle);
+
+	if (FSlateApplication::IsInitialized())
+	{
+		FSlateApplication::Get().OnPreTick().Remove(SlatePreTickHandle);
+		FSlateApplication::Get().OnPostTick().Remove(SlatePostTickHandle);
+	}
+
+	// 맵 전환 등으로 리포트 전에 월드가 내려가면 지금까지의 결과라도 남김
+	if (Phase != EPhase::Done && Samples.Num() > 0)
+	{
+		Finish(TEXT("WorldTeardown"));
+	}
+
+	Super::Deinitialize();
+}
+
+void UMechaBenchmarkSubsystem::ParseCommandLine()
+{
+	const TCHAR* Cmd = FCommandLine::Get();
+
+	FParse::Value(Cmd, TEXT("MechaBenchEnemies="), EnemyCount);
+	FParse::Value(Cmd, TEXT("MechaBenchCombat="), CombatSeconds);
+	FParse::Value(Cmd, TEXT("MechaBenchBoss="), BossSeconds);
+	FParse::Value(Cmd, TEXT("MechaBenchBudgetMs="), FrameBudgetP95Ms);
+
+	EnemyCount = FMath::Max(0, EnemyCount);
+
+	if (!FParse::Value(Cmd, TEXT("MechaBenchReport="), ReportDir))
+	{
+		ReportDir = FPaths::ProjectSavedDir() / TEXT("Benchmarks");
+	}
+}
+
+// ========================================
+// 매 프레임
+// ========================================
+void UMechaBenchmarkSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (Phase == EPhase::Done) return;
+
+	const double Now = FPlatformTime::Seconds();
+	const float FrameMs = (float)((Now - LastTickTime) * 1000.0);
+	LastTickTime = Now;
+
+	if (Now - RunStartTime > MaxRunSeconds)
+	{
+		Finish(TEXT("Timeout"));
+		return;
+	}
+
+	switch (Phase)
+	{
+	case EPhase::WaitingForBot:
+		if (TryStart())
+		{
+			SetPhase(EPhase::WarmUp, Now);
+		}
+		break;
+
+	case EPhase::WarmUp:
+		DriveBot(Now);
+		if (Now - PhaseStartTime >= WarmUpSeconds)
+		{
+			SetPhase(EPhase::Combat, Now);
+			NextKillTime = Now + KillInterval;
+		}
+		break;
+
+	case EPhase::Combat:
+		DriveBot(Now);
+		DriveMission(Now);
+		RecordSample(Now, FrameMs);
+
+		// 보스 페이즈에 들어가지 못했어도 시간이 다 되면 보스 구간 측정으로 넘어감
+		if (bReachedBossPhase || Now - PhaseStartTime >= CombatSeconds)
+		{
+			if (!bReachedBossPhase)
+			{
+				UE_LOG(LogMecha, Warning, TEXT("[Benchmark] Combat time elapsed before the boss phase started"));
+			}
+			SetPhase(EPhase::Boss, Now);
+		}
+		break;
+
+	case EPhase::Boss:
+		DriveBot(Now);
+		DriveMission(Now);
+		RecordSample(Now, FrameMs);
+
+		if (Now - PhaseStartTime >= BossSeconds)
+		{
+			Finish(TEXT("Completed"));
+		}
+		break;
+
+	default:
+		break;
+	}
+}
+
+void UMechaBenchmarkSubsystem::SetPhase(EPhase NewPhase, double Now)
+{
+	Phase = NewPhase;
+	PhaseStartTime = Now;
+
+	UE_LOG(LogMecha, Display, TEXT("[Benchmark] Phase %s (t=%.1fs)"), PhaseName(NewPhase), Now - RunStartTime);
+}
+
+// ========================================
+// 시작 - 봇 확보, 적 스폰, 미션 시작
+// ========================================
+bool UMechaBenchmarkSubsystem::TryStart()
+{
+	UWorld* World = GetWorld();
+	if (!World) return false;
+
+	APlayerController* PC = World->GetFirstPlayerController();
+	AMechaCharacterBase* BotChar = PC ? Cast<AMechaCharacterBase>(PC->GetPawn()) : nullptr;
+	if (!BotChar) return false;
+
+	Bot = BotChar;
+
+	// ========== 적 클래스 결정 ==========
+	UClass* SpawnClass = EnemyClass.LoadSynchronous();
+	if (!SpawnClass)
+	{
+		// 맵에 배치된 적을 템플릿으로 사용
+		if (UMechaCombatRegistrySubsystem* Registry = UMechaCombatRegistrySubsystem::Get(this))
+		{
+			for (const FMechaCombatEntry& Entry : Registry->GetEntries())
+			{
+				if (Entry.Team == EMechaCombatTeam::Enemy && !Entry.bIsBoss && Entry.Actor.IsValid())
+				{
+					SpawnClass = Entry.Actor->GetClass();
+					break;
+				}
+			}
+		}
+	}
+
+	if (SpawnClass)
+	{
+		SpawnEnemies(SpawnClass, BotChar->GetActorLocation());
+	}
+	else
+	{
+		UE_LOG(LogMecha, Warning, TEXT("[Benchmark] No EnemyClass configured and no enemy placed in the map; running without spawned enemies"));
+	}
+
+	SetupMission();
+	return true;
+}
+
+void UMechaBenchmarkSubsystem::SpawnEnemies(UClass* SpawnClass, const FVector& Center)
+{
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	FRandomStream Stream(RandomSeed);
+
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	for (int32 i = 0; i < EnemyCount; ++i)
+	{
+		const float Angle = Stream.FRandRange(0.f, 2.f * PI);
+		const float Radius = Stream.FRandRange(SpawnRadiusMin, SpawnRadiusMax);
+		const FVector Location = Center + FVector(FMath::Cos(Angle) * Radius, FMath::Sin(Angle) * Radius, 200.f);
+		const FRotator Rotation = (Center - Location).GetSafeNormal2D().Rotation();
+
+		AEnemyMecha* Enemy = World->SpawnActor<AEnemyMecha>(SpawnClass, Location, Rotation, Params);
+		if (!Enemy) continue;
+
+		// 스폰된 폰은 AutoPossessAI 설정에 따라 컨트롤러가 없을 수 있음
+		if (!Enemy->GetController())
+		{
+			Enemy->SpawnDefaultController();
+		}
+		++SpawnedEnemies;
+	}
+
+	UE_LOG(LogMecha, Display, TEXT("[Benchmark] Spawned %d / %d %s"), SpawnedEnemies, EnemyCount, *SpawnClass->GetName());
+}
+
+void UMechaBenchmarkSubsystem::SetupMission()
+{
+	UMechaCombatRegistrySubsystem* Registry = UMechaCombatRegistrySubsystem::Get(this);
+	AMissionManager* Manager = Registry ? Registry->GetMissionManager() : nullptr;
+
+	// 맵에 미션 매니저가 없으면 직접 생성 (보스 스폰은 BossClass로 대신함)
+	if (!Manager)
+	{
+		if (UWorld* World = GetWorld())
+		{
+			Manager = World->SpawnActor<AMissionManager>();
+			if (Manager)
+			{
+				Manager->RequiredKillCount = FMath::Max(1, RequiredKills);
+			}
+		}
+	}
+
+	if (!Manager) return;
+
+	Mission = Manager;
+	if (!Manager->bMissionActive)
+	{
+		Manager->StartMission();
+	}
+
+	// 전투 구간 안에 목표 킬 수를 고르게 채움
+	const int32 KillsNeeded = FMath::Max(1, Manager->RequiredKillCount - Manager->CurrentKillCount);
+	KillInterval = FMath::Max(0.1, (double)CombatSeconds / (KillsNeeded + 1));
+}
+
+// ========================================
+// 스크립트 봇 - 락온, 접근, GunFire/미사일/호버
+// ========================================
+void UMechaBenchmarkSubsystem::DriveBot(double Now)
+{
+	AMechaCharacterBase* BotChar = Bot.Get();
+	if (!BotChar || BotChar->IsDead()) return;
+
+	// ========== 락온 유지 ==========
+	if (Now >= NextLockOnTime && (!BotChar->bIsLockedOn || !IsValid(BotChar->CurrentLockOnTarget)))
+	{
+		if (BotChar->bIsLockedOn)
+		{
+			BotChar->ClearLockOn();
+		}
+		BotChar->ToggleLockOn();
+		NextLockOnTime = Now + MechaBenchmark::LockOnRetryInterval;
+	}
+
+	// ========== 가장 가까운 적에게 접근 ==========
+	if (UMechaCombatRegistrySubsystem* Registry = UMechaCombatRegistrySubsystem::Get(this))
+	{
+		if (AActor* Nearest = Registry->FindNearest(EMechaCombatTeam::Enemy, BotChar->GetActorLocation()))
+		{
+			const FVector ToEnemy = Nearest->GetActorLocation() - BotChar->GetActorLocation();
+			if (ToEnemy.SizeSquared2D() > FMath::Square(MechaBenchmark::EngageDistance))
+			{
+				BotChar->AddMovementInput(ToEnemy.GetSafeNormal2D());
+			}
+
+			// 락온이 없을 때는 시점을 직접 돌려 락온 후보 시야각에 들어오게 함
+			if (!BotChar->bIsLockedOn)
+			{
+				if (AController* Controller = BotChar->GetController())
+				{
+					Controller->SetControlRotation(ToEnemy.Rotation());
+				}
+			}
+		}
+	}
+
+	// ========== GunFire (누르기/떼기 반복, 탄창이 비면 재장전) ==========
+	if (Now >= NextGunToggleTime)
+	{
+		bGunHeld = !bGunHeld;
+		if (bGunHeld)
+		{
+			BotChar->Input_GunFire_Pressed();
+		}
+		else
+		{
+			BotChar->Input_GunFire_Released();
+		}
+		NextGunToggleTime = Now + (bGunHeld ? MechaBenchmark::GunHoldSeconds : MechaBenchmark::GunReleaseSeconds);
+	}
+
+	if (const UMechaAttributeSet* Attrs = BotChar->GetMechaAttributeSet())
+	{
+		if (Attrs->GetAmmoMagazine() <= 0.f && Attrs->GetAmmoReserve() > 0.f)
+		{
+			BotChar->Input_Reload_Pressed();
+		}
+	}
+
+	// ========== 미사일 ==========
+	if (Now >= NextMissileTime)
+	{
+		BotChar->Input_MissleFire(FInputActionValue(true));
+		NextMissileTime = Now + MechaBenchmark::MissileInterval;
+	}
+
+	// ========== 호버 (누르기/떼기 반복) ==========
+	if (Now >= NextHoverToggleTime)
+	{
+		bHoverHeld = !bHoverHeld;
+		if (bHoverHeld)
+		{
+			BotChar->Input_Hover_Pressed();
+		}
+		else
+		{
+			BotChar->Input_Hover_Released();
+		}
+		NextHoverToggleTime = Now + (bHoverHeld ? MechaBenchmark::HoverHoldSeconds : MechaBenchmark::HoverReleaseSeconds);
+	}
+}
+
+// ========================================
+// 미션 유도 - 일정 간격으로 적 처치, 보스 페이즈 확인
+// ========================================
+void UMechaBenchmarkSubsystem::DriveMission(double Now)
+{
+	AMissionManager* Manager = Mission.Get();
+	if (!Manager) return;
+
+	if (!bReachedBossPhase)
+	{
+		if (Manager->bBossPhaseStarted)
+		{
+			bReachedBossPhase = true;
+			BossPhaseStartTime = Now;
+			UE_LOG(LogMecha, Display, TEXT("[Benchmark] Boss phase reached (t=%.1fs)"), Now - RunStartTime);
+		}
+		else if (Now >= NextKillTime)
+		{
+			KillOneEnemy();
+			NextKillTime = Now + KillInterval;
+		}
+		return;
+	}
+
+	if (!bBossSpawnedByBenchmark && !Manager->BossInstance && Now - BossPhaseStartTime >= MechaBenchmark::BossSpawnGrace)
+	{
+		SpawnBossIfMissing();
+	}
+}
+
+bool UMechaBenchmarkSubsystem::KillOneEnemy()
+{
+	UMechaCombatRegistrySubsystem* Registry = UMechaCombatRegistrySubsystem::Get(this);
+	if (!Registry) return false;
+
+	for (const FMechaCombatEntry& Entry : Registry->GetEntries())
+	{
+		if (Entry.Team != EMechaCombatTeam::Enemy || Entry.bIsBoss) continue;
+
+		AEnemyMecha* Enemy = Cast<AEnemyMecha>(Entry.Actor.Get());
+		UAbilitySystemComponent* ASC = Enemy ? Enemy->GetAbilitySystemComponent() : nullptr;
+		if (!ASC) continue;
+
+		// 체력 0 → OnHealthChanged → HandleDeath → 미션 매니저 킬 보고 (실제 사망 경로와 동일)
+		ASC->SetNumericAttributeBase(UMechaAttributeSet::GetHealthAttribute(), 0.f);
+		return true;
+	}
+	return false;
+}
+
+void UMechaBenchmarkSubsystem::SpawnBossIfMissing()
+{
+	bBossSpawnedByBenchmark = true;
+
+	AMissionManager* Manager = Mission.Get();
+	AMechaCharacterBase* BotChar = Bot.Get();
+	UWorld* World = GetWorld();
+	UClass* SpawnClass = BossClass.LoadSynchronous();
+	if (!Manager || !BotChar || !World || !SpawnClass)
+	{
+		UE_LOG(LogMecha, Warning, TEXT("[Benchmark] Boss phase started but no boss was spawned and BossClass is not configured"));
+		return;
+	}
+
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	const FVector Location = BotChar->GetActorLocation() + BotChar->GetActorForwardVector() * SpawnRadiusMin + FVector(0.f, 0.f, 200.f);
+	AEnemyMecha* Boss = World->SpawnActor<AEnemyMecha>(SpawnClass, Location, (BotChar->GetActorLocation() - Location).Rotation(), Params);
+	if (!Boss) return;
+
+	if (!Boss->GetController())
+	{
+		Boss->SpawnDefaultController();
+	}
+	Manager->BossInstance = Boss;
+}
+
+// ========================================
+// 측정
+// ========================================
+void UMechaBenchmarkSubsystem::RecordSample(double Now, float FrameMs)
+{
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	FFrameSample& Sample = Samples.AddDefaulted_GetRef();
+	Sample.Time = Now - RunStartTime;
+	Sample.FrameMs = FrameMs;
+	Sample.GameThreadMs = (float)FPlatformTime::ToMilliseconds(GGameThreadTime);
+	Sample.SlateMs = LastSlateTickMs;
+	Sample.NumActors = World->GetActorCount();
+	Sample.Phase = Phase;
+
+	if (const UMechaCombatRegistrySubsystem* Registry = UMechaCombatRegistrySubsystem::Get(this))
+	{
+		Sample.NumEnemies = Registry->GetNumCombatants(EMechaCombatTeam::Enemy);
+	}
+
+	PeakActors = FMath::Max(PeakActors, Sample.NumActors);
+
+	if (Samples.Num() % MechaBenchmark::MemorySampleInterval == 1)
+	{
+		PeakUsedPhysical = FMath::Max<uint64>(PeakUsedPhysical, FPlatformMemory::GetStats().UsedPhysical);
+	}
+}
+
+void UMechaBenchmarkSubsystem::OnPreGarbageCollect()
+{
+	GCStartTime = FPlatformTime::Seconds();
+}
+
+void UMechaBenchmarkSubsystem::OnPostGarbageCollect()
+{
+	// 측정 구간(전투/보스)의 GC만 집계
+	if (Phase != EPhase::Combat && Phase != EPhase::Boss) return;
+
+	GCPauseMs.Add((float)((FPlatformTime::Seconds() - GCStartTime) * 1000.0));
+}
+
+void UMechaBenchmarkSubsystem::OnSlatePreTick(float DeltaTime)
+{
+	SlateTickStartTime = FPlatformTime::Seconds();
+}
+
+void UMechaBenchmarkSubsystem::OnSlatePostTick(float DeltaTime)
+{
+	LastSlateTickMs = (float)((FPlatformTime::Seconds() - SlateTickStartTime) * 1000.0);
+}
+
+// ========================================
+// 종료 - 리포트 작성 후 프로세스 종료 요청
+// ========================================
+void UMechaBenchmarkSubsystem::Finish(const TCHAR* Reason)
+{
+	const bool bCompleted = FCString::Strcmp(Reason, TEXT("Completed")) == 0;
+	Phase = EPhase::Done;
+
+	const FString BaseName = FString::Printf(TEXT("MechaBench_%d_%s"), EnemyCount, *FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S")));
+
+	float FrameP95 = 0.f;
+	const bool bWritten = WriteReport(BaseName, FrameP95);
+
+	const bool bOverBudget = FrameBudgetP95Ms > 0.f && FrameP95 > FrameBudgetP95Ms;
+	const bool bPassed = bCompleted && bWritten && !bOverBudget;
+
+	UE_LOG(LogMecha, Display, TEXT("[Benchmark] %s: p95 %.2f ms (budget %.2f), %d samples -> %s"),
+		Reason, FrameP95, FrameBudgetP95Ms, Samples.Num(), *(ReportDir / BaseName));
+
+	// 월드 정리 중(Deinitialize)에는 종료 요청하지 않음
+	if (FCString::Strcmp(Reason, TEXT("WorldTeardown")) != 0)
+	{
+		FPlatformMisc::RequestExitWithStatus(false, bPassed ? 0 : 1);
+	}
+}
+
+bool UMechaBenchmarkSubsystem::WriteReport(const FString& BaseName, float& OutFrameP95) const
+{
+	TArray<float> FrameMs, GameThreadMs, SlateMs;
+	FrameMs.Reserve(Samples.Num());
+	GameThreadMs.Reserve(Samples.Num());
+	SlateMs.Reserve(Samples.Num());
+
+	// ========== CSV (프레임별) ==========
+	FString Csv = TEXT("Time,Phase,FrameMs,GameThreadMs,SlateMs,Actors,Enemies\n");
+	for (const FFrameSample& S : Samples)
+	{
+		FrameMs.Add(S.FrameMs);
+		GameThreadMs.Add(S.GameThreadMs);
+		SlateMs.Add(S.SlateMs);
+		Csv += FString::Printf(TEXT("%.3f,%s,%.3f,%.3f,%.3f,%d,%d\n"), S.Time, PhaseName(S.Phase), S.FrameMs, S.GameThreadMs, S.SlateMs, S.NumActors, S.NumEnemies);
+	}
+
+	// ========== JSON (요약) ==========
+	const TSharedRef<FJsonObject> FrameDist = MechaBenchmark::MakeDistribution(FrameMs);
+	OutFrameP95 = (float)FrameDist->GetNumberField(TEXT("p95"));
+
+	float GCTotal = 0.f, GCMax = 0.f;
+	for (const float Ms : GCPauseMs)
+	{
+		GCTotal += Ms;
+		GCMax = FMath::Max(GCMax, Ms);
+	}
+
+	TSharedRef<FJsonObject> GC = MakeShared<FJsonObject>();
+	GC->SetNumberField(TEXT("count"), GCPauseMs.Num());
+	GC->SetNumberField(TEXT("total_ms"), GCTotal);
+	GC->SetNumberField(TEXT("max_ms"), GCMax);
+
+	const FPlatformMemoryStats Mem = FPlatformMemory::GetStats();
+	TSharedRef<FJsonObject> Memory = MakeShared<FJsonObject>();
+	Memory->SetNumberField(TEXT("peak_used_physical_mb"), (double)FMath::Max<uint64>(Mem.PeakUsedPhysical, PeakUsedPhysical) / (1024.0 * 1024.0));
+	Memory->SetNumberField(TEXT("used_physical_mb"), (double)Mem.UsedPhysical / (1024.0 * 1024.0));
+
+	TSharedRef<FJsonObject> Actors = MakeShared<FJsonObject>();
+	Actors->SetNumberField(TEXT("peak"), PeakActors);
+	Actors->SetNumberField(TEXT("final"), Samples.Num() > 0 ? Samples.Last().NumActors : 0);
+	Actors->SetNumberField(TEXT("enemies_spawned"), SpawnedEnemies);
+
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetStringField(TEXT("map"), GetWorld() ? GetWorld()->GetMapName() : FString());
+	Root->SetNumberField(TEXT("enemy_count"), EnemyCount);
+	Root->SetBoolField(TEXT("reached_boss_phase"), bReachedBossPhase);
+	Root->SetNumberField(TEXT("samples"), Samples.Num());
+	Root->SetNumberField(TEXT("frame_budget_p95_ms"), FrameBudgetP95Ms);
+	Root->SetObjectField(TEXT("frame_ms"), FrameDist);
+	Root->SetObjectField(TEXT("game_thread_ms"), MechaBenchmark::MakeDistribution(GameThreadMs));
+	Root->SetObjectField(TEXT("slate_tick_ms"), MechaBenchmark::MakeDistribution(SlateMs));
+	// CVar 현재값이 아니라 실제로 감싼 위젯 기준
+	const int32 WrappedRoots = FMechaUIInvalidation::GetNumWrappedRoots();
+	const int32 UnwrappedRoots = FMechaUIInvalidation::GetNumUnwrappedRoots();
+	Root->SetBoolField(TEXT("ui_invalidation"), WrappedRoots > 0 && UnwrappedRoots == 0);
+	Root->SetNumberField(TEXT("ui_roots_wrapped"), WrappedRoots);
+	Root->SetNumberField(TEXT("ui_roots_unwrapped"), UnwrappedRoots);
+	Root->SetObjectField(TEXT("gc"), GC);
+	Root->SetObjectField(TEXT("actors"), Actors);
+	Root->SetObjectField(TEXT("memory"), Memory);
+
+	FString Json;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	FJsonSerializer::Serialize(Root, Writer);
+
+	const bool bJson = FFileHelper::SaveStringToFile(Json, *(ReportDir / BaseName + TEXT(".json")));
+	const bool bCsv = FFileHelper::SaveStringToFile(Csv, *(ReportDir / BaseName + TEXT(".csv")));
+	if (!bJson || !bCsv)
+	{
+		UE_LOG(LogMecha, Error, TEXT("[Benchmark] Failed to write report to %s"), *ReportDir);
+	}
+	return bJson && bCsv;
+}
+
+const TCHAR* UMechaBenchmarkSubsystem::PhaseName(EPhase InPhase)
+{
+	switch (InPhase)
+	{
+	case EPhase::WaitingForBot: return TEXT("WaitingForBot");
+	case EPhase::WarmUp:        return TEXT("WarmUp");
+	case EPhase::Combat:        return TEXT("Combat");
+	case EPhase::Boss:          return TEXT("Boss");
+	default:                    return TEXT("Done");
+	}
+}
@@ -0,0 +1,176 @@
+// MechaBenchmarkSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+// 설명:
+// - 헤드리스 전투 벤치마크. 명령줄에 -MechaBenchmark가 있을 때만 생성됩니다.
+//   예) UnrealEditor Project_Mecha.uproject /Game/Main/StartMap -game -nullrhi -unattended -nosound
+//       -MechaBenchmark -MechaBenchEnemies=500
+// - 진행: 대기(플레이어 폰) → 적 N기 스폰 + 미션 시작 → 워밍업 → 전투(킬 강제로 보스 페이즈 진입) → 보스 → 리포트 후 종료.
+// - 플레이어 AMechaCharacterBase는 스크립트 봇이 조종합니다 (락온 유지, GunFire 연사, 미사일, 호버 반복).
+//   봇은 플레이어 입력 함수를 그대로 호출하므로 실제 입력과 같은 능력 경로를 탑니다.
+// - 리포트: Saved/Benchmarks/MechaBench_<적 수>_<시각>.json (요약) / .csv (프레임별)
+//   프레임 시간·게임 스레드 ms·Slate 틱(위젯 배치+그리기) ms 백분위, GC 일시정지, 액터 수, 최대 메모리.
+//   UI 캐싱 전후 비교: -MechaBenchNoUIInvalidation (또는 -dpcvars=Mecha.UI.Invalidation=0)으로 한 번 더 실행.
+//   HUD는 맵 로드 중에 만들어지므로 첫 틱에 실행되는 -ExecCmds로는 늦습니다.
+//   리포트의 ui_invalidation은 실제로 InvalidationBox로 감싼 위젯 루트 수(ui_roots_wrapped/unwrapped) 기준입니다.
+//   Slate 그리기까지 재려면 -nullrhi 없이 실행합니다.
+// - 명령줄 옵션 (기본값은 DefaultGame.ini [/Script/Project_Mecha.MechaBenchmarkSubsystem]):
+//   -MechaBenchEnemies=  -MechaBenchCombat=<초>  -MechaBenchBoss=<초>  -MechaBenchReport=<폴더>
+//   -MechaBenchBudgetMs=<p95 프레임 예산>  (초과 시 종료 코드 1 → CI에서 회귀 감지)
+//   -MechaBenchNoUIInvalidation  (월드 생성 시점에 Mecha.UI.Invalidation 0)
+#include "MechaBenchmarkSubsystem.generated.h"
+
+class AEnemyMecha;
+class AMechaCharacterBase;
+class AMissionManager;
+
+UCLASS(Config = Game)
+class PROJECT_MECHA_API UMechaBenchmarkSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // 명령줄에 -MechaBenchmark가 있는지
+    static bool IsBenchmarkRequested();
+
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+    // ===== 설정 (Config) =====
+    // 스폰할 적 클래스 (비어 있으면 맵에 배치된 적의 클래스 사용)
+    UPROPERTY(Config)
+    TSoftClassPtr<AEnemyMecha> EnemyClass;
+
+    // 보스 페이즈 시작 후 보스가 없으면 직접 스폰할 클래스 (맵 BP가 스폰하면 불필요)
+    UPROPERTY(Config)
+    TSoftClassPtr<AEnemyMecha> BossClass;
+
+    UPROPERTY(Config)
+    int32 EnemyCount = 100;
+
+    // 봇 주변 링 형태로 스폰
+    UPROPERTY(Config)
+    float SpawnRadiusMin = 3000.f;
+
+    UPROPERTY(Config)
+    float SpawnRadiusMax = 12000.f;
+
+    // 맵에 미션 매니저가 없을 때 새로 만드는 매니저의 목표 킬 수
+    UPROPERTY(Config)
+    int32 RequiredKills = 10;
+
+    UPROPERTY(Config)
+    float WarmUpSeconds = 5.f;
+
+    UPROPERTY(Config)
+    float CombatSeconds = 60.f;
+
+    UPROPERTY(Config)
+    float BossSeconds = 20.f;
+
+    // 이 시간이 지나면 단계와 상관없이 리포트 후 종료
+    UPROPERTY(Config)
+    float MaxRunSeconds = 300.f;
+
+    // p95 프레임 시간 예산 (0이면 검사 안 함)
+    UPROPERTY(Config)
+    float FrameBudgetP95Ms = 0.f;
+
+    // 스폰 위치 난수 시드 (실행 간 재현성)
+    UPROPERTY(Config)
+    int32 RandomSeed = 1234;
+
+private:
+    enum class EPhase : uint8
+    {
+        WaitingForBot,
+        WarmUp,
+        Combat,
+        Boss,
+        Done
+    };
+
+    struct FFrameSample
+    {
+        double Time = 0.0;
+        float FrameMs = 0.f;
+        float GameThreadMs = 0.f;
+        float SlateMs = 0.f;
+        int32 NumActors = 0;
+        int32 NumEnemies = 0;
+        EPhase Phase = EPhase::Combat;
+    };
+
+    EPhase Phase = EPhase::WaitingForBot;
+    double RunStartTime = 0.0;
+    double PhaseStartTime = 0.0;
+    double LastTickTime = 0.0;
+
+    FString ReportDir;
+
+    TWeakObjectPtr<AMechaCharacterBase> Bot;
+    TWeakObjectPtr<AMissionManager> Mission;
+
+    // ===== 봇 입력 타이밍 =====
+    double NextLockOnTime = 0.0;
+    double NextGunToggleTime = 0.0;
+    double NextMissileTime = 0.0;
+    double NextHoverToggleTime = 0.0;
+    bool bGunHeld = false;
+    bool bHoverHeld = false;
+
+    // ===== 보스 페이즈 유도 =====
+    double NextKillTime = 0.0;
+    double KillInterval = 1.0;
+    double BossPhaseStartTime = -1.0;
+    bool bReachedBossPhase = false;
+    bool bBossSpawnedByBenchmark = false;
+
+    // ===== 측정 =====
+    TArray<FFrameSample> Samples;
+    TArray<float> GCPauseMs;
+    double GCStartTime = 0.0;
+    int32 PeakActors = 0;
+    int32 SpawnedEnemies = 0;
+    uint64 PeakUsedPhysical = 0;
+    FDelegateHandle PreGCHandle;
+    FDelegateHandle PostGCHandle;
+
+    // Slate 틱 = FSlateApplication PreTick ~ PostTick (샘플에는 직전 프레임 값)
+    double SlateTickStartTime = 0.0;
+    float LastSlateTickMs = 0.f;
+    FDelegateHandle SlatePreTickHandle;
+    FDelegateHandle SlatePostTickHandle;
+
+    void ParseCommandLine();
+    bool TryStart();
+    void SpawnEnemies(UClass* SpawnClass, const FVector& Center);
+    void SetupMission();
+
+    void DriveBot(double Now);
+    void DriveMission(double Now);
+    bool KillOneEnemy();
+    void SpawnBossIfMissing();
+
+    void SetPhase(EPhase NewPhase, double Now);
+    void RecordSample(double Now, float FrameMs);
+
+    void OnPreGarbageCollect();
+    void OnPostGarbageCollect();
+
+    void OnSlatePreTick(float DeltaTime);
+    void OnSlatePostTick(float DeltaTime);
+
+    void Finish(const TCHAR* Reason);
+    bool WriteReport(const FString& BaseName, float& OutFrameP95) const;
+
+    static const TCHAR* PhaseName(EPhase InPhase);
+};
@@ -0,0 +1,111 @@
+// MechaBlackboardKeys.cpp
+// 블랙보드 키 ID 해석 - 빙의 시 해석, 누락/타입 불일치 경고, 타입별 설정
+
+#include "MechaBlackboardKeys.h"
+#include "Project_Mecha.h"
+
+#include "BehaviorTree/BlackboardData.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Bool.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Vector.h"
+
+namespace MechaBlackboardKeys
+{
+	struct FKeyDesc
+	{
+		const TCHAR* Name;
+		FBlackboard::FKey FMechaBlackboardKeys::* Member;
+		UClass* (*KeyType)();
+	};
+
+	static UClass* BoolType() { return UBlackboardKeyType_Bool::StaticClass(); }
+	static UClass* VectorType() { return UBlackboardKeyType_Vector::StaticClass(); }
+
+	// 이름 / 멤버 / 타입 표
+	static const FKeyDesc Keys[] =
+	{
+		{ TEXT("HomeLocation"),       &FMechaBlackboardKeys::HomeLocation,       &VectorType },
+		{ TEXT("IsDead"),             &FMechaBlackboardKeys::IsDead,             &BoolType },
+		{ TEXT("IsAttacking"),        &FMechaBlackboardKeys::IsAttacking,        &BoolType },
+		{ TEXT("IsDashing"),          &FMechaBlackboardKeys::IsDashing,          &BoolType },
+		{ TEXT("ShouldDash"),         &FMechaBlackboardKeys::ShouldDash,         &BoolType },
+		{ TEXT("InHookRange"),        &FMechaBlackboardKeys::InHookRange,        &BoolType },
+		{ TEXT("InUppercutRange"),    &FMechaBlackboardKeys::InUppercutRange,    &BoolType },
+		{ TEXT("InFireRange"),        &FMechaBlackboardKeys::InFireRange,        &BoolType },
+		{ TEXT("IsUsingMissileRain"), &FMechaBlackboardKeys::IsUsingMissileRain, &BoolType },
+	};
+
+	// 이미 남긴 경고 (빙의마다 같은 경고가 반복되지 않도록, 게임 스레드 전용)
+	static TSet<FString> WarnedMessages;
+
+	static bool ShouldWarn(const FString& Message)
+	{
+		bool bAlreadyWarned = false;
+		WarnedMessages.Add(Message, &bAlreadyWarned);
+		return !bAlreadyWarned;
+	}
+}
+
+// ========================================
+// 에셋 해석
+// ========================================
+FMechaBlackboardKeys FMechaBlackboardKeys::Resolve(const UBlackboardData* Asset)
+{
+	using namespace MechaBlackboardKeys;
+
+	FMechaBlackboardKeys Resolved;
+	if (!Asset)
+	{
+		return Resolved;
+	}
+
+	for (const FKeyDesc& Desc : Keys)
+	{
+		const FBlackboard::FKey KeyID = Asset->GetKeyID(FName(Desc.Name));
+		const FBlackboardEntry* Entry = Asset->GetKey(KeyID);
+
+		if (KeyID == FBlackboard::InvalidKey || !Entry)
+		{
+			const FString Message = FString::Printf(TEXT("%s: key '%s' is missing"), *Asset->GetName(), Desc.Name);
+			if (ShouldWarn(Message))
+			{
+				UE_LOG(LogMecha, Warning, TEXT("[Blackboard] %s"), *Message);
+			}
+			continue;
+		}
+
+		if (!Entry->KeyType || !Entry->KeyType->IsA(Desc.KeyType()))
+		{
+			const FString Message = FString::Printf(TEXT("%s: key '%s' is %s, expected %s"),
+				*Asset->GetName(), Desc.Name, *GetNameSafe(Entry->KeyType ? Entry->KeyType->GetClass() : nullptr),
+				*Desc.KeyType()->GetName());
+			if (ShouldWarn(Message))
+			{
+				UE_LOG(LogMecha, Warning, TEXT("[Blackboard] %s"), *Message);
+			}
+			continue;
+		}
+
+		Resolved.*(Desc.Member) = KeyID;
+	}
+
+	return Resolved;
+}
+
+// ========================================
+// 타입별 설정
+// ========================================
+void FMechaBlackboardKeys::SetBool(UBlackboardComponent* Blackboard, FBlackboard::FKey Key, bool bValue)
+{
+	if (Blackboard && Key != FBlackboard::InvalidKey)
+	{
+		Blackboard->SetValue<UBlackboardKeyType_Bool>(Key, bValue);
+	}
+}
+
+void FMechaBlackboardKeys::SetVector(UBlackboardComponent* Blackboard, FBlackboard::FKey Key, const FVector& Value)
+{
+	if (Blackboard && Key != FBlackboard::InvalidKey)
+	{
+		Blackboard->SetValue<UBlackboardKeyType_Vector>(Key, Value);
+	}
+}
@@ -0,0 +1,41 @@
+// MechaBlackboardKeys.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BehaviorTree/BlackboardComponent.h"
+// 설명:
+// - 적 AI 블랙보드 키 ID 캐시. SetValueAsBool(TEXT("IsDashing")) 처럼 문자열 → FName → 키 선형 검색을
+//   매 호출마다 하는 대신, 빙의 시 한 번 FBlackboard::FKey로 해석해 둡니다.
+// - 키 몇 개의 검색이라 빙의마다 새로 해석합니다 (에셋 캐시를 두지 않으므로 에디터에서 키를 고치거나
+//   PIE를 다시 시작해도 옛 ID가 남지 않음).
+// - 해석 시 키가 없거나 타입이 다르면 에셋 이름과 함께 경고를 남깁니다 (같은 문제는 한 번만).
+//   그런 키는 InvalidKey로 남아 Set*가 아무것도 하지 않습니다.
+// - AEnemyAIController::OnPossess에서 해석해 컨트롤러가 복사본을 들고 있고, GetBlackboardKeys()로 꺼내 씁니다.
+// - 블랙보드에 키를 추가하면 여기 멤버와 .cpp 키 표에 같이 추가합니다.
+
+class UBlackboardData;
+
+struct PROJECT_MECHA_API FMechaBlackboardKeys
+{
+    // ===== 공통 =====
+    FBlackboard::FKey HomeLocation = FBlackboard::InvalidKey;   // Vector
+    FBlackboard::FKey IsDead = FBlackboard::InvalidKey;         // Bool
+
+    // ===== 전투 상태 =====
+    FBlackboard::FKey IsAttacking = FBlackboard::InvalidKey;
+    FBlackboard::FKey IsDashing = FBlackboard::InvalidKey;
+    FBlackboard::FKey ShouldDash = FBlackboard::InvalidKey;
+    FBlackboard::FKey InHookRange = FBlackboard::InvalidKey;
+    FBlackboard::FKey InUppercutRange = FBlackboard::InvalidKey;
+    FBlackboard::FKey InFireRange = FBlackboard::InvalidKey;
+
+    // ===== 보스 =====
+    FBlackboard::FKey IsUsingMissileRain = FBlackboard::InvalidKey;
+
+    // 에셋의 키 ID 해석 (에셋이 없으면 전부 InvalidKey)
+    static FMechaBlackboardKeys Resolve(const UBlackboardData* Asset);
+
+    // ===== 타입별 설정 (InvalidKey면 무시) =====
+    static void SetBool(UBlackboardComponent* Blackboard, FBlackboard::FKey Key, bool bValue);
+    static void SetVector(UBlackboardComponent* Blackboard, FBlackboard::FKey Key, const FVector& Value);
+};
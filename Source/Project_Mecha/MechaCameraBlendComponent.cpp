@@ -0,0 +1,219 @@
+// MechaCameraBlendComponent.cpp
+// 카메라 연출 요청(FOV/암 길이/오프셋) 우선순위 블렌딩 - 능력 타이머 대신 프레임당 1회 보간
+
+#include "MechaCameraBlendComponent.h"
+
+#include "Camera/CameraComponent.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/SpringArmComponent.h"
+
+namespace MechaCameraBlend
+{
+	// 목표값과 이 차이 이내면 맞추고 보간 종료
+	constexpr float SnapTolerance = 0.1f;
+}
+
+// ========================================
+// 생성자 / BeginPlay
+// ========================================
+UMechaCameraBlendComponent::UMechaCameraBlendComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+}
+
+void UMechaCameraBlendComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	CacheComponents();
+	CaptureBase();
+}
+
+void UMechaCameraBlendComponent::CacheComponents()
+{
+	AActor* Owner = GetOwner();
+	if (!Owner) return;
+
+	Camera = Owner->FindComponentByClass<UCameraComponent>();
+	SpringArm = Owner->FindComponentByClass<USpringArmComponent>();
+}
+
+void UMechaCameraBlendComponent::CaptureBase()
+{
+	if (Camera)
+	{
+		Channels[Channel_FOV].Base = Camera->FieldOfView;
+	}
+
+	if (SpringArm)
+	{
+		Channels[Channel_ArmLength].Base = SpringArm->TargetArmLength;
+		Channels[Channel_OffsetX].Base = SpringArm->TargetOffset.X;
+		Channels[Channel_OffsetY].Base = SpringArm->TargetOffset.Y;
+		Channels[Channel_OffsetZ].Base = SpringArm->TargetOffset.Z;
+	}
+
+	for (FChannel& Channel : Channels)
+	{
+		Channel.Current = Channel.Base;
+		Channel.Target = Channel.Base;
+	}
+}
+
+// ========================================
+// 요청 추가 / 제거
+// ========================================
+int32 UMechaCameraBlendComponent::PushRequest(const FMechaCameraBlendRequest& Request)
+{
+	if (!Camera && !SpringArm)
+	{
+		CacheComponents();
+	}
+
+	// 연출이 없던 상태면 지금 카메라 값을 복원 기준으로 사용
+	if (IsIdle())
+	{
+		CaptureBase();
+	}
+
+	FActiveRequest& Active = Requests.AddDefaulted_GetRef();
+	Active.Handle = NextHandle++;
+	Active.Order = NextOrder++;
+	Active.Data = Request;
+
+	ResolveTargets(-1.f);
+	SetComponentTickEnabled(true);
+
+	return Active.Handle;
+}
+
+void UMechaCameraBlendComponent::PopRequest(int32& Handle)
+{
+	const int32 Index = Requests.IndexOfByPredicate([Handle](const FActiveRequest& R) { return R.Handle == Handle; });
+	Handle = INDEX_NONE;
+
+	if (Index == INDEX_NONE) return;
+
+	const float BlendOutSpeed = Requests[Index].Data.BlendOutSpeed;
+	Requests.RemoveAt(Index);
+
+	ResolveTargets(BlendOutSpeed);
+	SetComponentTickEnabled(true);
+}
+
+// ========================================
+// 항목별 목표값 계산
+// ========================================
+void UMechaCameraBlendComponent::ResolveTargets(float FallbackBlendOutSpeed)
+{
+	// 항목별 승자 (우선순위 → 나중 요청)
+	const FActiveRequest* Winners[Channel_Num] = {};
+
+	auto Beats = [](const FActiveRequest& A, const FActiveRequest* B)
+	{
+		return !B || A.Data.Priority > B->Data.Priority || (A.Data.Priority == B->Data.Priority && A.Order > B->Order);
+	};
+
+	for (const FActiveRequest& R : Requests)
+	{
+		if (R.Data.bOverrideFOV && Beats(R, Winners[Channel_FOV]))
+		{
+			Winners[Channel_FOV] = &R;
+		}
+		if (R.Data.bOverrideArmLength && Beats(R, Winners[Channel_ArmLength]))
+		{
+			Winners[Channel_ArmLength] = &R;
+		}
+		if (R.Data.bOverrideOffset && Beats(R, Winners[Channel_OffsetX]))
+		{
+			Winners[Channel_OffsetX] = Winners[Channel_OffsetY] = Winners[Channel_OffsetZ] = &R;
+		}
+	}
+
+	for (int32 i = 0; i < Channel_Num; ++i)
+	{
+		FChannel& Channel = Channels[i];
+		const FActiveRequest* Winner = Winners[i];
+
+		if (!Winner)
+		{
+			// 요청이 빠진 항목만 복원 속도로 기본값 복귀
+			if (Channel.Target != Channel.Base && FallbackBlendOutSpeed > 0.f)
+			{
+				Channel.Speed = FallbackBlendOutSpeed;
+			}
+			Channel.Target = Channel.Base;
+			continue;
+		}
+
+		const FMechaCameraBlendRequest& Data = Winner->Data;
+		switch (i)
+		{
+		case Channel_FOV:       Channel.Target = Data.FOV; break;
+		case Channel_ArmLength: Channel.Target = Data.ArmLength; break;
+		case Channel_OffsetX:   Channel.Target = (float)Data.Offset.X; break;
+		case Channel_OffsetY:   Channel.Target = (float)Data.Offset.Y; break;
+		default:                Channel.Target = (float)Data.Offset.Z; break;
+		}
+		Channel.Speed = Data.BlendInSpeed;
+	}
+}
+
+// ========================================
+// 틱 - 실제 DeltaTime으로 보간, 모두 도달하면 틱 끔
+// ========================================
+void UMechaCameraBlendComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	for (FChannel& Channel : Channels)
+	{
+		if (Channel.IsSettled()) continue;
+
+		Channel.Current = FMath::FInterpTo(Channel.Current, Channel.Target, DeltaTime, Channel.Speed);
+		if (FMath::IsNearlyEqual(Channel.Current, Channel.Target, MechaCameraBlend::SnapTolerance))
+		{
+			Channel.Current = Channel.Target;
+		}
+	}
+
+	ApplyToCamera();
+
+	// 요청이 남아 있어도 목표에 도달했으면 다음 Push/Pop까지 틱 불필요
+	bool bAllSettled = true;
+	for (const FChannel& Channel : Channels)
+	{
+		bAllSettled &= Channel.IsSettled();
+	}
+
+	if (bAllSettled)
+	{
+		SetComponentTickEnabled(false);
+	}
+}
+
+void UMechaCameraBlendComponent::ApplyToCamera() const
+{
+	if (Camera)
+	{
+		Camera->SetFieldOfView(Channels[Channel_FOV].Current);
+	}
+
+	if (SpringArm)
+	{
+		SpringArm->TargetArmLength = Channels[Channel_ArmLength].Current;
+		SpringArm->TargetOffset = FVector(Channels[Channel_OffsetX].Current, Channels[Channel_OffsetY].Current, Channels[Channel_OffsetZ].Current);
+	}
+}
+
+bool UMechaCameraBlendComponent::IsIdle() const
+{
+	if (Requests.Num() > 0) return false;
+
+	for (const FChannel& Channel : Channels)
+	{
+		if (!Channel.IsSettled()) return false;
+	}
+	return true;
+}
@@ -0,0 +1,131 @@
+// MechaCameraBlendComponent.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+// 설명:
+// - 캐릭터 카메라 연출(FOV / 스프링암 길이 / 오프셋) 요청을 우선순위로 섞어 적용하는 컴포넌트.
+// - 능력(GA_Hover, GA_AssaultBoost 등)은 타이머를 직접 돌리지 않고 PushRequest / PopRequest만 호출합니다.
+// - 항목별로 우선순위가 가장 높은 요청(같으면 나중 요청)의 값을 목표로 하고,
+//   요청이 없으면 첫 요청 시점의 기본값으로 돌아갑니다.
+// - 카메라/스프링암 포인터는 BeginPlay에서 한 번만 찾고, 보간은 실제 프레임 DeltaTime으로 틱당 1회.
+//   모든 항목이 목표에 도달하면 틱을 끕니다.
+// - 오프셋은 SpringArm->TargetOffset에 적용합니다 (SocketOffset.Y는 QuickBoost 사이드 오프셋이 사용).
+#include "MechaCameraBlendComponent.generated.h"
+
+class UCameraComponent;
+class USpringArmComponent;
+
+// 카메라 연출 요청 1개
+USTRUCT(BlueprintType)
+struct FMechaCameraBlendRequest
+{
+    GENERATED_BODY()
+
+    // 높을수록 우선 (같으면 나중에 넣은 요청)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera")
+    int32 Priority = 0;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera")
+    bool bOverrideFOV = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera", meta = (EditCondition = "bOverrideFOV"))
+    float FOV = 90.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera")
+    bool bOverrideArmLength = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera", meta = (EditCondition = "bOverrideArmLength"))
+    float ArmLength = 400.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera")
+    bool bOverrideOffset = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera", meta = (EditCondition = "bOverrideOffset"))
+    FVector Offset = FVector::ZeroVector;
+
+    // 요청 값으로 전환 속도 (FInterpTo 속도, 높을수록 빠름)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera")
+    float BlendInSpeed = 5.f;
+
+    // 요청 제거 후 복원 속도
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera")
+    float BlendOutSpeed = 5.f;
+};
+
+UCLASS(ClassGroup = (Mecha), meta = (BlueprintSpawnableComponent))
+class PROJECT_MECHA_API UMechaCameraBlendComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UMechaCameraBlendComponent();
+
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+    // 요청 추가 (반환 핸들로 제거)
+    UFUNCTION(BlueprintCallable, Category = "Mecha|Camera")
+    int32 PushRequest(const FMechaCameraBlendRequest& Request);
+
+    // 요청 제거 (핸들은 INDEX_NONE으로 초기화)
+    UFUNCTION(BlueprintCallable, Category = "Mecha|Camera")
+    void PopRequest(UPARAM(ref) int32& Handle);
+
+    UFUNCTION(BlueprintPure, Category = "Mecha|Camera")
+    int32 GetNumRequests() const { return Requests.Num(); }
+
+protected:
+    virtual void BeginPlay() override;
+
+private:
+    struct FActiveRequest
+    {
+        int32 Handle = INDEX_NONE;
+        int32 Order = 0;
+        FMechaCameraBlendRequest Data;
+    };
+
+    // 보간 항목 1개의 상태 (FOV / 암 길이 / 오프셋 X,Y,Z 공통)
+    struct FChannel
+    {
+        float Base = 0.f;
+        float Current = 0.f;
+        float Target = 0.f;
+        float Speed = 5.f;
+
+        bool IsSettled() const { return Current == Target; }
+    };
+
+    enum EChannel : int32
+    {
+        Channel_FOV,
+        Channel_ArmLength,
+        Channel_OffsetX,
+        Channel_OffsetY,
+        Channel_OffsetZ,
+        Channel_Num
+    };
+
+    UPROPERTY()
+    TObjectPtr<UCameraComponent> Camera;
+
+    UPROPERTY()
+    TObjectPtr<USpringArmComponent> SpringArm;
+
+    TArray<FActiveRequest> Requests;
+    FChannel Channels[Channel_Num];
+
+    int32 NextHandle = 0;
+    int32 NextOrder = 0;
+
+    void CacheComponents();
+
+    // 현재 카메라 값을 기본값/현재값으로 다시 읽음 (요청이 없고 정지 상태일 때만)
+    void CaptureBase();
+
+    // 요청 목록으로부터 항목별 목표값/속도 다시 계산
+    void ResolveTargets(float FallbackBlendOutSpeed);
+
+    void ApplyToCamera() const;
+    bool IsIdle() const;
+};
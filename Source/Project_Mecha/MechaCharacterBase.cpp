@@ -2,6 +2,10 @@
 // 플레이어 메카 캐릭터 베이스 클래스 - GAS, 입력 처리, 락온, HUD
 
 #include "MechaCharacterBase.h"
+#include "MechaStats.h"
+#include "MechaCameraBlendComponent.h"
+#include "MechaMovementComponent.h"
+#include "MechaAttributeObserverComponent.h"
 
 #include "AbilitySystemComponent.h"
 #include "MechaAttributeSet.h"
@@ -20,6 +24,9 @@
 #include "Engine/Engine.h"
 #include "Engine/GameViewportClient.h"
 #include "MissionManager.h"
+#include "MechaCombatRegistrySubsystem.h"
+#include "MechaCrowdSubsystem.h"
+#include "MechaNativeTags.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Animation/AnimInstance.h"
@@ -29,11 +36,24 @@
 #include "Particles/ParticleSystemComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "HAL/IConsoleManager.h"
+
+// 할 일이 없을 때 액터 틱을 끌지 여부 (0이면 항상 틱, 비교 측정용)
+static TAutoConsoleVariable<int32> CVarMechaDisableIdleTick(
+    TEXT("Mecha.Character.DisableIdleTick"),
+    1,
+    TEXT("1: 락온/카메라 오프셋 보간이 없을 때 AMechaCharacterBase 틱을 끔. 0: 항상 틱. (다음 상태 변경 시 반영)"),
+    ECVF_Default);
+
+// 카메라 사이드 오프셋이 이 값 이내로 가까워지면 목표값으로 맞추고 보간 종료
+static constexpr float CameraSideOffsetSnapTolerance = 0.1f;
 
 // ========================================
 // 생성자
 // ========================================
-AMechaCharacterBase::AMechaCharacterBase()
+// 이동 컴포넌트를 UMechaMovementComponent로 교체 (호버 커스텀 이동 모드)
+AMechaCharacterBase::AMechaCharacterBase(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer.SetDefaultSubobjectClass<UMechaMovementComponent>(ACharacter::CharacterMovementComponentName))
 {
     PrimaryActorTick.bCanEverTick = true;
 
@@ -48,6 +68,8 @@ AMechaCharacterBase::AMechaCharacterBase()
     FollowCamera->SetupAttachment(SpringArm, USpringArmComponent::SocketName);
     FollowCamera->bUsePawnControlRotation = false;
 
+    CameraBlend = CreateDefaultSubobject<UMechaCameraBlendComponent>(TEXT("CameraBlend"));
+
     // ========== 이동 설정 ==========    
     auto Move = GetCharacterMovement();
     Move->bOrientRotationToMovement = true;  // 이동 방향으로 회전
@@ -62,7 +84,11 @@ AMechaCharacterBase::AMechaCharacterBase()
 
     // ========== GAS 초기화 ==========    
     AbilitySystem = CreateDefaultSubobject<UAbilitySystemComponent>(TEXT("AbilitySystem"));
+    AbilitySystem->SetIsReplicated(true);
+    // Mixed: GE는 소유 클라이언트에만, 태그/큐는 모두에게 복제
+    AbilitySystem->SetReplicationMode(EGameplayEffectReplicationMode::Mixed);
     AttributeSet = CreateDefaultSubobject<UMechaAttributeSet>(TEXT("AttributeSet"));
+    AttributeObserver = CreateDefaultSubobject<UMechaAttributeObserverComponent>(TEXT("AttributeObserver"));
 
     // ========== 총구 위치 컴포넌트 ==========    
     MuzzleLocation = CreateDefaultSubobject<USceneComponent>(TEXT("FireSocket"));
@@ -76,55 +102,62 @@ AMechaCharacterBase::AMechaCharacterBase()
 }
 
 // ========================================
-// Tick - 매 프레임 업데이트
+// Tick - 락온/카메라 보간 중에만 켜짐 (UpdateTickEnabled)
 // ========================================
 void AMechaCharacterBase::Tick(float DeltaSeconds)
 {
     Super::Tick(DeltaSeconds);
 
-    // ========== 이동 속도 배율 적용 ==========
-    UCharacterMovementComponent* BaseMove = GetCharacterMovement();
-    if (BaseMove && AttributeSet)
+    // 이동 속도 배율은 MoveSpeedMultiplier가 바뀔 때만 적용 (RefreshMaxWalkSpeed)
+    // 호버 유지 / 부스팅 최소 상승 속도는 UMechaMovementComponent가 이동 틱에서 처리
+
+    // ========== 락온 시 타겟 추적 ==========
+    if (bIsLockedOn && CurrentLockOnTarget)
     {
-        float BaseSpeed = 300.f;
-        float Multiplier = AttributeSet->GetMoveSpeedMultiplier();
-        BaseMove->MaxWalkSpeed = BaseSpeed * Multiplier;
+        UpdateLockOnView(DeltaSeconds);
     }
 
-    // ========== 호버링 상태 강제 유지 ==========
-    if (bIsHovering)
+    // ========== QuickBoost 카메라 사이드 오프셋 보간 (수렴 중일 때만) ==========
+    if (CurrentCameraSideOffset != TargetCameraSideOffset)
     {
-        if (auto* Move = GetCharacterMovement())
-        {
-            // Flying 모드가 아니면 강제로 전환
-            if (Move->MovementMode != MOVE_Flying)
-            {
-                Move->SetMovementMode(MOVE_Flying);
-                Move->GravityScale = 0.05f;
-            }
+        CurrentCameraSideOffset = FMath::FInterpTo(
+            CurrentCameraSideOffset,
+            TargetCameraSideOffset,
+            DeltaSeconds,
+            CameraSideOffsetInterpSpeed
+        );
 
-            // 부스팅 중에는 최소 상승 속도 유지
-            if (AbilitySystem && AbilitySystem->HasMatchingGameplayTag(Tag_Boosting))
-            {
-                Move->Velocity.Z = FMath::Max(Move->Velocity.Z, MinBoostVelocityZ);
-            }
+        if (FMath::IsNearlyEqual(CurrentCameraSideOffset, TargetCameraSideOffset, CameraSideOffsetSnapTolerance))
+        {
+            CurrentCameraSideOffset = TargetCameraSideOffset;
         }
+
+        ApplyCameraSideOffset();
     }
 
-    // ========== 락온 시 타겟 추적 ==========
-    if (bIsLockedOn && CurrentLockOnTarget)
+    // 할 일이 끝났으면 틱 끔
+    UpdateTickEnabled();
+}
+
+// ========================================
+// 틱 on/off - 락온 추적, 카메라 오프셋 보간 중 하나라도 있으면 켬
+// ========================================
+void AMechaCharacterBase::UpdateTickEnabled()
+{
+    const bool bNeedsTick =
+        bBlueprintTicks ||
+        CVarMechaDisableIdleTick.GetValueOnGameThread() == 0 ||
+        (bIsLockedOn && CurrentLockOnTarget) ||
+        CurrentCameraSideOffset != TargetCameraSideOffset;
+
+    if (IsActorTickEnabled() != bNeedsTick)
     {
-        UpdateLockOnView(DeltaSeconds);
+        SetActorTickEnabled(bNeedsTick);
     }
+}
 
-    // ========== QuickBoost 카메라 사이드 오프셋 보간 ==========
-    CurrentCameraSideOffset = FMath::FInterpTo(
-        CurrentCameraSideOffset,
-        TargetCameraSideOffset,
-        DeltaSeconds,
-        CameraSideOffsetInterpSpeed
-    );
-
+void AMechaCharacterBase::ApplyCameraSideOffset()
+{
     if (SpringArm)
     {
         FVector Offset = SpringArm->SocketOffset;
@@ -140,24 +173,20 @@ void AMechaCharacterBase::BeginPlay()
 {
     Super::BeginPlay();
 
+    // BP 이벤트 틱을 쓰는 자식 BP는 틱을 끄지 않음
+    bBlueprintTicks = GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(AMechaCharacterBase, ReceiveTick));
+
     // ASC 초기화
     InitASCOnce();
 
-    // ========== Enhanced Input 등록 ==========
-    if (APlayerController* PC = Cast<APlayerController>(GetController()))
+    // 전투 등록부에 등록 (적 미사일 타겟 검색용)
+    if (UMechaCombatRegistrySubsystem* Registry = UMechaCombatRegistrySubsystem::Get(this))
     {
-        if (UEnhancedInputLocalPlayerSubsystem* Subsys =
-            ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PC->GetLocalPlayer()))
-        {
-            if (DefaultMappingContext)
-            {
-                Subsys->AddMappingContext(DefaultMappingContext, 0);
-            }
-        }
+        Registry->RegisterCombatant(this, EMechaCombatTeam::Player);
     }
 
-    // ========== 스탯 초기화 ==========
-    if (AbilitySystem)
+    // ========== 스탯 초기화 (서버만, 결과는 Attribute 복제로 전달) ==========
+    if (AbilitySystem && HasAuthority())
     {
         FGameplayEffectContextHandle Ctx = AbilitySystem->MakeEffectContext();
         Ctx.AddSourceObject(this);
@@ -189,43 +218,93 @@ void AMechaCharacterBase::BeginPlay()
         }
     }
 
+    // ========== 입력 매핑 / HUD (로컬 플레이어만) ==========
+    SetupLocalPlayerView();
+
+    // 시작 시점에는 할 일이 없으면 바로 틱 끔
+    UpdateTickEnabled();
+}
+
+// ========================================
+// 빙의 변경 - ASC ActorInfo 갱신 + 로컬 플레이어 설정
+// ========================================
+void AMechaCharacterBase::NotifyControllerChanged()
+{
+    Super::NotifyControllerChanged();
+
+    // BeginPlay보다 빙의가 늦으면 ActorInfo의 PlayerController가 비어 있음
+    if (bASCInitialized && AbilitySystem)
+    {
+        AbilitySystem->RefreshAbilityActorInfo();
+    }
+
+    // BeginPlay 이전 빙의는 BeginPlay에서 처리
+    if (HasActorBegunPlay())
+    {
+        SetupLocalPlayerView();
+    }
+}
+
+// ========================================
+// 로컬 플레이어 전용 설정 - Enhanced Input 매핑 / HUD
+// ========================================
+void AMechaCharacterBase::SetupLocalPlayerView()
+{
+    if (!IsLocallyControlled()) return;
+
+    APlayerController* PC = Cast<APlayerController>(GetController());
+    if (!PC) return;
+
+    // ========== Enhanced Input 등록 ==========
+    if (UEnhancedInputLocalPlayerSubsystem* Subsys =
+        ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PC->GetLocalPlayer()))
+    {
+        if (DefaultMappingContext && !Subsys->HasMappingContext(DefaultMappingContext))
+        {
+            Subsys->AddMappingContext(DefaultMappingContext, 0);
+        }
+    }
+
     // ========== HUD 위젯 생성 및 초기화 ==========
-    if (APlayerController* PC = Cast<APlayerController>(GetController()))
+    if (HUDWidgetClass)
     {
-        if (HUDWidgetClass)
+        if (!MechaHUDWidget)
         {
-            if (!MechaHUDWidget)
-            {
-                // Mecha_HUD 위젯 생성
-                MechaHUDWidget = CreateWidget<UWBP_MechaHUD>(PC, HUDWidgetClass);
-            }
+            // Mecha_HUD 위젯 생성
+            MechaHUDWidget = CreateWidget<UWBP_MechaHUD>(PC, HUDWidgetClass);
+        }
 
-            if (MechaHUDWidget)
+        if (MechaHUDWidget)
+        {
+            // 뷰포트에 추가
+            if (!MechaHUDWidget->IsInViewport())
             {
-                // 뷰포트에 추가
-                if (!MechaHUDWidget->IsInViewport())
-                {
-                    MechaHUDWidget->AddToViewport();
-                }
-
-                // ASC와 AttributeSet 전달
-                const UMechaAttributeSet* Attrs =
-                    AbilitySystem ? AbilitySystem->GetSet<UMechaAttributeSet>() : nullptr;
+                MechaHUDWidget->AddToViewport();
+            }
 
-                MechaHUDWidget->InitWithASC(AbilitySystem, Attrs);
+            // ASC와 AttributeSet 전달
+            const UMechaAttributeSet* Attrs =
+                AbilitySystem ? AbilitySystem->GetSet<UMechaAttributeSet>() : nullptr;
 
-                // 초기 체력 바 설정
-                if (AttributeSet)
-                {
-                    const float H = AttributeSet->GetHealth();
-                    const float M = AttributeSet->GetMaxHealth();
-                    MechaHUDWidget->SetHealthPercent(M > 0.f ? H / M : 0.f);
-                }
-            }
+            // 초기 체력/탄약 표시도 InitWithASC에서 처리
+            MechaHUDWidget->InitWithASC(AbilitySystem, Attrs);
         }
     }
 }
 
+// ========================================
+// EndPlay - 전투 등록부에서 제거
+// ========================================
+void AMechaCharacterBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UMechaCombatRegistrySubsystem* Registry = UMechaCombatRegistrySubsystem::Get(this))
+    {
+        Registry->UnregisterCombatant(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
 // ========================================
 // ASC 한 번만 초기화
 // ========================================
@@ -244,10 +323,15 @@ void AMechaCharacterBase::InitASCOnce()
     AttributeSet = AbilitySystem ? const_cast<UMechaAttributeSet*>(AbilitySystem->GetSet<UMechaAttributeSet>()) : nullptr;
 
     // ========== 게임플레이 태그 캐싱 ==========
-    Tag_Boosting = FGameplayTag::RequestGameplayTag(TEXT("State.Boosting"));
-    Tag_Overheated = FGameplayTag::RequestGameplayTag(TEXT("State.Overheated"));
-    Tag_StateHovering = FGameplayTag::RequestGameplayTag(TEXT("State.Hovering"));
-    Tag_Attacking = FGameplayTag::RequestGameplayTag(TEXT("State.Attacking"));
+    Tag_Boosting = MechaTags::State_Boosting;
+    Tag_Overheated = MechaTags::State_Overheated;
+    Tag_StateHovering = MechaTags::State_Hovering;
+    Tag_Attacking = MechaTags::State_Attacking;
+
+    // 부스팅 태그가 붙고 떨어질 때만 이동 컴포넌트에 반영
+    BoostingTagChangedHandle =
+        AbilitySystem->RegisterGameplayTagEvent(Tag_Boosting, EGameplayTagEventType::NewOrRemoved)
+        .AddUObject(this, &AMechaCharacterBase::OnBoostingTagChanged);
 
     // ========== 기본 소유 태그 적용 ==========
     if (DefaultOwnedTags.Num() > 0)
@@ -255,7 +339,8 @@ void AMechaCharacterBase::InitASCOnce()
         AbilitySystem->AddLooseGameplayTags(DefaultOwnedTags);
     }
 
-    // ========== 시작 능력 부여 ==========
+    // ========== 시작 능력 부여 (서버만, 스펙은 소유 클라이언트로 복제) ==========
+    if (HasAuthority())
     {
         // 플레이어 캐릭터 BP 에 있는 StartupAbilities 인덱스로 능력 부여
         for (int32 i = 0; i < StartupAbilities.Num(); ++i)
@@ -269,11 +354,11 @@ void AMechaCharacterBase::InitASCOnce()
     }
 
     // ========== Attribute 변경 델리게이트 바인딩 ==========
-    // 이동 속도 변경
-    MoveSpeedChangedHandle =
-        AbilitySystem->GetGameplayAttributeValueChangeDelegate(AttributeSet->GetMoveSpeedAttribute())
-        .AddUObject(this, &AMechaCharacterBase::OnMoveSpeedChanged);
-    ApplyMoveSpeedToCharacter(AttributeSet->GetMoveSpeed());
+    // 이동 속도 배율 변경 (매 프레임 MaxWalkSpeed를 쓰는 대신 바뀔 때만 적용)
+    MoveSpeedMultiplierChangedHandle =
+        AbilitySystem->GetGameplayAttributeValueChangeDelegate(AttributeSet->GetMoveSpeedMultiplierAttribute())
+        .AddUObject(this, &AMechaCharacterBase::OnMoveSpeedMultiplierChanged);
+    RefreshMaxWalkSpeed();
 
     // 에너지 변경
     EnergyChangedHandle =
@@ -284,22 +369,28 @@ void AMechaCharacterBase::InitASCOnce()
     HealthChangedHandle =
         AbilitySystem->GetGameplayAttributeValueChangeDelegate(AttributeSet->GetHealthAttribute())
         .AddUObject(this, &AMechaCharacterBase::OnHealthChanged);
+
+    // HUD는 관찰 컴포넌트 스냅샷으로 프레임당 한 번만 갱신
+    if (AttributeObserver)
+    {
+        AttributeObserver->Observe(AbilitySystem);
+    }
 }
 
 // ========================================
 // Attribute 변경 콜백들
 // ========================================
-void AMechaCharacterBase::OnMoveSpeedChanged(const FOnAttributeChangeData& Data)
+void AMechaCharacterBase::OnMoveSpeedMultiplierChanged(const FOnAttributeChangeData& Data)
 {
-    ApplyMoveSpeedToCharacter(Data.NewValue);
+    RefreshMaxWalkSpeed();
 }
 
-void AMechaCharacterBase::ApplyMoveSpeedToCharacter(float NewSpeed)
+void AMechaCharacterBase::RefreshMaxWalkSpeed()
 {
-    if (auto* MoveComp = GetCharacterMovement())
-    {
-        MoveComp->MaxWalkSpeed = NewSpeed;
-    }
+    UCharacterMovementComponent* MoveComp = GetCharacterMovement();
+    if (!MoveComp || !AttributeSet) return;
+
+    MoveComp->MaxWalkSpeed = BaseWalkSpeed * AttributeSet->GetMoveSpeedMultiplier();
 }
 
 void AMechaCharacterBase::OnEnergyChanged(const FOnAttributeChangeData& Data)
@@ -421,7 +512,7 @@ void AMechaCharacterBase::Input_SprintStart(const FInputActionValue&)
 
     // ===== QuickBoost Ability 발동 =====
     FGameplayTagContainer QuickBoostTags;
-    QuickBoostTags.AddTag(FGameplayTag::RequestGameplayTag(TEXT("Ability.QuickBoost")));
+    QuickBoostTags.AddTag(MechaTags::Ability_QuickBoost);
     AbilitySystem->TryActivateAbilitiesByTag(QuickBoostTags);
 }
 
@@ -521,6 +612,11 @@ void AMechaCharacterBase::SetupPlayerInputComponent(UInputComponent* PlayerInput
         {
             EIC->BindAction(IA_LockOn, ETriggerEvent::Started, this, &AMechaCharacterBase::Input_LockOnToggle);
         }
+
+        if (IA_LockOnSwitch)
+        {
+            EIC->BindAction(IA_LockOnSwitch, ETriggerEvent::Triggered, this, &AMechaCharacterBase::Input_LockOnSwitch);
+        }
     }
 }
 
@@ -586,6 +682,19 @@ void AMechaCharacterBase::Input_LockOnToggle(const FInputActionValue&)
     ToggleLockOn();
 }
 
+void AMechaCharacterBase::Input_LockOnSwitch(const FInputActionValue& Value)
+{
+    const float Axis = Value.Get<float>();
+    if (FMath::Abs(Axis) < 0.5f) return;
+
+    // 축 입력이 유지되는 동안 매 프레임 전환되지 않도록 간격 제한
+    const float Now = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.f;
+    if (LastLockOnSwitchTime >= 0.f && Now - LastLockOnSwitchTime < LockOnSwitchCooldown) return;
+
+    LastLockOnSwitchTime = Now;
+    SwitchLockOnTarget(Axis > 0.f ? 1 : -1);
+}
+
 // ========================================
 // 호버링 상태 설정
 // ========================================
@@ -594,26 +703,36 @@ void AMechaCharacterBase::SetHovering(bool bNewHover)
     bIsHovering = bNewHover;
 }
 
+UMechaMovementComponent* AMechaCharacterBase::GetMechaMovement() const
+{
+    return Cast<UMechaMovementComponent>(GetCharacterMovement());
+}
+
+void AMechaCharacterBase::StartQuickBoostMove()
+{
+    if (UMechaMovementComponent* MechaMove = GetMechaMovement())
+    {
+        MechaMove->StartQuickBoost(LaunchXY, LaunchZ, QuickBoostMoveDuration);
+    }
+}
+
+void AMechaCharacterBase::OnBoostingTagChanged(const FGameplayTag Tag, int32 NewCount)
+{
+    if (UMechaMovementComponent* MechaMove = GetMechaMovement())
+    {
+        MechaMove->SetHoverBoostFloor(NewCount > 0, MinBoostVelocityZ);
+    }
+}
+
 // ========================================
-// 체력 변경 콜백 - HUD 업데이트 및 데미지 연출
+// 체력 변경 콜백 - 사망 판정
+// (HUD 체력 바/피격 연출은 AttributeObserver 스냅샷으로 프레임당 한 번)
 // ========================================
 void AMechaCharacterBase::OnHealthChanged(const FOnAttributeChangeData& Data)
 {
-    if (!MechaHUDWidget || !AttributeSet) return;
+    if (!AttributeSet) return;
 
-    const float OldHealth = Data.OldValue;
     const float NewHealth = Data.NewValue;
-    const float MaxHealth = AttributeSet->GetMaxHealth();
-
-    // 체력 바 업데이트
-    MechaHUDWidget->SetHealthPercent(MaxHealth > 0.f ? NewHealth / MaxHealth : 0.f);
-
-    // 피격 시 화면 테두리 연출
-    if (NewHealth < OldHealth)
-    {
-        const float Damage = OldHealth - NewHealth;
-        MechaHUDWidget->PlayDamageOverlay(Damage);
-    }
 
     // 이미 죽었으면 더 처리 안 함
     if (bIsDead)
@@ -630,7 +749,7 @@ void AMechaCharacterBase::OnHealthChanged(const FOnAttributeChangeData& Data)
         if (AbilitySystem)
         {
             AbilitySystem->AddLooseGameplayTag(
-                FGameplayTag::RequestGameplayTag(TEXT("State.Dead"))
+                MechaTags::State_Dead
             );
         }
 
@@ -659,6 +778,12 @@ bool AMechaCharacterBase::IsOverheated() const
 // ========================================
 void AMechaCharacterBase::HandleDeath()
 {
+    // ========== 전투 등록부에서 제거 ==========
+    if (UMechaCombatRegistrySubsystem* Registry = UMechaCombatRegistrySubsystem::Get(this))
+    {
+        Registry->UnregisterCombatant(this);
+    }
+
     // ========== 입력 비활성화 ==========
     if (APlayerController* PC = Cast<APlayerController>(GetController()))
     {
@@ -748,7 +873,7 @@ void AMechaCharacterBase::HandleDeath()
 void AMechaCharacterBase::ShowGameOverScreen()
 {
     APlayerController* PC = Cast<APlayerController>(GetController());
-    if (!PC)
+    if (!PC || !PC->IsLocalController())
     {
         return;
     }
@@ -814,6 +939,8 @@ void AMechaCharacterBase::ToggleLockOn()
         bUseControllerRotationYaw = true;
         MoveComp->bOrientRotationToMovement = false;
     }
+
+    UpdateTickEnabled();
 }
 
 // 락온 해제
@@ -828,57 +955,104 @@ void AMechaCharacterBase::ClearLockOn()
         bUseControllerRotationYaw = bSavedUseControllerRotationYaw;
         MoveComp->bOrientRotationToMovement = bSavedOrientRotationToMovement;
     }
+
+    UpdateTickEnabled();
 }
 
-// 락온 타겟 찾기
+// 락온 타겟 찾기 (가중치 점수가 가장 높은 적)
 AActor* AMechaCharacterBase::FindLockOnTarget()
 {
-    UWorld* World = GetWorld();
-    if (!World) return nullptr;
+    SCOPE_CYCLE_COUNTER(STAT_Mecha_LockOnQuery);
+
+    FMechaLockOnQuery Query;
+    if (ScoreLockOnCandidates(Query))
+    {
+        const int32 Best = FMechaLockOnScorer::PickBest(LockOnScores);
+        if (Best != INDEX_NONE)
+        {
+            return LockOnCandidates.Actors[Best].Get();
+        }
+    }
+
+    // 액터 후보가 없으면 시야 안의 군중 개체를 액터로 승격해서 락온
+    if (UMechaCrowdSubsystem* Crowd = UMechaCrowdSubsystem::Get(this))
+    {
+        const FRotator ViewRot = Controller ? Controller->GetControlRotation() : GetActorRotation();
+        return Crowd->PromoteForLockOn(GetActorLocation(), FRotator(0.f, ViewRot.Yaw, 0.f).Vector(), LockOnMaxDistance, LockOnMaxAngle);
+    }
+    return nullptr;
+}
+
+// 주변 적 수집 + 점수 계산 (월드 전체가 아니라 공간 해시로 반경 안만 조회)
+bool AMechaCharacterBase::ScoreLockOnCandidates(FMechaLockOnQuery& OutQuery)
+{
+    UMechaCombatRegistrySubsystem* Registry = UMechaCombatRegistrySubsystem::Get(this);
+    if (!Registry) return false;
 
-    FVector MyLocation = GetActorLocation();
+    // ========== 조건: 플레이어 시점 방향 / 카메라 ==========
+    const FRotator ViewRot = Controller ? Controller->GetControlRotation() : GetActorRotation();
 
-    // 플레이어 시점 방향
-    FRotator ViewRot = Controller ? Controller->GetControlRotation() : GetActorRotation();
-    FRotator YawRot(0.f, ViewRot.Yaw, 0.f);
-    FVector  Forward = YawRot.Vector();
+    OutQuery.Origin = GetActorLocation();
+    OutQuery.Forward = FRotator(0.f, ViewRot.Yaw, 0.f).Vector();
+    OutQuery.MaxDistance = LockOnMaxDistance;
+    OutQuery.MaxAngleDeg = LockOnMaxAngle;
+    OutQuery.Weights = LockOnWeights;
+
+    FVector  CamLoc;
+    FRotator CamRot;
+    if (Controller)
+    {
+        Controller->GetPlayerViewPoint(CamLoc, CamRot);
+    }
+    else
+    {
+        GetActorEyesViewPoint(CamLoc, CamRot);
+    }
+    OutQuery.ViewLocation = CamLoc;
+    OutQuery.ViewForward = CamRot.Vector();
+    OutQuery.ViewRight = FRotationMatrix(CamRot).GetUnitAxis(EAxis::Y);
 
-    // ========== 후보 수집 (EnemyMecha만) ==========
-    TArray<AActor*> Candidates;
-    UGameplayStatics::GetAllActorsOfClass(World, AEnemyMecha::StaticClass(), Candidates);
+    // ========== 후보 수집 (반경만, 시야각은 점수 계산에서 컬링) ==========
+    TArray<int32> Nearby;
+    Registry->QueryRadiusEntries(EMechaCombatTeam::Enemy, OutQuery.Origin, LockOnMaxDistance, Nearby);
 
-    float   BestDistSq = TNumericLimits<float>::Max();
-    AActor* BestTarget = nullptr;
+    const TArray<FMechaCombatEntry>& Entries = Registry->GetEntries();
 
-    // ========== 거리 및 각도 체크 ==========
-    for (AActor* Candidate : Candidates)
+    LockOnCandidates.Reset();
+    for (const int32 EntryIndex : Nearby)
     {
+        const FMechaCombatEntry& Entry = Entries[EntryIndex];
+        AActor* Candidate = Entry.Actor.Get();
         if (!Candidate || Candidate == this) continue;
 
-        FVector ToTarget = Candidate->GetActorLocation() - MyLocation;
-        float   DistSq = ToTarget.SizeSquared();
+        LockOnCandidates.Add(Candidate, Entry.Location, Entry.bIsBoss ? 1.f : 0.f);
+    }
 
-        // 최대 거리 체크
-        if (DistSq > FMath::Square(LockOnMaxDistance))
-            continue;
+    // ========== 점수 계산 ==========
+    FMechaLockOnScorer::ScoreSIMD(OutQuery, LockOnCandidates, LockOnScores, LockOnSides);
+    return LockOnCandidates.Num() > 0;
+}
 
-        // 시야 각도 체크
-        FVector Dir = ToTarget.GetSafeNormal();
-        float   Dot = FVector::DotProduct(Forward, Dir);
-        float   AngleDeg = FMath::RadiansToDegrees(FMath::Acos(FMath::Clamp(Dot, -1.f, 1.f)));
+// 소프트 락: 현재 타겟 기준 좌/우의 다음 타겟으로 전환
+void AMechaCharacterBase::SwitchLockOnTarget(int32 Direction)
+{
+    if (!bIsLockedOn || !CurrentLockOnTarget) return;
 
-        if (AngleDeg > LockOnMaxAngle)
-            continue;
+    FMechaLockOnQuery Query;
+    if (!ScoreLockOnCandidates(Query)) return;
 
-        // 가장 가까운 타겟 선택
-        if (DistSq < BestDistSq)
-        {
-            BestDistSq = DistSq;
-            BestTarget = Candidate;
-        }
-    }
+    const int32 CurrentIndex = LockOnCandidates.Actors.IndexOfByKey(CurrentLockOnTarget);
+    const float CurrentSide = (CurrentIndex != INDEX_NONE)
+        ? LockOnSides[CurrentIndex]
+        : FMechaLockOnScorer::ComputeSide(Query, CurrentLockOnTarget->GetActorLocation());
+
+    const int32 Next = FMechaLockOnScorer::PickNeighbour(LockOnScores, LockOnSides, CurrentSide, Direction, CurrentIndex);
+    if (Next == INDEX_NONE) return;
 
-    return BestTarget;
+    if (AActor* NewTarget = LockOnCandidates.Actors[Next].Get())
+    {
+        CurrentLockOnTarget = NewTarget;
+    }
 }
 
 // 락온 시 카메라 타겟 추적
@@ -1003,10 +1177,12 @@ void AMechaCharacterBase::StartQuickBoostCameraShift(float DirectionSign)
     // DirectionSign: +1 (오른쪽 퀵부스트), -1 (왼쪽 퀵부스트)
     // 카메라는 반대 방향으로 이동
     TargetCameraSideOffset = -DirectionSign * CameraSideOffsetAmount;
+    UpdateTickEnabled();
 }
 
 void AMechaCharacterBase::EndQuickBoostCameraShift()
 {
     // 카메라를 다시 중앙으로
     TargetCameraSideOffset = 0.f;
+    UpdateTickEnabled();
 }
@@ -10,6 +10,7 @@
 #include "GameplayEffectTypes.h"
 #include "InputActionValue.h"
 #include "Blueprint/UserWidget.h"
+#include "MechaLockOnScorer.h"
 #include "MechaCharacterBase.generated.h"
 
 class UAbilitySystemComponent;
@@ -24,6 +25,9 @@ class UWBP_MechaHUD;
 class USceneComponent;
 class UAnimMontage;
 class UParticleSystemComponent;
+class UMechaCameraBlendComponent;
+class UMechaMovementComponent;
+class UMechaAttributeObserverComponent;
 struct FOnAttributeChangeData;
 
 UENUM(BlueprintType)
@@ -54,19 +58,40 @@ class PROJECT_MECHA_API AMechaCharacterBase : public ACharacter, public IAbility
 {
     GENERATED_BODY()
 
+    // 벤치마크 봇이 플레이어 입력 함수/락온 상태를 직접 사용
+    friend class UMechaBenchmarkSubsystem;
+
 public:
-    AMechaCharacterBase();
+    AMechaCharacterBase(const FObjectInitializer& ObjectInitializer);
 
     virtual UAbilitySystemComponent* GetAbilitySystemComponent() const override { return AbilitySystem; }
 
     UFUNCTION(BlueprintCallable, Category = "GAS")
     UMechaAttributeSet* GetMechaAttributeSet() const { return AttributeSet; }
 
+    UFUNCTION(BlueprintPure, Category = "Camera")
+    UMechaCameraBlendComponent* GetCameraBlend() const { return CameraBlend; }
+
+    UFUNCTION(BlueprintPure, Category = "LockOn")
+    AActor* GetLockOnTarget() const { return CurrentLockOnTarget; }
+
+    // 호버 등 커스텀 이동 모드를 처리하는 이동 컴포넌트
+    UFUNCTION(BlueprintPure, Category = "Movement")
+    UMechaMovementComponent* GetMechaMovement() const;
+
+    // 퀵부스트 이동 (LaunchXY/LaunchZ, 입력 방향). QuickBoost 능력 BP에서 LaunchCharacter 대신 호출
+    UFUNCTION(BlueprintCallable, Category = "QuickBoost")
+    void StartQuickBoostMove();
+
     // 라이프사이클/입력 바인딩
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void Tick(float DeltaSeconds) override;
     virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
 
+    // 빙의/해제 (서버 PossessedBy, 클라이언트 OnRep_Controller 양쪽에서 호출)
+    virtual void NotifyControllerChanged() override;
+
 protected:
 
     // ---- Components ----
@@ -76,12 +101,20 @@ protected:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Camera")
     UCameraComponent* FollowCamera;
 
+    // 능력 카메라 연출(FOV/암 길이) 블렌딩
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Camera")
+    UMechaCameraBlendComponent* CameraBlend;
+
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GAS")
     UAbilitySystemComponent* AbilitySystem;
 
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GAS")
     UMechaAttributeSet* AttributeSet;
 
+    // HUD용 Attribute 변경 합치기 (프레임당 스냅샷 1회)
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GAS")
+    UMechaAttributeObserverComponent* AttributeObserver;
+
     // ---- Overheat Particle System ----
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "VFX")
     UParticleSystemComponent* OverheatParticleComponent;
@@ -111,6 +144,9 @@ protected:
     // 락온 입력 액션 (마우스 휠 버튼)
     UPROPERTY(EditDefaultsOnly, Category = "Input") UInputAction* IA_LockOn;
 
+    // 락온 타겟 좌우 전환 (1D 축: + 오른쪽 / - 왼쪽)
+    UPROPERTY(EditDefaultsOnly, Category = "Input") UInputAction* IA_LockOnSwitch;
+
     // AbilitySystemComponent 별칭
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GAS")
     UAbilitySystemComponent* ASC = nullptr;
@@ -129,6 +165,9 @@ protected:
     // 락온 토글 입력
     UFUNCTION() void Input_LockOnToggle(const FInputActionValue& Value);
 
+    // 락온 타겟 좌우 전환 입력
+    UFUNCTION() void Input_LockOnSwitch(const FInputActionValue& Value);
+
 public:
 
     UPROPERTY()
@@ -239,9 +278,21 @@ private:
     bool bASCInitialized = false;
 
     // Attribute 반응
-    FDelegateHandle MoveSpeedChangedHandle;
-    void OnMoveSpeedChanged(const FOnAttributeChangeData& Data);
-    void ApplyMoveSpeedToCharacter(float NewSpeed);
+    // 이동 속도: MaxWalkSpeed = BaseWalkSpeed * MoveSpeedMultiplier (배율이 바뀔 때만 적용)
+    FDelegateHandle MoveSpeedMultiplierChangedHandle;
+    void OnMoveSpeedMultiplierChanged(const FOnAttributeChangeData& Data);
+    void RefreshMaxWalkSpeed();
+
+    UPROPERTY(EditDefaultsOnly, Category = "Movement")
+    float BaseWalkSpeed = 300.f;
+
+    // 틱 on/off (락온/카메라 보간이 없으면 액터 틱을 끔)
+    bool bBlueprintTicks = false;
+    void UpdateTickEnabled();
+    void ApplyCameraSideOffset();
+
+    // 로컬 플레이어 전용 설정 (입력 매핑 / HUD). 데디케이티드 서버와 다른 클라이언트의 프록시에서는 건너뜀
+    void SetupLocalPlayerView();
 
     FDelegateHandle EnergyChangedHandle;
     void OnEnergyChanged(const FOnAttributeChangeData& Data);
@@ -262,6 +313,10 @@ private:
     FGameplayTag Tag_Overheated;
     FGameplayTag Tag_StateHovering;
 
+    // 부스팅 태그 변화 → 호버 최소 상승 속도 on/off (이동 컴포넌트가 적분)
+    FDelegateHandle BoostingTagChangedHandle;
+    void OnBoostingTagChanged(const FGameplayTag Tag, int32 NewCount);
+
     // QuickBoost 튜닝
     UPROPERTY(EditDefaultsOnly, Category = "QuickBoost")
     float LaunchXY = 1500.f;
@@ -269,6 +324,10 @@ private:
     UPROPERTY(EditDefaultsOnly, Category = "QuickBoost")
     float LaunchZ = 200.f;
 
+    // 퀵부스트 이동 유지 시간 (이후 관성 낙하)
+    UPROPERTY(EditDefaultsOnly, Category = "QuickBoost")
+    float QuickBoostMoveDuration = 0.15f;
+
     // 부스팅 중 최소 상승 속도 (Z축)
     UPROPERTY(EditDefaultsOnly, Category = "QuickBoost")
     float MinBoostVelocityZ = 100.f;
@@ -331,6 +390,21 @@ private:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LockOn", meta = (AllowPrivateAccess = "true"))
     float LockOnMaxAngle = 60.0f;
 
+    // 타겟 선택 점수 가중치 (거리 / 화면 중앙 / 보스 우선)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LockOn", meta = (AllowPrivateAccess = "true"))
+    FMechaLockOnWeights LockOnWeights;
+
+    // 좌우 전환 입력 최소 간격 (축 입력 연속 전환 방지)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LockOn", meta = (AllowPrivateAccess = "true"))
+    float LockOnSwitchCooldown = 0.25f;
+
+    float LastLockOnSwitchTime = -1.f;
+
+    // 점수 계산용 후보/결과 버퍼 (재할당 방지용으로 유지)
+    FMechaLockOnCandidates LockOnCandidates;
+    TArray<float> LockOnScores;
+    TArray<float> LockOnSides;
+
     // 락온 ON/OFF 때 기존 이동 회전 설정 기억
     bool bSavedUseControllerRotationYaw = false;
     bool bSavedOrientRotationToMovement = true;
@@ -339,5 +413,7 @@ private:
     void ToggleLockOn();
     void ClearLockOn();
     AActor* FindLockOnTarget();
+    bool ScoreLockOnCandidates(FMechaLockOnQuery& OutQuery);
+    void SwitchLockOnTarget(int32 Direction);
     void UpdateLockOnView(float DeltaTime);
 };
@@ -0,0 +1,243 @@
+// MechaCombatRegistrySubsystem.cpp
+// 전투 참가자 등록부 - 살아 있는 적/플레이어 목록과 위치 캐시, 타겟 검색
+
+#include "MechaCombatRegistrySubsystem.h"
+#include "MechaStats.h"
+
+#include "MissionManager.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+// ========================================
+// 접근자 / 수명
+// ========================================
+UMechaCombatRegistrySubsystem* UMechaCombatRegistrySubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine || !WorldContextObject) return nullptr;
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UMechaCombatRegistrySubsystem>() : nullptr;
+}
+
+bool UMechaCombatRegistrySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UMechaCombatRegistrySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMechaCombatRegistrySubsystem, STATGROUP_Tickables);
+}
+
+void UMechaCombatRegistrySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	SpatialHash.Reset(SpatialCellSize);
+}
+
+void UMechaCombatRegistrySubsystem::Deinitialize()
+{
+	Entries.Empty();
+	IndexByActor.Empty();
+	SpatialHash.Reset(SpatialCellSize);
+	MissionManager = nullptr;
+
+	Super::Deinitialize();
+}
+
+// ========================================
+// 매 프레임 - 위치 캐시/공간 해시 갱신, 사라진 액터 정리
+// ========================================
+void UMechaCombatRegistrySubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	for (int32 i = Entries.Num() - 1; i >= 0; --i)
+	{
+		AActor* Actor = Entries[i].Actor.Get();
+		if (!IsValid(Actor))
+		{
+			RemoveAtSwapIndex(i);
+			continue;
+		}
+
+		// 셀이 바뀐 경우에만 해시 재배치
+		Entries[i].Location = Actor->GetActorLocation();
+		SpatialHash.Update(Entries[i].SpatialId, Entries[i].Location);
+	}
+}
+
+// ========================================
+// 등록 / 해제
+// ========================================
+void UMechaCombatRegistrySubsystem::RegisterCombatant(AActor* Actor, EMechaCombatTeam Team, bool bIsBoss)
+{
+	if (!IsValid(Actor)) return;
+
+	// 이미 등록된 경우 정보만 갱신
+	if (const int32* Existing = IndexByActor.Find(Actor))
+	{
+		FMechaCombatEntry& Entry = Entries[*Existing];
+		Entry.Team = Team;
+		Entry.bIsBoss = bIsBoss;
+		Entry.Location = Actor->GetActorLocation();
+		SpatialHash.Update(Entry.SpatialId, Entry.Location);
+		return;
+	}
+
+	FMechaCombatEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.Actor = Actor;
+	Entry.Key = Actor;
+	Entry.Location = Actor->GetActorLocation();
+	Entry.Team = Team;
+	Entry.bIsBoss = bIsBoss;
+
+	const int32 NewIndex = Entries.Num() - 1;
+	Entry.SpatialId = SpatialHash.Add(Entry.Location, NewIndex);
+	IndexByActor.Add(Actor, NewIndex);
+}
+
+void UMechaCombatRegistrySubsystem::UnregisterCombatant(AActor* Actor)
+{
+	if (!Actor) return;
+
+	if (const int32* Index = IndexByActor.Find(Actor))
+	{
+		RemoveAtSwapIndex(*Index);
+	}
+}
+
+void UMechaCombatRegistrySubsystem::RemoveAtSwapIndex(int32 Index)
+{
+	if (!Entries.IsValidIndex(Index)) return;
+
+	IndexByActor.Remove(Entries[Index].Key);
+	SpatialHash.Remove(Entries[Index].SpatialId);
+
+	const int32 LastIndex = Entries.Num() - 1;
+	if (Index != LastIndex)
+	{
+		Entries[Index] = MoveTemp(Entries[LastIndex]);
+		IndexByActor.Add(Entries[Index].Key, Index);
+		SpatialHash.SetUserIndex(Entries[Index].SpatialId, Index);
+	}
+	Entries.RemoveAt(LastIndex, 1, false);
+}
+
+void UMechaCombatRegistrySubsystem::RegisterMissionManager(AMissionManager* Manager)
+{
+	if (!Manager) return;
+
+	MissionManager = Manager;
+}
+
+void UMechaCombatRegistrySubsystem::UnregisterMissionManager(AMissionManager* Manager)
+{
+	if (MissionManager.Get() == Manager)
+	{
+		MissionManager = nullptr;
+	}
+}
+
+// ========================================
+// 조회
+// ========================================
+void UMechaCombatRegistrySubsystem::GetCombatants(EMechaCombatTeam Team, TArray<AActor*>& OutActors) const
+{
+	OutActors.Reset();
+
+	for (const FMechaCombatEntry& Entry : Entries)
+	{
+		if (Entry.Team != Team) continue;
+
+		if (AActor* Actor = Entry.Actor.Get())
+		{
+			OutActors.Add(Actor);
+		}
+	}
+}
+
+AActor* UMechaCombatRegistrySubsystem::FindNearest(EMechaCombatTeam Team, const FVector& Origin, float MaxDistance, const AActor* IgnoreActor) const
+{
+	TArray<int32> Found;
+	QueryKNearestEntries(Team, Origin, 1, MaxDistance, Found, IgnoreActor);
+
+	return Found.Num() > 0 ? Entries[Found[0]].Actor.Get() : nullptr;
+}
+
+void UMechaCombatRegistrySubsystem::QueryRadius(EMechaCombatTeam Team, const FVector& Origin, float Radius, TArray<AActor*>& OutActors) const
+{
+	TArray<int32> Found;
+	QueryRadiusEntries(Team, Origin, Radius, Found);
+	EntriesToActors(Found, OutActors);
+}
+
+void UMechaCombatRegistrySubsystem::QueryKNearest(EMechaCombatTeam Team, const FVector& Origin, int32 K, float MaxDistance, TArray<AActor*>& OutActors) const
+{
+	TArray<int32> Found;
+	QueryKNearestEntries(Team, Origin, K, MaxDistance, Found);
+	EntriesToActors(Found, OutActors);
+}
+
+void UMechaCombatRegistrySubsystem::QueryRadiusEntries(EMechaCombatTeam Team, const FVector& Origin, float Radius, TArray<int32>& OutEntryIndices) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_Mecha_TargetQuery);
+
+	SpatialHash.QueryRadius(Origin, Radius, OutEntryIndices, [this, Team](int32 EntryIndex)
+		{
+			return Entries[EntryIndex].Team == Team && Entries[EntryIndex].Actor.IsValid();
+		});
+}
+
+void UMechaCombatRegistrySubsystem::QueryConeEntries(EMechaCombatTeam Team, const FVector& Origin, const FVector& Direction, float Radius, float MaxAngleDeg, TArray<int32>& OutEntryIndices) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_Mecha_TargetQuery);
+
+	const float CosHalfAngle = FMath::Cos(FMath::DegreesToRadians(MaxAngleDeg));
+
+	SpatialHash.QueryCone(Origin, Direction, Radius, CosHalfAngle, OutEntryIndices, [this, Team](int32 EntryIndex)
+		{
+			return Entries[EntryIndex].Team == Team && Entries[EntryIndex].Actor.IsValid();
+		});
+}
+
+void UMechaCombatRegistrySubsystem::QueryKNearestEntries(EMechaCombatTeam Team, const FVector& Origin, int32 K, float MaxDistance, TArray<int32>& OutEntryIndices, const AActor* IgnoreActor) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_Mecha_TargetQuery);
+
+	SpatialHash.QueryKNearest(Origin, K, MaxDistance, OutEntryIndices, [this, Team, IgnoreActor](int32 EntryIndex)
+		{
+			const FMechaCombatEntry& Entry = Entries[EntryIndex];
+			if (Entry.Team != Team) return false;
+
+			const AActor* Actor = Entry.Actor.Get();
+			return Actor && Actor != IgnoreActor;
+		});
+}
+
+void UMechaCombatRegistrySubsystem::EntriesToActors(const TArray<int32>& EntryIndices, TArray<AActor*>& OutActors) const
+{
+	OutActors.Reset(EntryIndices.Num());
+
+	for (const int32 EntryIndex : EntryIndices)
+	{
+		if (AActor* Actor = Entries[EntryIndex].Actor.Get())
+		{
+			OutActors.Add(Actor);
+		}
+	}
+}
+
+int32 UMechaCombatRegistrySubsystem::GetNumCombatants(EMechaCombatTeam Team) const
+{
+	int32 Count = 0;
+	for (const FMechaCombatEntry& Entry : Entries)
+	{
+		if (Entry.Team == Team)
+		{
+			++Count;
+		}
+	}
+	return Count;
+}
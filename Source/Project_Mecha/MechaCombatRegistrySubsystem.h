@@ -0,0 +1,123 @@
+// MechaCombatRegistrySubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "MechaSpatialHash.h"
+// 설명:
+// - 전투 참가자(플레이어/적) 등록부.
+// - 적은 BeginPlay에서 등록, 사망(HandleDeath)/EndPlay에서 해제됩니다.
+// - 살아 있는 참가자만 연속 배열에 보관하고 위치/팀/보스 여부를 캐시합니다.
+//   (위치는 매 프레임 한 번 갱신)
+// - 락온/미사일 타겟 검색은 GetAllActorsOfClass 대신 이 등록부를 사용합니다.
+//   반경/원뿔/K-최근접 조회는 공간 해시(FMechaSpatialHash)로 주변 셀만 확인합니다.
+// - 미션 매니저도 여기에 등록되어 적이 월드 검색 없이 찾을 수 있습니다.
+#include "MechaCombatRegistrySubsystem.generated.h"
+
+class AMissionManager;
+
+UENUM(BlueprintType)
+enum class EMechaCombatTeam : uint8
+{
+    Player  UMETA(DisplayName = "Player"),
+    Enemy   UMETA(DisplayName = "Enemy")
+};
+
+// 등록된 전투 참가자 (캐시 데이터)
+struct FMechaCombatEntry
+{
+    TWeakObjectPtr<AActor> Actor;
+
+    // 액터가 이미 파괴된 뒤에도 인덱스 맵에서 지울 수 있도록 키를 따로 보관
+    TObjectKey<AActor> Key;
+
+    // 이번 프레임 캐시 위치
+    FVector Location = FVector::ZeroVector;
+
+    // 공간 해시 항목 ID
+    int32 SpatialId = INDEX_NONE;
+
+    EMechaCombatTeam Team = EMechaCombatTeam::Enemy;
+    bool bIsBoss = false;
+};
+
+UCLASS(Config = Game)
+class PROJECT_MECHA_API UMechaCombatRegistrySubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    static UMechaCombatRegistrySubsystem* Get(const UObject* WorldContextObject);
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // ===== 등록 / 해제 =====
+    void RegisterCombatant(AActor* Actor, EMechaCombatTeam Team, bool bIsBoss = false);
+    void UnregisterCombatant(AActor* Actor);
+
+    void RegisterMissionManager(AMissionManager* Manager);
+    void UnregisterMissionManager(AMissionManager* Manager);
+
+    UFUNCTION(BlueprintPure, Category = "Mecha|Combat")
+    AMissionManager* GetMissionManager() const { return MissionManager.Get(); }
+
+    // ===== 조회 =====
+    // 살아 있는 참가자 전체 (연속 배열, 순서는 보장하지 않음)
+    const TArray<FMechaCombatEntry>& GetEntries() const { return Entries; }
+
+    UFUNCTION(BlueprintCallable, Category = "Mecha|Combat")
+    void GetCombatants(EMechaCombatTeam Team, TArray<AActor*>& OutActors) const;
+
+    // Origin에서 가장 가까운 참가자 (MaxDistance <= 0이면 거리 제한 없음)
+    UFUNCTION(BlueprintCallable, Category = "Mecha|Combat")
+    AActor* FindNearest(EMechaCombatTeam Team, const FVector& Origin, float MaxDistance = 0.f, const AActor* IgnoreActor = nullptr) const;
+
+    // Radius 이내의 참가자
+    UFUNCTION(BlueprintCallable, Category = "Mecha|Combat")
+    void QueryRadius(EMechaCombatTeam Team, const FVector& Origin, float Radius, TArray<AActor*>& OutActors) const;
+
+    // 가까운 순서로 최대 K명 (MaxDistance <= 0이면 거리 제한 없음)
+    UFUNCTION(BlueprintCallable, Category = "Mecha|Combat")
+    void QueryKNearest(EMechaCombatTeam Team, const FVector& Origin, int32 K, float MaxDistance, TArray<AActor*>& OutActors) const;
+
+    // ===== 조회 (엔트리 인덱스 반환, C++ 전용) =====
+    // 반환된 인덱스는 다음 등록/해제 전까지만 유효
+    void QueryRadiusEntries(EMechaCombatTeam Team, const FVector& Origin, float Radius, TArray<int32>& OutEntryIndices) const;
+
+    // Direction(단위 벡터) 기준 MaxAngleDeg 이내 원뿔
+    void QueryConeEntries(EMechaCombatTeam Team, const FVector& Origin, const FVector& Direction, float Radius, float MaxAngleDeg, TArray<int32>& OutEntryIndices) const;
+
+    void QueryKNearestEntries(EMechaCombatTeam Team, const FVector& Origin, int32 K, float MaxDistance, TArray<int32>& OutEntryIndices, const AActor* IgnoreActor = nullptr) const;
+
+    UFUNCTION(BlueprintPure, Category = "Mecha|Combat")
+    int32 GetNumCombatants(EMechaCombatTeam Team) const;
+
+    // 등록된 참가자인지 (사망/제거 시 해제되므로 생존 여부 확인용)
+    UFUNCTION(BlueprintPure, Category = "Mecha|Combat")
+    bool IsRegistered(const AActor* Actor) const { return Actor && IndexByActor.Contains(Actor); }
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+    // 공간 해시 셀 크기 (락온 거리 5000 기준 반경 조회 시 5x5 셀 이내)
+    UPROPERTY(Config)
+    float SpatialCellSize = 2500.f;
+
+private:
+    TArray<FMechaCombatEntry> Entries;
+
+    // 액터 → Entries 인덱스 (스왑 삭제 시 갱신)
+    TMap<TObjectKey<AActor>, int32> IndexByActor;
+
+    TWeakObjectPtr<AMissionManager> MissionManager;
+
+    FMechaSpatialHash SpatialHash;
+
+    void EntriesToActors(const TArray<int32>& EntryIndices, TArray<AActor*>& OutActors) const;
+
+    void RemoveAtSwapIndex(int32 Index);
+};
@@ -0,0 +1,81 @@
+// MechaCrowdFragments.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityTypes.h"
+// 설명:
+// - 군중(Mass Entity) 잡몹의 프래그먼트/태그. 위치는 MassCommon의 FTransformFragment를 같이 씁니다.
+// - 시뮬레이션(UMechaCrowdSimProcessor)은 워커 스레드에서 청크 단위로 병렬 실행되므로
+//   여기에는 UObject 포인터를 두지 않습니다. 플레이어는 UMechaCrowdSubsystem의 시점 스냅샷 인덱스로 참조합니다.
+// - 액터(AEnemyMecha)로 승격된 개체는 FMechaCrowdPromotedTag가 붙어 시뮬레이션에서 빠집니다.
+#include "MechaCrowdFragments.generated.h"
+
+USTRUCT()
+struct PROJECT_MECHA_API FMechaCrowdHealthFragment : public FMassFragment
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, Category = "Crowd")
+    float Health = 100.f;
+
+    UPROPERTY(EditAnywhere, Category = "Crowd")
+    float MaxHealth = 100.f;
+};
+
+// 가장 가까운 플레이어 (스냅샷 인덱스, 없으면 INDEX_NONE)
+USTRUCT()
+struct PROJECT_MECHA_API FMechaCrowdTargetFragment : public FMassFragment
+{
+    GENERATED_BODY()
+
+    int32 ViewerIndex = INDEX_NONE;
+    FVector TargetLocation = FVector::ZeroVector;
+    float DistanceSq = 0.f;
+};
+
+USTRUCT()
+struct PROJECT_MECHA_API FMechaCrowdWeaponFragment : public FMassFragment
+{
+    GENERATED_BODY()
+
+    // 다음 발사까지 남은 시간
+    float Cooldown = 0.f;
+
+    UPROPERTY(EditAnywhere, Category = "Crowd")
+    float FireInterval = 2.f;
+
+    UPROPERTY(EditAnywhere, Category = "Crowd")
+    float Range = 3000.f;
+
+    UPROPERTY(EditAnywhere, Category = "Crowd")
+    float Damage = 5.f;
+};
+
+USTRUCT()
+struct PROJECT_MECHA_API FMechaCrowdMoveFragment : public FMassFragment
+{
+    GENERATED_BODY()
+
+    FVector Velocity = FVector::ZeroVector;
+
+    UPROPERTY(EditAnywhere, Category = "Crowd")
+    float MaxSpeed = 600.f;
+
+    UPROPERTY(EditAnywhere, Category = "Crowd")
+    float Acceleration = 1200.f;
+
+    // 이 거리까지 접근 후 정지 (원거리 교전 거리)
+    UPROPERTY(EditAnywhere, Category = "Crowd")
+    float PreferredRange = 2000.f;
+
+    // 이 거리 밖의 플레이어는 무시하고 제자리 대기
+    UPROPERTY(EditAnywhere, Category = "Crowd")
+    float AggroRadius = 8000.f;
+};
+
+// AEnemyMecha 액터로 승격됨 (시뮬레이션 제외)
+USTRUCT()
+struct PROJECT_MECHA_API FMechaCrowdPromotedTag : public FMassTag
+{
+    GENERATED_BODY()
+};
@@ -0,0 +1,223 @@
+// MechaCrowdNetCell.cpp
+// 군중 복제 셀 - 서버는 셀 안 개체를 빠른 배열로 보내고, 클라이언트는 인스턴스 메시로 보간해서 그림
+
+#include "MechaCrowdNetCell.h"
+#include "MechaCrowdSubsystem.h"
+
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "Net/UnrealNetwork.h"
+
+// ========================================
+// 복제 콜백 (클라이언트)
+// ========================================
+void FMechaCrowdNetAgent::PostReplicatedAdd(const FMechaCrowdNetAgentArray& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->MarkClientDirty();
+	}
+}
+
+void FMechaCrowdNetAgent::PostReplicatedChange(const FMechaCrowdNetAgentArray& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->MarkClientDirty();
+	}
+}
+
+void FMechaCrowdNetAgent::PreReplicatedRemove(const FMechaCrowdNetAgentArray& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->MarkClientDirty();
+	}
+}
+
+// ========================================
+// 생성자 / 복제 설정
+// ========================================
+AMechaCrowdNetCell::AMechaCrowdNetCell()
+{
+	// 클라이언트 보간만 틱 (BeginPlay에서 켬)
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
+
+	Instances = CreateDefaultSubobject<UInstancedStaticMeshComponent>(TEXT("Instances"));
+	Instances->SetMobility(EComponentMobility::Movable);
+	Instances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Instances->SetCastShadow(false);
+	Instances->NumCustomDataFloats = 1;
+	RootComponent = Instances;
+
+	// 컬 거리/갱신 주기는 UMechaCrowdSubsystem이 스폰 시 지정
+	bReplicates = true;
+	SetReplicatingMovement(false);
+
+	Agents.Owner = this;
+}
+
+void AMechaCrowdNetCell::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(AMechaCrowdNetCell, Agents);
+}
+
+void AMechaCrowdNetCell::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// 서버(리슨 서버 포함)는 UMechaCrowdSubsystem의 인스턴스 메시로 그리므로 클라이언트만
+	if (GetNetMode() != NM_Client)
+	{
+		return;
+	}
+
+	if (const UMechaCrowdSubsystem* Crowd = UMechaCrowdSubsystem::Get(this))
+	{
+		Instances->SetStaticMesh(Crowd->GetCrowdMesh().LoadSynchronous());
+	}
+
+	SetActorTickEnabled(true);
+}
+
+// ========================================
+// 서버 - 개체 추가/갱신/제거
+// ========================================
+void AMechaCrowdNetCell::SetAgent(int32 AgentId, const FTransform& Transform, float HealthRatio, float MoveThreshold)
+{
+	const FVector Location = Transform.GetLocation();
+	const uint8 Yaw = FRotator::CompressAxisToByte(Transform.Rotator().Yaw);
+	const uint8 Health = (uint8)FMath::Clamp(FMath::RoundToInt(HealthRatio * 255.f), 0, 255);
+
+	if (const int32* Index = IndexById.Find(AgentId))
+	{
+		FMechaCrowdNetAgent& Item = Agents.Items[*Index];
+		if (Item.Yaw == Yaw && Item.Health == Health
+			&& FVector::DistSquared(Item.Location, Location) < FMath::Square(MoveThreshold))
+		{
+			return;
+		}
+
+		Item.Location = Location;
+		Item.Yaw = Yaw;
+		Item.Health = Health;
+		Agents.MarkItemDirty(Item);
+		return;
+	}
+
+	FMechaCrowdNetAgent& Item = Agents.Items.AddDefaulted_GetRef();
+	Item.AgentId = AgentId;
+	Item.Location = Location;
+	Item.Yaw = Yaw;
+	Item.Health = Health;
+	Agents.MarkItemDirty(Item);
+
+	IndexById.Add(AgentId, Agents.Items.Num() - 1);
+}
+
+void AMechaCrowdNetCell::RemoveAgent(int32 AgentId)
+{
+	int32 Index = INDEX_NONE;
+	if (!IndexById.RemoveAndCopyValue(AgentId, Index))
+	{
+		return;
+	}
+
+	// 스왑 삭제 (항목의 복제 ID는 같이 옮겨지므로 클라이언트 매핑 유지)
+	const int32 LastIndex = Agents.Items.Num() - 1;
+	if (Index != LastIndex)
+	{
+		Agents.Items[Index] = MoveTemp(Agents.Items[LastIndex]);
+		IndexById[Agents.Items[Index].AgentId] = Index;
+	}
+	Agents.Items.RemoveAt(LastIndex, 1, false);
+	Agents.MarkArrayDirty();
+}
+
+// ========================================
+// 클라이언트 - 보간 / 인스턴스 갱신
+// ========================================
+void AMechaCrowdNetCell::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	if (bClientDirty)
+	{
+		bClientDirty = false;
+		RebuildClientInstances();
+	}
+
+	const int32 Num = Agents.Items.Num();
+	if (Num == 0)
+	{
+		return;
+	}
+
+	const float YawAlpha = FMath::Clamp(DeltaSeconds * InterpSpeed, 0.f, 1.f);
+
+	InstanceTransforms.SetNum(Num, false);
+	for (int32 i = 0; i < Num; ++i)
+	{
+		const FMechaCrowdNetAgent& Item = Agents.Items[i];
+		FDisplayState& State = DisplayStates.FindChecked(Item.AgentId);
+
+		State.Location = FMath::VInterpTo(State.Location, (FVector)Item.Location, DeltaSeconds, InterpSpeed);
+		State.Yaw += FRotator::NormalizeAxis(FRotator::DecompressAxisFromByte(Item.Yaw) - State.Yaw) * YawAlpha;
+
+		InstanceTransforms[i] = FTransform(FRotator(0.f, State.Yaw, 0.f), State.Location);
+	}
+
+	Instances->BatchUpdateInstancesTransforms(0, InstanceTransforms, true, true, false);
+}
+
+void AMechaCrowdNetCell::RebuildClientInstances()
+{
+	const int32 Num = Agents.Items.Num();
+
+	// 표시 상태: 기존 개체는 이어서 보간, 새 개체는 복제 위치에서 시작
+	TMap<int32, FDisplayState> NewStates;
+	NewStates.Reserve(Num);
+	for (const FMechaCrowdNetAgent& Item : Agents.Items)
+	{
+		FDisplayState State;
+		if (const FDisplayState* Existing = DisplayStates.Find(Item.AgentId))
+		{
+			State = *Existing;
+		}
+		else
+		{
+			State.Location = Item.Location;
+			State.Yaw = FRotator::DecompressAxisFromByte(Item.Yaw);
+		}
+		NewStates.Add(Item.AgentId, State);
+	}
+	DisplayStates = MoveTemp(NewStates);
+
+	// 인스턴스 수 맞춤 (뒤에서만 추가/제거, 변환은 Tick에서 전체 갱신)
+	const int32 NumInstances = Instances->GetInstanceCount();
+	if (NumInstances > Num)
+	{
+		TArray<int32> ToRemove;
+		for (int32 i = Num; i < NumInstances; ++i)
+		{
+			ToRemove.Add(i);
+		}
+		Instances->RemoveInstances(ToRemove);
+	}
+	else if (NumInstances < Num)
+	{
+		TArray<FTransform> NewInstances;
+		NewInstances.Init(FTransform::Identity, Num - NumInstances);
+		Instances->AddInstances(NewInstances, false, true);
+	}
+
+	for (int32 i = 0; i < Num; ++i)
+	{
+		Instances->SetCustomDataValue(i, 0, Agents.Items[i].Health / 255.f);
+	}
+	Instances->MarkRenderStateDirty();
+}
@@ -0,0 +1,125 @@
+// MechaCrowdNetCell.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Engine/NetSerialization.h"
+#include "Net/Serialization/FastArraySerializer.h"
+// 설명:
+// - 데디케이티드/리슨 서버에서 승격 전 군중 개체를 클라이언트에 보여 주는 경량 복제 표현.
+// - UMechaCrowdSubsystem이 공간 셀(NetCellSize)마다 하나씩 스폰하고, 셀 안 개체의 위치/Yaw/체력 비율만
+//   FFastArraySerializer로 보냅니다. 바뀐 항목만 전송되며, 작게 움직인 개체는 NetMoveThreshold까지 보내지 않습니다.
+//   액터/컨트롤러/ASC는 만들지 않습니다.
+// - 셀 액터는 Replication Graph 공간 그리드에 정적으로 등록되어 컬 거리(NetCullDistance) 밖 연결에는 복제되지 않습니다.
+// - 클라이언트는 셀마다 인스턴스 스태틱 메시 하나로 그리고, 위치/Yaw는 다음 갱신까지 보간합니다.
+//   체력 비율은 인스턴스 커스텀 데이터 0번으로 머티리얼에 전달됩니다.
+#include "MechaCrowdNetCell.generated.h"
+
+class AMechaCrowdNetCell;
+class UInstancedStaticMeshComponent;
+struct FMechaCrowdNetAgentArray;
+
+// 개체 하나
+USTRUCT()
+struct FMechaCrowdNetAgent : public FFastArraySerializerItem
+{
+    GENERATED_BODY()
+
+    // 서버 슬롯 번호 (클라이언트 보간 상태 키)
+    UPROPERTY()
+    int32 AgentId = INDEX_NONE;
+
+    UPROPERTY()
+    FVector_NetQuantize Location = FVector::ZeroVector;
+
+    // FRotator::CompressAxisToByte
+    UPROPERTY()
+    uint8 Yaw = 0;
+
+    // 체력 비율 0~255
+    UPROPERTY()
+    uint8 Health = 255;
+
+    void PostReplicatedAdd(const FMechaCrowdNetAgentArray& InArraySerializer);
+    void PostReplicatedChange(const FMechaCrowdNetAgentArray& InArraySerializer);
+    void PreReplicatedRemove(const FMechaCrowdNetAgentArray& InArraySerializer);
+};
+
+USTRUCT()
+struct FMechaCrowdNetAgentArray : public FFastArraySerializer
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<FMechaCrowdNetAgent> Items;
+
+    // 클라이언트 콜백 대상
+    UPROPERTY(NotReplicated)
+    TObjectPtr<AMechaCrowdNetCell> Owner = nullptr;
+
+    bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+    {
+        return FFastArraySerializer::FastArrayDeltaSerialize<FMechaCrowdNetAgent, FMechaCrowdNetAgentArray>(Items, DeltaParms, *this);
+    }
+};
+
+template<>
+struct TStructOpsTypeTraits<FMechaCrowdNetAgentArray> : public TStructOpsTypeTraitsBase2<FMechaCrowdNetAgentArray>
+{
+    enum
+    {
+        WithNetDeltaSerializer = true,
+    };
+};
+
+UCLASS(NotBlueprintable, NotPlaceable, Transient)
+class PROJECT_MECHA_API AMechaCrowdNetCell : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    AMechaCrowdNetCell();
+
+    virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+    virtual void Tick(float DeltaSeconds) override;
+
+    // ===== 서버 =====
+    // 추가 또는 갱신 (MoveThreshold 미만 이동 + 같은 Yaw/체력이면 전송하지 않음)
+    void SetAgent(int32 AgentId, const FTransform& Transform, float HealthRatio, float MoveThreshold);
+    void RemoveAgent(int32 AgentId);
+
+    int32 GetNumAgents() const { return Agents.Items.Num(); }
+
+    // ===== 클라이언트 =====
+    // 복제 콜백에서 호출, 다음 Tick에 인스턴스 목록 재구성
+    void MarkClientDirty() { bClientDirty = true; }
+
+protected:
+    virtual void BeginPlay() override;
+
+    // 복제된 위치로 따라가는 속도 (VInterpTo)
+    UPROPERTY(EditDefaultsOnly, Category = "Crowd")
+    float InterpSpeed = 8.f;
+
+private:
+    UPROPERTY(Replicated)
+    FMechaCrowdNetAgentArray Agents;
+
+    UPROPERTY(VisibleAnywhere, Category = "Crowd")
+    TObjectPtr<UInstancedStaticMeshComponent> Instances;
+
+    // 서버: AgentId → Items 인덱스
+    TMap<int32, int32> IndexById;
+
+    // 클라이언트: 보간 중인 표시 상태
+    struct FDisplayState
+    {
+        FVector Location = FVector::ZeroVector;
+        float Yaw = 0.f;
+    };
+    TMap<int32, FDisplayState> DisplayStates;
+    TArray<FTransform> InstanceTransforms;
+    bool bClientDirty = false;
+
+    void RebuildClientInstances();
+};
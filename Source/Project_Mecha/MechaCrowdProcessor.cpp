@@ -0,0 +1,126 @@
+// MechaCrowdProcessor.cpp
+// 군중 잡몹 시뮬레이션 - 타겟 선택, 접근 이동, 무기 쿨다운 (청크 병렬)
+
+#include "MechaCrowdProcessor.h"
+#include "MechaCrowdFragments.h"
+#include "MechaCrowdSubsystem.h"
+#include "MechaStats.h"
+
+#include "MassCommonFragments.h"
+#include "MassExecutionContext.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Crowd Sim"), STAT_Mecha_CrowdSim, STATGROUP_Mecha);
+
+// ========================================
+// 생성자
+// ========================================
+UMechaCrowdSimProcessor::UMechaCrowdSimProcessor()
+	: EntityQuery(*this)
+{
+	bAutoRegisterWithProcessingPhases = true;
+	ProcessingPhase = EMassProcessingPhase::PrePhysics;
+	ExecutionFlags = (int32)(EProcessorExecutionFlags::Server | EProcessorExecutionFlags::Standalone);
+}
+
+void UMechaCrowdSimProcessor::ConfigureQueries()
+{
+	EntityQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddRequirement<FMechaCrowdMoveFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddRequirement<FMechaCrowdTargetFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddRequirement<FMechaCrowdWeaponFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddTagRequirement<FMechaCrowdPromotedTag>(EMassFragmentPresence::None);
+}
+
+// ========================================
+// 실행 (청크 병렬)
+// ========================================
+void UMechaCrowdSimProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Mecha_CrowdSim);
+
+	const UWorld* World = Context.GetWorld();
+	UMechaCrowdSubsystem* Crowd = World ? World->GetSubsystem<UMechaCrowdSubsystem>() : nullptr;
+	if (!Crowd)
+	{
+		return;
+	}
+
+	// 게임 스레드 Tick에서만 바뀌는 스냅샷 (프로세서 실행 중에는 읽기 전용)
+	const TArray<FVector>& Viewers = Crowd->GetViewerLocations();
+	const float DeltaTime = Context.GetDeltaTimeSeconds();
+
+	EntityQuery.ParallelForEachEntityChunk(EntityManager, Context, [&Viewers, Crowd, DeltaTime](FMassExecutionContext& ChunkContext)
+		{
+			const int32 NumEntities = ChunkContext.GetNumEntities();
+			const TArrayView<FTransformFragment> Transforms = ChunkContext.GetMutableFragmentView<FTransformFragment>();
+			const TArrayView<FMechaCrowdMoveFragment> Moves = ChunkContext.GetMutableFragmentView<FMechaCrowdMoveFragment>();
+			const TArrayView<FMechaCrowdTargetFragment> Targets = ChunkContext.GetMutableFragmentView<FMechaCrowdTargetFragment>();
+			const TArrayView<FMechaCrowdWeaponFragment> Weapons = ChunkContext.GetMutableFragmentView<FMechaCrowdWeaponFragment>();
+
+			// 청크 단위로 모았다가 한 번에 넘김 (잠금 최소화)
+			TArray<FMechaCrowdShot, TInlineAllocator<16>> Shots;
+
+			for (int32 i = 0; i < NumEntities; ++i)
+			{
+				FTransform& Transform = Transforms[i].GetMutableTransform();
+				FMechaCrowdMoveFragment& Move = Moves[i];
+				FMechaCrowdTargetFragment& Target = Targets[i];
+				FMechaCrowdWeaponFragment& Weapon = Weapons[i];
+
+				const FVector Location = Transform.GetLocation();
+
+				// ========== 1. 가장 가까운 플레이어 ==========
+				Target.ViewerIndex = INDEX_NONE;
+				Target.DistanceSq = FMath::Square(Move.AggroRadius);
+				for (int32 ViewerIndex = 0; ViewerIndex < Viewers.Num(); ++ViewerIndex)
+				{
+					const float DistSq = FVector::DistSquared(Location, Viewers[ViewerIndex]);
+					if (DistSq < Target.DistanceSq)
+					{
+						Target.ViewerIndex = ViewerIndex;
+						Target.DistanceSq = DistSq;
+						Target.TargetLocation = Viewers[ViewerIndex];
+					}
+				}
+
+				// ========== 2. 이동 (교전 거리 유지) ==========
+				FVector DesiredVelocity = FVector::ZeroVector;
+				if (Target.ViewerIndex != INDEX_NONE)
+				{
+					const FVector ToTarget = (Target.TargetLocation - Location).GetSafeNormal2D();
+					const float Distance = FMath::Sqrt(Target.DistanceSq);
+
+					if (Distance > Move.PreferredRange * 1.1f)
+					{
+						DesiredVelocity = ToTarget * Move.MaxSpeed;
+					}
+					else if (Distance < Move.PreferredRange * 0.7f)
+					{
+						DesiredVelocity = -ToTarget * Move.MaxSpeed * 0.5f;
+					}
+
+					// 타겟을 바라봄
+					Transform.SetRotation(FRotator(0.f, ToTarget.Rotation().Yaw, 0.f).Quaternion());
+				}
+
+				Move.Velocity = FMath::VInterpConstantTo(Move.Velocity, DesiredVelocity, DeltaTime, Move.Acceleration);
+				Transform.SetLocation(Location + Move.Velocity * DeltaTime);
+
+				// ========== 3. 무기 ==========
+				Weapon.Cooldown = FMath::Max(0.f, Weapon.Cooldown - DeltaTime);
+				if (Weapon.Cooldown <= 0.f
+					&& Target.ViewerIndex != INDEX_NONE
+					&& Target.DistanceSq <= FMath::Square(Weapon.Range))
+				{
+					Weapon.Cooldown = Weapon.FireInterval;
+					Shots.Add({ Location, Target.ViewerIndex, Weapon.Damage });
+				}
+			}
+
+			if (Shots.Num() > 0)
+			{
+				Crowd->QueueShots(Shots);
+			}
+		});
+}
@@ -0,0 +1,29 @@
+// MechaCrowdProcessor.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassProcessor.h"
+#include "MassEntityQuery.h"
+// 설명:
+// - 군중 잡몹 시뮬레이션 프로세서. 승격되지 않은 개체만 청크 단위로 워커 스레드에서 병렬 처리합니다.
+//   1) 가장 가까운 플레이어 선택 (UMechaCrowdSubsystem이 게임 스레드에서 만든 시점 스냅샷)
+//   2) 교전 거리까지 접근 / 이탈 (내비 없이 평면 조향, 높이 유지)
+//   3) 무기 쿨다운 → 사거리 안이면 발사 기록 (데미지 적용은 서브시스템이 게임 스레드에서)
+// - 서버/스탠드얼론에서만 실행됩니다.
+#include "MechaCrowdProcessor.generated.h"
+
+UCLASS()
+class PROJECT_MECHA_API UMechaCrowdSimProcessor : public UMassProcessor
+{
+    GENERATED_BODY()
+
+public:
+    UMechaCrowdSimProcessor();
+
+protected:
+    virtual void ConfigureQueries() override;
+    virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+    FMassEntityQuery EntityQuery;
+};
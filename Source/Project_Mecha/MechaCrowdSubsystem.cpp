@@ -0,0 +1,856 @@
+// MechaCrowdSubsystem.cpp
+// 잡몹 군중 모드 - Mass 엔티티 생성, 액터 승격/강등 LOD, 발사 데미지 적용, 인스턴스 메시 표현
+
+#include "MechaCrowdSubsystem.h"
+#include "MechaCrowdNetCell.h"
+#include "MechaStats.h"
+#include "MechaNativeTags.h"
+#include "MechaAttributeSet.h"
+#include "MechaCharacterBase.h"
+#include "MechaCombatRegistrySubsystem.h"
+#include "MissionManager.h"
+#include "EnemyMecha.h"
+#include "Project_Mecha.h"
+
+#include "MassEntitySubsystem.h"
+#include "MassEntityManager.h"
+#include "MassCommonFragments.h"
+#include "AbilitySystemBlueprintLibrary.h"
+#include "AbilitySystemComponent.h"
+#include "GameplayEffect.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Crowd LOD"), STAT_Mecha_CrowdLOD, STATGROUP_Mecha);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Crowd Agents"), STAT_Mecha_CrowdAgents, STATGROUP_Mecha);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Crowd Promoted"), STAT_Mecha_CrowdPromoted, STATGROUP_Mecha);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Crowd Net Cells"), STAT_Mecha_CrowdNetCells, STATGROUP_Mecha);
+
+// 콘솔 명령: 첫 번째 플레이어 주변에 군중 생성
+static FAutoConsoleCommandWithWorldAndArgs GMechaCrowdSpawnCmd(
+	TEXT("Mecha.Crowd.Spawn"),
+	TEXT("Mecha.Crowd.Spawn <수> [반경] - 첫 번째 플레이어 주변에 군중 잡몹을 생성합니다."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+		{
+			UMechaCrowdSubsystem* Crowd = UMechaCrowdSubsystem::Get(World);
+			APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+			APawn* Pawn = PC ? PC->GetPawn() : nullptr;
+			if (!Crowd || !Pawn || Args.Num() < 1)
+			{
+				return;
+			}
+
+			const int32 Count = FCString::Atoi(*Args[0]);
+			const float Radius = Args.Num() > 1 ? FCString::Atof(*Args[1]) : 20000.f;
+			Crowd->SpawnCrowd(Count, Pawn->GetActorLocation(), Radius);
+		}));
+
+// 콘솔 명령: 개체/승격 수 출력
+static FAutoConsoleCommandWithWorld GMechaCrowdDumpCmd(
+	TEXT("Mecha.Crowd.Dump"),
+	TEXT("군중 개체 수, 승격된 액터 수, 플레이어 시점 수를 출력합니다."),
+	FConsoleCommandWithWorldDelegate::CreateStatic([](UWorld* World)
+		{
+			if (const UMechaCrowdSubsystem* Crowd = UMechaCrowdSubsystem::Get(World))
+			{
+				Crowd->DumpStats();
+			}
+		}));
+
+// ========================================
+// 접근자
+// ========================================
+UMechaCrowdSubsystem* UMechaCrowdSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine || !WorldContextObject) return nullptr;
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UMechaCrowdSubsystem>() : nullptr;
+}
+
+bool UMechaCrowdSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UMechaCrowdSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMechaCrowdSubsystem, STATGROUP_Tickables);
+}
+
+void UMechaCrowdSubsystem::Deinitialize()
+{
+	// 엔티티는 월드의 엔티티 매니저와 함께 정리됨
+	Agents.Empty();
+	FreeSlots.Empty();
+	PendingSpawns.Empty();
+	PendingShots.Empty();
+	NetCells.Empty();
+	NumAlive = 0;
+	NumPromoted = 0;
+
+	Super::Deinitialize();
+}
+
+bool UMechaCrowdSubsystem::IsCrowdAuthority() const
+{
+	const UWorld* World = GetWorld();
+	return World && World->GetNetMode() != NM_Client;
+}
+
+FMassEntityManager* UMechaCrowdSubsystem::GetEntityManager() const
+{
+	UMassEntitySubsystem* EntitySubsystem = GetWorld() ? GetWorld()->GetSubsystem<UMassEntitySubsystem>() : nullptr;
+	return EntitySubsystem ? &EntitySubsystem->GetMutableEntityManager() : nullptr;
+}
+
+// ========================================
+// 생성 예약 / 범위 데미지
+// ========================================
+int32 UMechaCrowdSubsystem::SpawnCrowd(int32 Count, FVector Center, float Radius)
+{
+	if (!IsCrowdAuthority() || Count <= 0)
+	{
+		return 0;
+	}
+
+	PendingSpawns.Add({ Count, Center, Radius });
+	return Count;
+}
+
+int32 UMechaCrowdSubsystem::ApplyDamageInRadius(FVector Origin, float Radius, float Damage)
+{
+	FMassEntityManager* EntityManager = GetEntityManager();
+	if (!EntityManager || EntityManager->IsProcessing() || !IsCrowdAuthority())
+	{
+		return 0;
+	}
+
+	// 체력 프래그먼트는 시뮬레이션 프로세서가 건드리지 않으므로 게임 스레드에서 바로 수정
+	// (사망 정리는 다음 Tick의 SyncAgents에서)
+	const float RadiusSq = FMath::Square(Radius);
+	int32 NumHit = 0;
+
+	for (const FAgent& Agent : Agents)
+	{
+		if (Agent.bPromoted || !EntityManager->IsEntityValid(Agent.Entity))
+		{
+			continue;
+		}
+
+		if (FVector::DistSquared(Agent.Transform.GetLocation(), Origin) > RadiusSq)
+		{
+			continue;
+		}
+
+		FMechaCrowdHealthFragment& Health = EntityManager->GetFragmentDataChecked<FMechaCrowdHealthFragment>(Agent.Entity);
+		Health.Health -= Damage;
+		++NumHit;
+	}
+
+	return NumHit;
+}
+
+bool UMechaCrowdSubsystem::ApplyDamageAlongSegment(const FVector& Start, const FVector& End, float Damage, FVector& OutHitLocation)
+{
+	FMassEntityManager* EntityManager = GetEntityManager();
+	if (!EntityManager || EntityManager->IsProcessing() || !IsCrowdAuthority())
+	{
+		return false;
+	}
+
+	const int32 Slot = FindFirstAlongSegment(*EntityManager, Start, End, OutHitLocation);
+	if (Slot == INDEX_NONE)
+	{
+		return false;
+	}
+
+	FMechaCrowdHealthFragment& Health = EntityManager->GetFragmentDataChecked<FMechaCrowdHealthFragment>(Agents[Slot].Entity);
+	Health.Health -= Damage;
+	return true;
+}
+
+bool UMechaCrowdSubsystem::TraceAlongSegment(const FVector& Start, const FVector& End, FVector& OutHitLocation) const
+{
+	const FMassEntityManager* EntityManager = GetEntityManager();
+	if (!EntityManager || EntityManager->IsProcessing() || !IsCrowdAuthority())
+	{
+		return false;
+	}
+
+	return FindFirstAlongSegment(*EntityManager, Start, End, OutHitLocation) != INDEX_NONE;
+}
+
+int32 UMechaCrowdSubsystem::FindFirstAlongSegment(const FMassEntityManager& EntityManager, const FVector& Start, const FVector& End, FVector& OutHitLocation) const
+{
+	const FVector Segment = End - Start;
+	const float SegmentLengthSq = Segment.SizeSquared();
+	if (SegmentLengthSq <= KINDA_SMALL_NUMBER)
+	{
+		return INDEX_NONE;
+	}
+
+	const float RadiusSq = FMath::Square(AgentRadius);
+	int32 BestSlot = INDEX_NONE;
+	float BestT = 1.f;
+
+	for (int32 Slot = 0; Slot < Agents.Num(); ++Slot)
+	{
+		const FAgent& Agent = Agents[Slot];
+		if (Agent.bPromoted || !EntityManager.IsEntityValid(Agent.Entity))
+		{
+			continue;
+		}
+
+		// 선분에서 구 중심에 가장 가까운 점이 반지름 안이면 맞음 (가장 앞쪽 개체만)
+		const FVector Center = Agent.Transform.GetLocation() + FVector(0.f, 0.f, AgentRadius);
+		const float T = FMath::Clamp(FVector::DotProduct(Center - Start, Segment) / SegmentLengthSq, 0.f, 1.f);
+		if (T > BestT || FVector::DistSquared(Start + Segment * T, Center) > RadiusSq)
+		{
+			continue;
+		}
+
+		// 이번 프레임에 이미 죽은 개체 (정리는 다음 Tick의 SyncAgents)
+		if (EntityManager.GetFragmentDataChecked<FMechaCrowdHealthFragment>(Agent.Entity).Health <= 0.f)
+		{
+			continue;
+		}
+
+		BestT = T;
+		BestSlot = Slot;
+	}
+
+	if (BestSlot != INDEX_NONE)
+	{
+		OutHitLocation = Start + Segment * BestT;
+	}
+	return BestSlot;
+}
+
+// ========================================
+// 프로세서 → 발사 기록 (워커 스레드)
+// ========================================
+void UMechaCrowdSubsystem::QueueShots(TConstArrayView<FMechaCrowdShot> Shots)
+{
+	FScopeLock Lock(&ShotsLock);
+	PendingShots.Append(Shots.GetData(), Shots.Num());
+}
+
+// ========================================
+// 매 프레임 (게임 스레드, 프로세서 실행 이후)
+// ========================================
+void UMechaCrowdSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (!IsCrowdAuthority())
+	{
+		return;
+	}
+
+	FMassEntityManager* EntityManager = GetEntityManager();
+	if (!EntityManager || EntityManager->IsProcessing())
+	{
+		return;
+	}
+
+	// 발사 기록의 시점 인덱스는 직전 스냅샷 기준이므로 스냅샷 갱신 전에 적용
+	ApplyShots();
+	GatherViewers();
+
+	ProcessPendingSpawns(*EntityManager);
+	SyncAgents(*EntityManager);
+
+	TimeSinceLOD += DeltaTime;
+	if (TimeSinceLOD >= LODInterval)
+	{
+		TimeSinceLOD = 0.f;
+		UpdateRepresentationLOD(*EntityManager);
+	}
+
+	if (UsesNetCells())
+	{
+		UpdateNetCells(*EntityManager);
+	}
+
+	UpdateInstances();
+
+	SET_DWORD_STAT(STAT_Mecha_CrowdAgents, NumAlive);
+	SET_DWORD_STAT(STAT_Mecha_CrowdPromoted, NumPromoted);
+	SET_DWORD_STAT(STAT_Mecha_CrowdNetCells, NetCells.Num());
+}
+
+// ========================================
+// 내부 - 엔티티 생성
+// ========================================
+void UMechaCrowdSubsystem::ProcessPendingSpawns(FMassEntityManager& EntityManager)
+{
+	if (PendingSpawns.Num() == 0)
+	{
+		return;
+	}
+
+	if (!Archetype.IsValid())
+	{
+		Archetype = EntityManager.CreateArchetype({
+			FTransformFragment::StaticStruct(),
+			FMechaCrowdHealthFragment::StaticStruct(),
+			FMechaCrowdTargetFragment::StaticStruct(),
+			FMechaCrowdWeaponFragment::StaticStruct(),
+			FMechaCrowdMoveFragment::StaticStruct() });
+	}
+
+	UWorld* World = GetWorld();
+
+	for (const FPendingSpawn& Spawn : PendingSpawns)
+	{
+		for (int32 i = 0; i < Spawn.Count; ++i)
+		{
+			// 바닥 높이 맞춤 (생성 시 한 번)
+			const FVector2D Offset = FMath::RandPointInCircle(Spawn.Radius);
+			FVector Location = Spawn.Center + FVector(Offset.X, Offset.Y, 0.f);
+
+			FHitResult Ground;
+			if (World->LineTraceSingleByChannel(Ground, Location + FVector(0.f, 0.f, 5000.f), Location - FVector(0.f, 0.f, 5000.f), ECC_WorldStatic))
+			{
+				Location = Ground.ImpactPoint;
+			}
+
+			const FMassEntityHandle Entity = EntityManager.CreateEntity(Archetype);
+
+			FTransform& Transform = EntityManager.GetFragmentDataChecked<FTransformFragment>(Entity).GetMutableTransform();
+			Transform = FTransform(FRotator(0.f, FMath::FRandRange(-180.f, 180.f), 0.f), Location);
+
+			EntityManager.GetFragmentDataChecked<FMechaCrowdHealthFragment>(Entity) = DefaultHealth;
+			EntityManager.GetFragmentDataChecked<FMechaCrowdMoveFragment>(Entity) = DefaultMove;
+
+			// 한꺼번에 쏘지 않도록 첫 쿨다운 분산
+			FMechaCrowdWeaponFragment& Weapon = EntityManager.GetFragmentDataChecked<FMechaCrowdWeaponFragment>(Entity);
+			Weapon = DefaultWeapon;
+			Weapon.Cooldown = FMath::FRandRange(0.f, DefaultWeapon.FireInterval);
+
+			const int32 Slot = FreeSlots.Num() > 0 ? FreeSlots.Pop(false) : Agents.AddDefaulted();
+			Agents[Slot].Entity = Entity;
+			Agents[Slot].Transform = Transform;
+			++NumAlive;
+		}
+	}
+
+	PendingSpawns.Reset();
+}
+
+// ========================================
+// 내부 - 플레이어 시점 스냅샷
+// ========================================
+void UMechaCrowdSubsystem::GatherViewers()
+{
+	ViewerLocations.Reset();
+	ViewerPawns.Reset();
+
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		APawn* Pawn = PC ? PC->GetPawn() : nullptr;
+		if (!Pawn)
+		{
+			continue;
+		}
+
+		ViewerLocations.Add(Pawn->GetActorLocation());
+		ViewerPawns.Add(Pawn);
+	}
+}
+
+// ========================================
+// 내부 - 발사 데미지 적용
+// ========================================
+void UMechaCrowdSubsystem::ApplyShots()
+{
+	TArray<FMechaCrowdShot> Shots;
+	{
+		FScopeLock Lock(&ShotsLock);
+		Swap(Shots, PendingShots);
+	}
+
+	TSubclassOf<UGameplayEffect> DamageEffect = ShotDamageEffect.LoadSynchronous();
+	if (Shots.Num() == 0 || !DamageEffect)
+	{
+		return;
+	}
+
+	for (const FMechaCrowdShot& Shot : Shots)
+	{
+		APawn* Pawn = ViewerPawns.IsValidIndex(Shot.ViewerIndex) ? ViewerPawns[Shot.ViewerIndex].Get() : nullptr;
+		UAbilitySystemComponent* TargetASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(Pawn);
+		if (!TargetASC || !CanShotReach(Shot, Pawn))
+		{
+			continue;
+		}
+
+		FGameplayEffectSpecHandle SpecHandle = TargetASC->MakeOutgoingSpec(DamageEffect, 1.f, TargetASC->MakeEffectContext());
+		if (SpecHandle.IsValid())
+		{
+			SpecHandle.Data->SetSetByCallerMagnitude(MechaTags::Data_Damage, Shot.Damage);
+			TargetASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
+		}
+
+		if (AMechaCharacterBase* Mecha = Cast<AMechaCharacterBase>(Pawn))
+		{
+			Mecha->PlayHitReactFromDirection(Shot.Origin);
+		}
+	}
+}
+
+// ========================================
+// 내부 - 트랜스폼 캐시 / 사망 정리
+// ========================================
+void UMechaCrowdSubsystem::SyncAgents(FMassEntityManager& EntityManager)
+{
+	AMissionManager* MissionManager = nullptr;
+	if (const UMechaCombatRegistrySubsystem* Registry = UMechaCombatRegistrySubsystem::Get(this))
+	{
+		MissionManager = Registry->GetMissionManager();
+	}
+
+	for (int32 Slot = 0; Slot < Agents.Num(); ++Slot)
+	{
+		FAgent& Agent = Agents[Slot];
+		if (!EntityManager.IsEntityValid(Agent.Entity))
+		{
+			continue;
+		}
+
+		// ========== 승격: 액터가 원본 ==========
+		if (Agent.bPromoted)
+		{
+			AEnemyMecha* Enemy = Agent.Actor.Get();
+			if (!Enemy || Enemy->IsDead())
+			{
+				// 킬 보고는 액터의 HandleDeath가 이미 함
+				ReleaseSlot(EntityManager, Slot);
+				continue;
+			}
+
+			Agent.Transform = Enemy->GetActorTransform();
+			EntityManager.GetFragmentDataChecked<FTransformFragment>(Agent.Entity).GetMutableTransform() = Agent.Transform;
+			continue;
+		}
+
+		// ========== 엔티티 ==========
+		if (EntityManager.GetFragmentDataChecked<FMechaCrowdHealthFragment>(Agent.Entity).Health <= 0.f)
+		{
+			if (MissionManager)
+			{
+				MissionManager->NotifyEnemyKilled(nullptr);
+			}
+			ReleaseSlot(EntityManager, Slot);
+			continue;
+		}
+
+		Agent.Transform = EntityManager.GetFragmentDataChecked<FTransformFragment>(Agent.Entity).GetTransform();
+	}
+}
+
+// ========================================
+// 내부 - 표현 LOD (승격 / 강등)
+// ========================================
+void UMechaCrowdSubsystem::UpdateRepresentationLOD(FMassEntityManager& EntityManager)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Mecha_CrowdLOD);
+
+	if (ViewerLocations.Num() == 0)
+	{
+		return;
+	}
+
+	auto MinViewerDistSq = [this](const FVector& Location)
+		{
+			float Best = TNumericLimits<float>::Max();
+			for (const FVector& Viewer : ViewerLocations)
+			{
+				Best = FMath::Min(Best, FVector::DistSquared(Location, Viewer));
+			}
+			return Best;
+		};
+
+	const float PromoteDistSq = FMath::Square(PromoteDistance);
+	const float DemoteDistSq = FMath::Square(FMath::Max(DemoteDistance, PromoteDistance));
+
+	TArray<TPair<float, int32>> Candidates;
+
+	for (int32 Slot = 0; Slot < Agents.Num(); ++Slot)
+	{
+		const FAgent& Agent = Agents[Slot];
+		if (!EntityManager.IsEntityValid(Agent.Entity))
+		{
+			continue;
+		}
+
+		const float DistSq = MinViewerDistSq(Agent.Transform.GetLocation());
+
+		if (Agent.bPromoted)
+		{
+			if (DistSq > DemoteDistSq && !IsLockOnTarget(Agent.Actor.Get()))
+			{
+				Demote(EntityManager, Slot);
+			}
+		}
+		else if (DistSq < PromoteDistSq)
+		{
+			Candidates.Add({ DistSq, Slot });
+		}
+	}
+
+	// 가까운 순서로 한도까지
+	Candidates.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B) { return A.Key < B.Key; });
+
+	for (const TPair<float, int32>& Candidate : Candidates)
+	{
+		if (NumPromoted >= MaxPromoted)
+		{
+			break;
+		}
+		Promote(EntityManager, Candidate.Value);
+	}
+}
+
+AEnemyMecha* UMechaCrowdSubsystem::PromoteForLockOn(const FVector& Origin, const FVector& Forward, float MaxDistance, float MaxAngleDeg)
+{
+	FMassEntityManager* EntityManager = GetEntityManager();
+	if (!EntityManager || EntityManager->IsProcessing() || !IsCrowdAuthority())
+	{
+		return nullptr;
+	}
+
+	const float MaxDistSq = FMath::Square(MaxDistance);
+	const float MinDot = FMath::Cos(FMath::DegreesToRadians(MaxAngleDeg));
+
+	int32 BestSlot = INDEX_NONE;
+	float BestDot = MinDot;
+
+	for (int32 Slot = 0; Slot < Agents.Num(); ++Slot)
+	{
+		const FAgent& Agent = Agents[Slot];
+		if (Agent.bPromoted || !EntityManager->IsEntityValid(Agent.Entity))
+		{
+			continue;
+		}
+
+		const FVector ToAgent = Agent.Transform.GetLocation() - Origin;
+		if (ToAgent.SizeSquared() > MaxDistSq)
+		{
+			continue;
+		}
+
+		const float Dot = FVector::DotProduct(ToAgent.GetSafeNormal(), Forward);
+		if (Dot >= BestDot)
+		{
+			BestDot = Dot;
+			BestSlot = Slot;
+		}
+	}
+
+	// 락온 요청은 MaxPromoted 한도와 상관없이 승격
+	if (BestSlot == INDEX_NONE || !Promote(*EntityManager, BestSlot))
+	{
+		return nullptr;
+	}
+
+	return Agents[BestSlot].Actor.Get();
+}
+
+bool UMechaCrowdSubsystem::Promote(FMassEntityManager& EntityManager, int32 Slot)
+{
+	FAgent& Agent = Agents[Slot];
+
+	UClass* Class = GruntClass.LoadSynchronous();
+	if (!Class)
+	{
+		return false;
+	}
+
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	AEnemyMecha* Enemy = GetWorld()->SpawnActor<AEnemyMecha>(Class, Agent.Transform, Params);
+	if (!Enemy)
+	{
+		return false;
+	}
+
+	if (!Enemy->GetController())
+	{
+		Enemy->SpawnDefaultController();
+	}
+
+	// BeginPlay의 InitializeAttributes 이후 남은 체력 비율 적용
+	const FMechaCrowdHealthFragment& Health = EntityManager.GetFragmentDataChecked<FMechaCrowdHealthFragment>(Agent.Entity);
+	if (UAbilitySystemComponent* ASC = Enemy->GetAbilitySystemComponent())
+	{
+		const float Ratio = Health.MaxHealth > 0.f ? FMath::Clamp(Health.Health / Health.MaxHealth, 0.f, 1.f) : 1.f;
+		ASC->SetNumericAttributeBase(UMechaAttributeSet::GetHealthAttribute(), Enemy->GetMaxHealth() * Ratio);
+	}
+
+	EntityManager.AddTagToEntity(Agent.Entity, FMechaCrowdPromotedTag::StaticStruct());
+
+	// 이제 액터가 복제되므로 셀에서 제거
+	RemoveFromNetCell(Slot);
+
+	Agent.Actor = Enemy;
+	Agent.bPromoted = true;
+	++NumPromoted;
+	return true;
+}
+
+void UMechaCrowdSubsystem::Demote(FMassEntityManager& EntityManager, int32 Slot)
+{
+	FAgent& Agent = Agents[Slot];
+
+	if (AEnemyMecha* Enemy = Agent.Actor.Get())
+	{
+		// 위치/체력/속도를 엔티티로 되돌림
+		Agent.Transform = FTransform(FRotator(0.f, Enemy->GetActorRotation().Yaw, 0.f), Enemy->GetActorLocation());
+		EntityManager.GetFragmentDataChecked<FTransformFragment>(Agent.Entity).GetMutableTransform() = Agent.Transform;
+
+		FMechaCrowdHealthFragment& Health = EntityManager.GetFragmentDataChecked<FMechaCrowdHealthFragment>(Agent.Entity);
+		const float MaxHealth = Enemy->GetMaxHealth();
+		Health.Health = MaxHealth > 0.f ? Health.MaxHealth * (Enemy->GetHealth() / MaxHealth) : Health.Health;
+
+		EntityManager.GetFragmentDataChecked<FMechaCrowdMoveFragment>(Agent.Entity).Velocity = Enemy->GetVelocity();
+
+		// 사망이 아니므로 HandleDeath/킬 보고 없이 제거 (컨트롤러는 폰과 함께 정리됨)
+		Enemy->Destroy();
+	}
+
+	EntityManager.RemoveTagFromEntity(Agent.Entity, FMechaCrowdPromotedTag::StaticStruct());
+
+	Agent.Actor.Reset();
+	Agent.bPromoted = false;
+	--NumPromoted;
+}
+
+void UMechaCrowdSubsystem::ReleaseSlot(FMassEntityManager& EntityManager, int32 Slot)
+{
+	FAgent& Agent = Agents[Slot];
+
+	if (Agent.bPromoted)
+	{
+		--NumPromoted;
+	}
+
+	RemoveFromNetCell(Slot);
+
+	if (EntityManager.IsEntityValid(Agent.Entity))
+	{
+		EntityManager.DestroyEntity(Agent.Entity);
+	}
+
+	Agent = FAgent();
+	FreeSlots.Add(Slot);
+	--NumAlive;
+}
+
+bool UMechaCrowdSubsystem::CanShotReach(const FMechaCrowdShot& Shot, const APawn* Pawn) const
+{
+	// 원격 플레이어는 쏜 개체의 복제 셀을 받는 거리 안일 때만 (보이지 않는 적에게 맞지 않게)
+	if (!Pawn->IsLocallyControlled())
+	{
+		const TObjectPtr<AMechaCrowdNetCell>* NetCell = NetCells.Find(GetNetCellCoord(Shot.Origin));
+		if (!NetCell || !*NetCell
+			|| FVector::DistSquared((*NetCell)->GetActorLocation(), Pawn->GetActorLocation()) > FMath::Square(NetCullDistance))
+		{
+			return false;
+		}
+	}
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(MechaCrowdShot), false, Pawn);
+	const FVector Muzzle = Shot.Origin + FVector(0.f, 0.f, AgentRadius);
+	return !GetWorld()->LineTraceTestByChannel(Muzzle, Pawn->GetActorLocation(), ECC_Visibility, Params);
+}
+
+bool UMechaCrowdSubsystem::IsLockOnTarget(const AActor* Actor) const
+{
+	if (!Actor)
+	{
+		return false;
+	}
+
+	for (const TWeakObjectPtr<APawn>& Pawn : ViewerPawns)
+	{
+		const AMechaCharacterBase* Mecha = Cast<AMechaCharacterBase>(Pawn.Get());
+		if (Mecha && Mecha->GetLockOnTarget() == Actor)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+// ========================================
+// 내부 - 인스턴스 메시 표현
+// ========================================
+void UMechaCrowdSubsystem::EnsureRenderHost()
+{
+	if (CrowdInstances || CrowdMesh.IsNull())
+	{
+		return;
+	}
+
+	UStaticMesh* Mesh = CrowdMesh.LoadSynchronous();
+	if (!Mesh)
+	{
+		return;
+	}
+
+	FActorSpawnParameters Params;
+	Params.ObjectFlags |= RF_Transient;
+
+	RenderHost = GetWorld()->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, Params);
+	if (!RenderHost)
+	{
+		return;
+	}
+
+	CrowdInstances = NewObject<UInstancedStaticMeshComponent>(RenderHost, TEXT("CrowdInstances"));
+	CrowdInstances->SetMobility(EComponentMobility::Movable);
+	CrowdInstances->SetStaticMesh(Mesh);
+	CrowdInstances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	CrowdInstances->SetCastShadow(false);
+	RenderHost->SetRootComponent(CrowdInstances);
+	CrowdInstances->RegisterComponent();
+}
+
+void UMechaCrowdSubsystem::UpdateInstances()
+{
+	if (IsRunningDedicatedServer() || Agents.Num() == 0)
+	{
+		return;
+	}
+
+	EnsureRenderHost();
+	if (!CrowdInstances)
+	{
+		return;
+	}
+
+	// 슬롯 = 인스턴스 인덱스, 빈 슬롯/승격된 개체는 크기 0으로 숨김
+	InstanceTransforms.SetNum(Agents.Num(), false);
+	for (int32 Slot = 0; Slot < Agents.Num(); ++Slot)
+	{
+		const FAgent& Agent = Agents[Slot];
+		const bool bVisible = Agent.Entity.IsSet() && !Agent.bPromoted;
+
+		InstanceTransforms[Slot] = bVisible
+			? Agent.Transform
+			: FTransform(FQuat::Identity, Agent.Transform.GetLocation(), FVector::ZeroVector);
+	}
+
+	const int32 NumInstances = CrowdInstances->GetInstanceCount();
+	if (NumInstances < InstanceTransforms.Num())
+	{
+		TArray<FTransform> NewInstances(&InstanceTransforms[NumInstances], InstanceTransforms.Num() - NumInstances);
+		CrowdInstances->AddInstances(NewInstances, false, true);
+	}
+
+	CrowdInstances->BatchUpdateInstancesTransforms(0, InstanceTransforms, true, true, true);
+}
+
+// ========================================
+// 내부 - 네트워크 표현 (복제 셀)
+// ========================================
+bool UMechaCrowdSubsystem::UsesNetCells() const
+{
+	const ENetMode NetMode = GetWorld()->GetNetMode();
+	return NetMode == NM_DedicatedServer || NetMode == NM_ListenServer;
+}
+
+FIntPoint UMechaCrowdSubsystem::GetNetCellCoord(const FVector& Location) const
+{
+	const float CellSize = FMath::Max(NetCellSize, 1000.f);
+	return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+}
+
+AMechaCrowdNetCell* UMechaCrowdSubsystem::FindOrSpawnNetCell(const FIntPoint& Coord, const FVector& Location)
+{
+	if (const TObjectPtr<AMechaCrowdNetCell>* Existing = NetCells.Find(Coord))
+	{
+		return *Existing;
+	}
+
+	// 셀 중심 (높이는 처음 들어온 개체 기준). 컬 거리/주기는 Replication Graph 등록 전에 지정
+	const float CellSize = FMath::Max(NetCellSize, 1000.f);
+	const FVector Center((Coord.X + 0.5f) * CellSize, (Coord.Y + 0.5f) * CellSize, Location.Z);
+
+	AMechaCrowdNetCell* NetCell = GetWorld()->SpawnActorDeferred<AMechaCrowdNetCell>(AMechaCrowdNetCell::StaticClass(), FTransform(Center));
+	if (!NetCell)
+	{
+		return nullptr;
+	}
+
+	NetCell->NetCullDistanceSquared = FMath::Square(NetCullDistance);
+	NetCell->NetUpdateFrequency = NetCellUpdateFrequency;
+	NetCell->FinishSpawning(FTransform(Center));
+
+	NetCells.Add(Coord, NetCell);
+	return NetCell;
+}
+
+void UMechaCrowdSubsystem::UpdateNetCells(FMassEntityManager& EntityManager)
+{
+	for (int32 Slot = 0; Slot < Agents.Num(); ++Slot)
+	{
+		FAgent& Agent = Agents[Slot];
+		if (Agent.bPromoted || !EntityManager.IsEntityValid(Agent.Entity))
+		{
+			continue;
+		}
+
+		// 셀 경계를 넘으면 옮김
+		const FIntPoint Coord = GetNetCellCoord(Agent.Transform.GetLocation());
+		if (Agent.bInNetCell && Agent.NetCell != Coord)
+		{
+			RemoveFromNetCell(Slot);
+		}
+
+		AMechaCrowdNetCell* NetCell = FindOrSpawnNetCell(Coord, Agent.Transform.GetLocation());
+		if (!NetCell)
+		{
+			continue;
+		}
+
+		const FMechaCrowdHealthFragment& Health = EntityManager.GetFragmentDataChecked<FMechaCrowdHealthFragment>(Agent.Entity);
+		const float HealthRatio = Health.MaxHealth > 0.f ? Health.Health / Health.MaxHealth : 1.f;
+
+		NetCell->SetAgent(Slot, Agent.Transform, HealthRatio, NetMoveThreshold);
+		Agent.NetCell = Coord;
+		Agent.bInNetCell = true;
+	}
+}
+
+void UMechaCrowdSubsystem::RemoveFromNetCell(int32 Slot)
+{
+	FAgent& Agent = Agents[Slot];
+	if (!Agent.bInNetCell)
+	{
+		return;
+	}
+
+	if (AMechaCrowdNetCell* NetCell = NetCells.FindRef(Agent.NetCell))
+	{
+		NetCell->RemoveAgent(Slot);
+	}
+	Agent.bInNetCell = false;
+}
+
+// ========================================
+// 통계
+// ========================================
+void UMechaCrowdSubsystem::DumpStats() const
+{
+	UE_LOG(LogMecha, Log, TEXT("[Crowd] Agents=%d Promoted=%d/%d Viewers=%d Slots=%d NetCells=%d"),
+		NumAlive, NumPromoted, MaxPromoted, ViewerLocations.Num(), Agents.Num(), NetCells.Num());
+}
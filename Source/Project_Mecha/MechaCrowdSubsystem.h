@@ -0,0 +1,229 @@
+// MechaCrowdSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MassEntityTypes.h"
+#include "MechaCrowdFragments.h"
+// 설명:
+// - 잡몹 군중 모드. 보스가 아닌 적을 AEnemyMecha 액터 대신 Mass 엔티티(체력/타겟/무기/이동 프래그먼트)로 유지하고,
+//   UMechaCrowdSimProcessor가 워커 스레드에서 병렬로 시뮬레이션합니다. 액터는 필요한 개체에만 만듭니다.
+// - 표현 LOD (LODInterval마다, 게임 스레드):
+//   - 승격: 플레이어 PromoteDistance 이내 → GruntClass 액터 스폰, 엔티티 체력 복사 (최대 MaxPromoted)
+//           락온 입력 시 PromoteForLockOn으로 시야 원뿔 안의 개체를 즉시 승격
+//   - 강등: 모든 플레이어에서 DemoteDistance 밖 + 락온 대상 아님 → 체력/위치를 엔티티로 되돌리고 액터 제거
+//   - 승격된 액터가 죽으면 기존 HandleDeath가 미션 킬을 보고하고, 여기서는 엔티티만 정리합니다.
+//     승격 전 개체가 죽으면 여기서 AMissionManager::NotifyEnemyKilled(nullptr)를 보고합니다.
+// - 승격 전 개체 피격: 충돌체가 없으므로 플레이어 무기가 직접 넘깁니다.
+//   - 풀 투사체 액터(GA_GunFire 탄환, 미사일): 매 틱 이동 구간 판정, 맞으면 그 자리에서 멈춤
+//     (UMechaPooledProjectileComponent::SetCrowdDamage). 미사일은 멈춘 지점 ApplyDamageInRadius
+//   - 시뮬레이션 투사체: 매 스텝 이동 선분 판정 (맞으면 그 자리에서 착탄)
+// - 승격 전 개체는 인스턴스 스태틱 메시(CrowdMesh) 하나로 그립니다 (전용 서버에서는 생략).
+// - 시뮬레이션은 서버/스탠드얼론 전용. 네트워크 게임에서는 승격 전 개체를 공간 셀(NetCellSize)별
+//   AMechaCrowdNetCell에 넣어 위치/Yaw/체력 비율만 복제하고(컬 거리 NetCullDistance), 클라이언트가 인스턴스 메시로 그립니다.
+//   승격된 개체는 셀에서 빠지고 액터로 복제됩니다.
+// - 승격 전 개체의 발사: 시야(ECC_Visibility) 트레이스가 막히면 버림. 원격 플레이어는 쏜 개체의 셀이
+//   그 플레이어에게 복제되는 거리(NetCullDistance) 안일 때만 맞습니다 (보이지 않는 적에게 맞지 않음).
+// - 콘솔: Mecha.Crowd.Spawn <수> [반경], Mecha.Crowd.Dump
+#include "MechaCrowdSubsystem.generated.h"
+
+class AEnemyMecha;
+class AMechaCrowdNetCell;
+class UGameplayEffect;
+class UInstancedStaticMeshComponent;
+class UStaticMesh;
+struct FMassEntityManager;
+
+// 프로세서가 기록한 발사 (게임 스레드에서 데미지 적용)
+struct FMechaCrowdShot
+{
+    FVector Origin = FVector::ZeroVector;
+    int32 ViewerIndex = INDEX_NONE;
+    float Damage = 0.f;
+};
+
+UCLASS(Config = Game)
+class PROJECT_MECHA_API UMechaCrowdSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    static UMechaCrowdSubsystem* Get(const UObject* WorldContextObject);
+
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // Center 주변 Radius 안에 군중 개체 Count개 생성 예약 (다음 Tick에 생성), 예약한 수 반환
+    UFUNCTION(BlueprintCallable, Category = "Mecha|Crowd")
+    int32 SpawnCrowd(int32 Count, FVector Center, float Radius);
+
+    // 승격되지 않은 개체에 범위 데미지 (승격된 개체는 액터 쪽 데미지로 처리)
+    UFUNCTION(BlueprintCallable, Category = "Mecha|Crowd")
+    int32 ApplyDamageInRadius(FVector Origin, float Radius, float Damage);
+
+    // Start → End 선분에 가장 먼저 닿는 승격 전 개체 하나에 데미지, 맞은 위치 반환
+    bool ApplyDamageAlongSegment(const FVector& Start, const FVector& End, float Damage, FVector& OutHitLocation);
+
+    // 데미지 없이 판정만 (범위 데미지 무기가 멈출 위치 찾기용)
+    bool TraceAlongSegment(const FVector& Start, const FVector& End, FVector& OutHitLocation) const;
+
+    // 락온 후보가 없을 때 시야 원뿔 안에서 가장 중앙에 가까운 개체를 승격
+    AEnemyMecha* PromoteForLockOn(const FVector& Origin, const FVector& Forward, float MaxDistance, float MaxAngleDeg);
+
+    UFUNCTION(BlueprintPure, Category = "Mecha|Crowd")
+    int32 GetNumAgents() const { return NumAlive; }
+
+    UFUNCTION(BlueprintPure, Category = "Mecha|Crowd")
+    int32 GetNumPromoted() const { return NumPromoted; }
+
+    // 클라이언트 복제 셀도 같은 메시로 그림
+    const TSoftObjectPtr<UStaticMesh>& GetCrowdMesh() const { return CrowdMesh; }
+
+    // ===== 프로세서용 (워커 스레드) =====
+    // 플레이어 폰 위치 스냅샷 (게임 스레드 Tick에서만 갱신)
+    const TArray<FVector>& GetViewerLocations() const { return ViewerLocations; }
+
+    void QueueShots(TConstArrayView<FMechaCrowdShot> Shots);
+
+    void DumpStats() const;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+    // ===== 표현 (DefaultGame.ini) =====
+    // 승격 시 스폰할 잡몹 액터
+    UPROPERTY(Config)
+    TSoftClassPtr<AEnemyMecha> GruntClass;
+
+    // 승격 전 개체를 그릴 메시
+    UPROPERTY(Config)
+    TSoftObjectPtr<UStaticMesh> CrowdMesh;
+
+    // 발사 데미지 GE (SetByCaller Data.Damage)
+    UPROPERTY(Config)
+    TSoftClassPtr<UGameplayEffect> ShotDamageEffect;
+
+    // ===== LOD 기준 =====
+    UPROPERTY(Config)
+    float LODInterval = 0.25f;
+
+    UPROPERTY(Config)
+    float PromoteDistance = 4000.f;
+
+    // PromoteDistance보다 커야 경계에서 깜빡이지 않음
+    UPROPERTY(Config)
+    float DemoteDistance = 6000.f;
+
+    UPROPERTY(Config)
+    int32 MaxPromoted = 32;
+
+    // 승격 전 개체 피격 구 반지름 (중심은 발밑에서 이만큼 위). 발사 시야 트레이스 높이로도 사용
+    UPROPERTY(Config)
+    float AgentRadius = 150.f;
+
+    // ===== 네트워크 표현 (AMechaCrowdNetCell) =====
+    // 복제 셀 한 변 길이
+    UPROPERTY(Config)
+    float NetCellSize = 10000.f;
+
+    // 셀 액터 컬 거리 (이 거리 밖 연결에는 복제 안 함, 원격 플레이어 피격 판정에도 사용)
+    UPROPERTY(Config)
+    float NetCullDistance = 15000.f;
+
+    UPROPERTY(Config)
+    float NetCellUpdateFrequency = 10.f;
+
+    // 이보다 적게 움직이면 위치를 다시 보내지 않음
+    UPROPERTY(Config)
+    float NetMoveThreshold = 25.f;
+
+    // ===== 개체 기본값 =====
+    UPROPERTY(Config)
+    FMechaCrowdHealthFragment DefaultHealth;
+
+    UPROPERTY(Config)
+    FMechaCrowdWeaponFragment DefaultWeapon;
+
+    UPROPERTY(Config)
+    FMechaCrowdMoveFragment DefaultMove;
+
+private:
+    // 인스턴스 메시 인덱스와 같은 순서 (빈 슬롯은 재사용)
+    struct FAgent
+    {
+        FMassEntityHandle Entity;
+        TWeakObjectPtr<AEnemyMecha> Actor;
+
+        // 이번 프레임 엔티티(승격 시 액터) 트랜스폼 캐시
+        FTransform Transform;
+        bool bPromoted = false;
+
+        // 들어가 있는 복제 셀 (네트워크 게임, 승격 전만)
+        FIntPoint NetCell = FIntPoint::ZeroValue;
+        bool bInNetCell = false;
+    };
+
+    // 엔티티 생성/삭제는 프로세서가 돌지 않는 Tick에서만 (SpawnCrowd는 예약만)
+    struct FPendingSpawn
+    {
+        int32 Count = 0;
+        FVector Center = FVector::ZeroVector;
+        float Radius = 0.f;
+    };
+
+    TArray<FAgent> Agents;
+    TArray<int32> FreeSlots;
+    TArray<FPendingSpawn> PendingSpawns;
+
+    int32 NumAlive = 0;
+    int32 NumPromoted = 0;
+
+    FMassArchetypeHandle Archetype;
+
+    TArray<FVector> ViewerLocations;
+    TArray<TWeakObjectPtr<APawn>> ViewerPawns;
+
+    TArray<FMechaCrowdShot> PendingShots;
+    FCriticalSection ShotsLock;
+
+    UPROPERTY(Transient)
+    TObjectPtr<AActor> RenderHost = nullptr;
+
+    UPROPERTY(Transient)
+    TObjectPtr<UInstancedStaticMeshComponent> CrowdInstances = nullptr;
+
+    TArray<FTransform> InstanceTransforms;
+
+    UPROPERTY(Transient)
+    TMap<FIntPoint, TObjectPtr<AMechaCrowdNetCell>> NetCells;
+
+    float TimeSinceLOD = 0.f;
+
+    bool IsCrowdAuthority() const;
+    FMassEntityManager* GetEntityManager() const;
+
+    void ProcessPendingSpawns(FMassEntityManager& EntityManager);
+    void GatherViewers();
+    void ApplyShots();
+    void SyncAgents(FMassEntityManager& EntityManager);
+    void UpdateRepresentationLOD(FMassEntityManager& EntityManager);
+    void UpdateInstances();
+
+    bool UsesNetCells() const;
+    void UpdateNetCells(FMassEntityManager& EntityManager);
+    FIntPoint GetNetCellCoord(const FVector& Location) const;
+    AMechaCrowdNetCell* FindOrSpawnNetCell(const FIntPoint& Coord, const FVector& Location);
+    void RemoveFromNetCell(int32 Slot);
+
+    bool Promote(FMassEntityManager& EntityManager, int32 Slot);
+    void Demote(FMassEntityManager& EntityManager, int32 Slot);
+    void ReleaseSlot(FMassEntityManager& EntityManager, int32 Slot);
+
+    bool IsLockOnTarget(const AActor* Actor) const;
+    bool CanShotReach(const FMechaCrowdShot& Shot, const APawn* Pawn) const;
+
+    // Start → End 선분에 가장 먼저 닿는 승격 전 개체 슬롯 (없으면 INDEX_NONE)
+    int32 FindFirstAlongSegment(const FMassEntityManager& EntityManager, const FVector& Start, const FVector& End, FVector& OutHitLocation) const;
+    void EnsureRenderHost();
+};
@@ -0,0 +1,360 @@
+// MechaFXPoolSubsystem.cpp
+// Cascade 이펙트 컴포넌트 풀 - 템플릿별 재사용, 전체 동시 재생 상한, 거리 거절, 재생 종료 시 자동 반납
+
+#include "MechaFXPoolSubsystem.h"
+#include "MechaStats.h"
+#include "Project_Mecha.h"
+
+#include "Camera/PlayerCameraManager.h"
+#include "Components/SceneComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "Particles/ParticleSystem.h"
+#include "Particles/ParticleSystemComponent.h"
+
+DECLARE_CYCLE_STAT(TEXT("FX Pool Spawn"), STAT_Mecha_FXPoolSpawn, STATGROUP_Mecha);
+DECLARE_DWORD_COUNTER_STAT(TEXT("FX Pool Rejected"), STAT_Mecha_FXPoolRejected, STATGROUP_Mecha);
+
+static TAutoConsoleVariable<int32> CVarMechaFXPoolEnable(
+	TEXT("Mecha.FXPool.Enable"),
+	1,
+	TEXT("1이면 총구 섬광/타격/착탄/부스터 이펙트를 풀의 컴포넌트로 재생합니다. 0이면 재생할 때마다 새 컴포넌트를 스폰합니다."));
+
+// 콘솔 명령: 현재 월드의 풀 통계 출력
+static FAutoConsoleCommandWithWorld GMechaFXPoolDumpCmd(
+	TEXT("Mecha.FXPool.Dump"),
+	TEXT("이펙트 풀의 템플릿별 Hit/Miss/High-water mark와 거절 수를 출력합니다."),
+	FConsoleCommandWithWorldDelegate::CreateStatic([](UWorld* World)
+		{
+			if (const UMechaFXPoolSubsystem* Pool = UMechaFXPoolSubsystem::Get(World))
+			{
+				Pool->DumpStats();
+			}
+		}));
+
+// ========================================
+// 접근자
+// ========================================
+UMechaFXPoolSubsystem* UMechaFXPoolSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine || !WorldContextObject) return nullptr;
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UMechaFXPoolSubsystem>() : nullptr;
+}
+
+bool UMechaFXPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// ========================================
+// 레벨 시작 - 설정된 템플릿 미리 채우기
+// ========================================
+void UMechaFXPoolSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	for (const FMechaFXPoolPrewarm& Entry : PrewarmTemplates)
+	{
+		if (UParticleSystem* Template = Entry.Template.LoadSynchronous())
+		{
+			PrewarmPool(Template, Entry.Count);
+		}
+	}
+}
+
+void UMechaFXPoolSubsystem::Deinitialize()
+{
+	// 컴포넌트는 월드 소유(액터 없음)라 직접 정리
+	for (UParticleSystemComponent* PSC : Active)
+	{
+		if (IsValid(PSC))
+		{
+			PSC->DestroyComponent();
+		}
+	}
+	Active.Empty();
+
+	for (TPair<TObjectPtr<UParticleSystem>, FMechaFXPool>& Pair : Pools)
+	{
+		for (UParticleSystemComponent* PSC : Pair.Value.Available)
+		{
+			if (IsValid(PSC))
+			{
+				PSC->DestroyComponent();
+			}
+		}
+	}
+	Pools.Empty();
+
+	Super::Deinitialize();
+}
+
+// ========================================
+// 재생 - 월드 위치
+// ========================================
+UParticleSystemComponent* UMechaFXPoolSubsystem::SpawnFXAtLocation(
+	const UObject* WorldContextObject,
+	UParticleSystem* Template,
+	const FVector& Location,
+	const FRotator& Rotation,
+	const FVector& Scale)
+{
+	if (!Template || !WorldContextObject) return nullptr;
+
+	UMechaFXPoolSubsystem* Subsystem = CVarMechaFXPoolEnable.GetValueOnGameThread() != 0 ? Get(WorldContextObject) : nullptr;
+	if (!Subsystem)
+	{
+		return UGameplayStatics::SpawnEmitterAtLocation(WorldContextObject, Template, Location, Rotation, Scale);
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_Mecha_FXPoolSpawn);
+
+	if (Subsystem->ShouldReject(Location, true)) return nullptr;
+
+	UParticleSystemComponent* PSC = Subsystem->Acquire(Template);
+	if (!PSC) return nullptr;
+
+	PSC->SetWorldTransform(FTransform(Rotation, Location, Scale));
+	Subsystem->ActivatePooled(PSC, Subsystem->Pools.FindChecked(Template));
+	return PSC;
+}
+
+// ========================================
+// 재생 - 소켓 부착
+// ========================================
+UParticleSystemComponent* UMechaFXPoolSubsystem::SpawnFXAttached(
+	UParticleSystem* Template,
+	USceneComponent* AttachTo,
+	FName SocketName,
+	const FVector& Location,
+	const FRotator& Rotation)
+{
+	if (!Template || !AttachTo) return nullptr;
+
+	UMechaFXPoolSubsystem* Subsystem = CVarMechaFXPoolEnable.GetValueOnGameThread() != 0 ? Get(AttachTo) : nullptr;
+	if (!Subsystem)
+	{
+		return UGameplayStatics::SpawnEmitterAttached(Template, AttachTo, SocketName, Location, Rotation, EAttachLocation::SnapToTarget, true);
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_Mecha_FXPoolSpawn);
+
+	// 부착 이펙트는 소유자가 끄는 지속 이펙트라 상한으로 거절하지 않음
+	if (Subsystem->ShouldReject(AttachTo->GetSocketLocation(SocketName), false)) return nullptr;
+
+	UParticleSystemComponent* PSC = Subsystem->Acquire(Template);
+	if (!PSC) return nullptr;
+
+	PSC->AttachToComponent(AttachTo, FAttachmentTransformRules::KeepRelativeTransform, SocketName);
+	PSC->SetRelativeTransform(FTransform(Rotation, Location));
+	Subsystem->ActivatePooled(PSC, Subsystem->Pools.FindChecked(Template));
+	return PSC;
+}
+
+// ========================================
+// 거절 판정 (전용 서버 / 동시 재생 상한 / 거리)
+// ========================================
+bool UMechaFXPoolSubsystem::ShouldReject(const FVector& Location, bool bCheckCap)
+{
+	const UWorld* World = GetWorld();
+	if (!World || World->GetNetMode() == NM_DedicatedServer) return true;
+
+	if (bCheckCap && MaxActiveFX > 0 && Active.Num() >= MaxActiveFX)
+	{
+		++NumRejectedByCap;
+		INC_DWORD_STAT(STAT_Mecha_FXPoolRejected);
+		return true;
+	}
+
+	if (!IsWithinCullDistance(Location))
+	{
+		++NumRejectedByDistance;
+		INC_DWORD_STAT(STAT_Mecha_FXPoolRejected);
+		return true;
+	}
+
+	return false;
+}
+
+bool UMechaFXPoolSubsystem::IsWithinCullDistance(const FVector& Location)
+{
+	if (CullDistance <= 0.f) return true;
+
+	// 로컬 카메라 위치는 프레임당 한 번만 모음
+	if (ViewLocationsFrame != GFrameCounter)
+	{
+		ViewLocationsFrame = GFrameCounter;
+		ViewLocations.Reset();
+
+		for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+		{
+			const APlayerController* PC = It->Get();
+			if (PC && PC->IsLocalController() && PC->PlayerCameraManager)
+			{
+				ViewLocations.Add(PC->PlayerCameraManager->GetCameraLocation());
+			}
+		}
+	}
+
+	// 보는 플레이어가 없으면 거절하지 않음
+	if (ViewLocations.Num() == 0) return true;
+
+	const float CullDistSq = FMath::Square(CullDistance);
+	for (const FVector& ViewLocation : ViewLocations)
+	{
+		if (FVector::DistSquared(ViewLocation, Location) <= CullDistSq)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+// ========================================
+// 미리 채우기
+// ========================================
+void UMechaFXPoolSubsystem::PrewarmPool(UParticleSystem* Template, int32 Count)
+{
+	const UWorld* World = GetWorld();
+	if (!Template || Count <= 0 || !World || World->GetNetMode() == NM_DedicatedServer) return;
+
+	FMechaFXPool& Pool = Pools.FindOrAdd(Template);
+
+	// 이미 만들어진 개수(대기 + 재생 중)는 제외
+	const int32 Target = FMath::Min(Count, MaxPooledPerTemplate);
+	const int32 ToCreate = Target - (Pool.Available.Num() + Pool.Stats.InUse);
+
+	for (int32 i = 0; i < ToCreate; ++i)
+	{
+		UParticleSystemComponent* PSC = CreatePooledComponent(Template);
+		if (!PSC) break;
+
+		Pool.Available.Add(PSC);
+	}
+
+	Pool.Stats.Available = Pool.Available.Num();
+}
+
+// ========================================
+// 풀에서 꺼내기
+// ========================================
+UParticleSystemComponent* UMechaFXPoolSubsystem::Acquire(UParticleSystem* Template)
+{
+	FMechaFXPool& Pool = Pools.FindOrAdd(Template);
+
+	// 대기 목록에서 유효한 컴포넌트 찾기 (외부에서 파괴된 항목은 버림)
+	UParticleSystemComponent* PSC = nullptr;
+	while (Pool.Available.Num() > 0)
+	{
+		UParticleSystemComponent* Candidate = Pool.Available.Pop(false);
+		if (IsValid(Candidate))
+		{
+			PSC = Candidate;
+			break;
+		}
+	}
+
+	if (PSC)
+	{
+		++Pool.Stats.Hits;
+	}
+	else
+	{
+		++Pool.Stats.Misses;
+		PSC = CreatePooledComponent(Template);
+	}
+
+	Pool.Stats.Available = Pool.Available.Num();
+	return PSC;
+}
+
+// ========================================
+// 내부 - 새 컴포넌트 생성 (월드에 등록, 비활성)
+// ========================================
+UParticleSystemComponent* UMechaFXPoolSubsystem::CreatePooledComponent(UParticleSystem* Template)
+{
+	UWorld* World = GetWorld();
+	if (!World) return nullptr;
+
+	UParticleSystemComponent* PSC = NewObject<UParticleSystemComponent>(World);
+	PSC->bAutoActivate = false;
+	PSC->bAutoDestroy = false;
+	PSC->bAllowAnyoneToDestroyMe = true;
+	PSC->SecondsBeforeInactive = 0.f;
+	PSC->SetTemplate(Template);
+	PSC->OnSystemFinished.AddUniqueDynamic(this, &UMechaFXPoolSubsystem::OnPooledSystemFinished);
+	PSC->RegisterComponentWithWorld(World);
+
+	return PSC;
+}
+
+// ========================================
+// 내부 - 활성화 (리셋 재생)
+// ========================================
+void UMechaFXPoolSubsystem::ActivatePooled(UParticleSystemComponent* PSC, FMechaFXPool& Pool)
+{
+	PSC->Activate(true);
+
+	Active.Add(PSC);
+
+	++Pool.Stats.InUse;
+	Pool.Stats.HighWaterMark = FMath::Max(Pool.Stats.HighWaterMark, Pool.Stats.InUse);
+}
+
+// ========================================
+// 재생 종료 - 분리 후 대기 목록으로
+// ========================================
+void UMechaFXPoolSubsystem::OnPooledSystemFinished(UParticleSystemComponent* PSC)
+{
+	if (!PSC || Active.RemoveSingleSwap(PSC, false) == 0) return;
+
+	FMechaFXPool* Pool = Pools.Find(PSC->Template);
+	if (Pool)
+	{
+		Pool->Stats.InUse = FMath::Max(0, Pool->Stats.InUse - 1);
+	}
+
+	if (!IsValid(PSC)) return;
+
+	if (PSC->GetAttachParent())
+	{
+		PSC->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+	}
+
+	// 보관 한도를 넘으면 엔진이 종료 처리 후 파괴하도록
+	if (!Pool || Pool->Available.Num() >= MaxPooledPerTemplate)
+	{
+		PSC->bAutoDestroy = true;
+		return;
+	}
+
+	Pool->Available.Add(PSC);
+	Pool->Stats.Available = Pool->Available.Num();
+}
+
+// ========================================
+// 통계
+// ========================================
+FMechaFXPoolStats UMechaFXPoolSubsystem::GetPoolStats(UParticleSystem* Template) const
+{
+	const FMechaFXPool* Pool = Pools.Find(Template);
+	return Pool ? Pool->Stats : FMechaFXPoolStats();
+}
+
+void UMechaFXPoolSubsystem::DumpStats() const
+{
+	UE_LOG(LogMecha, Log, TEXT("[FXPool] %d template(s), Active=%d/%d, Rejected: Cap=%d Distance=%d"),
+		Pools.Num(), Active.Num(), MaxActiveFX, NumRejectedByCap, NumRejectedByDistance);
+
+	for (const TPair<TObjectPtr<UParticleSystem>, FMechaFXPool>& Pair : Pools)
+	{
+		const FMechaFXPoolStats& Stats = Pair.Value.Stats;
+		UE_LOG(LogMecha, Log, TEXT("  %s: Hits=%d Misses=%d HighWater=%d InUse=%d Available=%d"),
+			*GetNameSafe(Pair.Key), Stats.Hits, Stats.Misses, Stats.HighWaterMark, Stats.InUse, Stats.Available);
+	}
+}
@@ -0,0 +1,149 @@
+// MechaFXPoolSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+// 설명:
+// - Cascade 이펙트(UParticleSystemComponent) 풀. 총구 섬광/타격/착탄/부스터처럼 자주 재생되는 이펙트를
+//   템플릿별로 미리 만들어 둔 컴포넌트로 재생해서, 재생할 때마다 컴포넌트를 생성/등록/파괴하지 않습니다.
+// - 재생: SpawnFXAtLocation(월드 위치) / SpawnFXAttached(소켓 부착). 컴포넌트를 꺼내 부착/위치 지정 후 리셋 활성화.
+// - 반납: 파티클이 모두 끝나면(OnSystemFinished) 자동으로 분리 후 대기 목록으로. 루프 이펙트는 호출부가
+//   DeactivateSystem을 부르면 남은 파티클이 끝난 뒤 반납됩니다. 반환된 컴포넌트를 보관했다가 재생이 끝난 뒤 쓰면 안 됩니다.
+// - 거절: 동시 재생 수가 MaxActiveFX 이상이면 월드 위치 이펙트는 재생하지 않음 (부착 이펙트는 세되 거절하지 않음).
+//   로컬 플레이어 카메라에서 CullDistance보다 먼 이펙트도 재생하지 않음. 화면이 없는 전용 서버는 모두 거절.
+// - 서브시스템이 없거나 Mecha.FXPool.Enable 0 이면 UGameplayStatics로 바로 스폰합니다 (거리/상한 거절 없음).
+// - 템플릿별 Hit/Miss/최대 동시 사용 수와 거절 수를 집계합니다. 콘솔: Mecha.FXPool.Dump
+#include "MechaFXPoolSubsystem.generated.h"
+
+class UParticleSystem;
+class UParticleSystemComponent;
+class USceneComponent;
+
+// 템플릿별 풀 통계
+USTRUCT(BlueprintType)
+struct FMechaFXPoolStats
+{
+    GENERATED_BODY()
+
+    // 대기 목록에서 바로 꺼내 쓴 횟수
+    UPROPERTY(BlueprintReadOnly, Category = "Mecha|FXPool")
+    int32 Hits = 0;
+
+    // 대기 목록이 비어 새로 만든 횟수
+    UPROPERTY(BlueprintReadOnly, Category = "Mecha|FXPool")
+    int32 Misses = 0;
+
+    // 동시에 재생된 최대 개수
+    UPROPERTY(BlueprintReadOnly, Category = "Mecha|FXPool")
+    int32 HighWaterMark = 0;
+
+    // 현재 재생 중인 개수
+    UPROPERTY(BlueprintReadOnly, Category = "Mecha|FXPool")
+    int32 InUse = 0;
+
+    // 대기 중인 개수
+    UPROPERTY(BlueprintReadOnly, Category = "Mecha|FXPool")
+    int32 Available = 0;
+};
+
+// 레벨 시작 시 미리 채워 둘 템플릿 (DefaultGame.ini)
+USTRUCT()
+struct FMechaFXPoolPrewarm
+{
+    GENERATED_BODY()
+
+    UPROPERTY(Config)
+    TSoftObjectPtr<UParticleSystem> Template;
+
+    UPROPERTY(Config)
+    int32 Count = 0;
+};
+
+// 템플릿 하나의 컴포넌트 목록 (GC 참조 유지)
+USTRUCT()
+struct FMechaFXPool
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<TObjectPtr<UParticleSystemComponent>> Available;
+
+    FMechaFXPoolStats Stats;
+};
+
+UCLASS(Config = Game)
+class PROJECT_MECHA_API UMechaFXPoolSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    static UMechaFXPoolSubsystem* Get(const UObject* WorldContextObject);
+
+    // 월드 위치에 한 번 재생 (거절되면 nullptr)
+    static UParticleSystemComponent* SpawnFXAtLocation(const UObject* WorldContextObject, UParticleSystem* Template,
+        const FVector& Location, const FRotator& Rotation = FRotator::ZeroRotator, const FVector& Scale = FVector(1.f));
+
+    // 컴포넌트 소켓에 부착해서 재생 (SnapToTarget, Location/Rotation은 소켓 기준 상대값)
+    static UParticleSystemComponent* SpawnFXAttached(UParticleSystem* Template, USceneComponent* AttachTo, FName SocketName,
+        const FVector& Location = FVector::ZeroVector, const FRotator& Rotation = FRotator::ZeroRotator);
+
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Deinitialize() override;
+
+    // 템플릿별 대기 컴포넌트를 Count개까지 미리 만듦
+    UFUNCTION(BlueprintCallable, Category = "Mecha|FXPool")
+    void PrewarmPool(UParticleSystem* Template, int32 Count);
+
+    UFUNCTION(BlueprintPure, Category = "Mecha|FXPool")
+    FMechaFXPoolStats GetPoolStats(UParticleSystem* Template) const;
+
+    UFUNCTION(BlueprintPure, Category = "Mecha|FXPool")
+    int32 GetNumActiveFX() const { return Active.Num(); }
+
+    // 전체 풀 통계를 로그로 출력
+    void DumpStats() const;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+    // 레벨 시작 시 미리 채울 템플릿 목록
+    UPROPERTY(Config)
+    TArray<FMechaFXPoolPrewarm> PrewarmTemplates;
+
+    // 전체 동시 재생 상한 (월드 위치 이펙트만 거절)
+    UPROPERTY(Config)
+    int32 MaxActiveFX = 96;
+
+    // 로컬 플레이어 카메라에서 이보다 멀면 재생하지 않음 (0이면 검사 안 함)
+    UPROPERTY(Config)
+    float CullDistance = 15000.f;
+
+    // 템플릿별 최대 보관 개수 (초과분은 반납 시 파괴)
+    UPROPERTY(Config)
+    int32 MaxPooledPerTemplate = 32;
+
+private:
+    UPROPERTY()
+    TMap<TObjectPtr<UParticleSystem>, FMechaFXPool> Pools;
+
+    // 재생 중인 컴포넌트 (반납 시 제거)
+    UPROPERTY()
+    TArray<TObjectPtr<UParticleSystemComponent>> Active;
+
+    int32 NumRejectedByCap = 0;
+    int32 NumRejectedByDistance = 0;
+
+    // 로컬 플레이어 카메라 위치 (프레임당 한 번 갱신)
+    TArray<FVector> ViewLocations;
+    uint64 ViewLocationsFrame = 0;
+
+    bool ShouldReject(const FVector& Location, bool bCheckCap);
+    bool IsWithinCullDistance(const FVector& Location);
+
+    UParticleSystemComponent* Acquire(UParticleSystem* Template);
+    UParticleSystemComponent* CreatePooledComponent(UParticleSystem* Template);
+    void ActivatePooled(UParticleSystemComponent* PSC, FMechaFXPool& Pool);
+
+    UFUNCTION()
+    void OnPooledSystemFinished(UParticleSystemComponent* PSC);
+};
@@ -0,0 +1,68 @@
+// MechaHealthBarOverlay.cpp
+// 적 체력바 일괄 그리기 - 배경/잔상/체력 레이어별 박스 배치
+
+#include "MechaHealthBarOverlay.h"
+#include "MechaStats.h"
+
+#include "Rendering/DrawElements.h"
+#include "Styling/CoreStyle.h"
+
+DECLARE_CYCLE_STAT(TEXT("Health Bar Paint"), STAT_Mecha_HealthBarPaint, STATGROUP_Mecha);
+
+void SMechaHealthBarOverlay::Construct(const FArguments& InArgs)
+{
+	BarSize = InArgs._BarSize;
+	BarBrush = FCoreStyle::Get().GetBrush(TEXT("GenericWhiteBox"));
+}
+
+// ========================================
+// 그리기 (레이어 3개: 배경 → 잔상 → 체력)
+// ========================================
+int32 SMechaHealthBarOverlay::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+	FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_Mecha_HealthBarPaint);
+
+	if (Bars.Num() == 0 || !BarBrush)
+	{
+		return LayerId;
+	}
+
+	// 뷰포트 픽셀 → 로컬 (DPI 배율)
+	const float InvScale = AllottedGeometry.Scale > 0.f ? 1.f / AllottedGeometry.Scale : 1.f;
+	const FLinearColor BackgroundColor(0.f, 0.f, 0.f, 0.6f);
+	const FLinearColor TrailColor(1.f, 1.f, 1.f, 0.8f);
+
+	const int32 BackgroundLayer = LayerId;
+	const int32 TrailLayer = LayerId + 1;
+	const int32 FillLayer = LayerId + 2;
+
+	for (const FMechaHealthBarElement& Bar : Bars)
+	{
+		// 바 중심이 머리 위 지점
+		const FVector2D TopLeft = Bar.ScreenPosition * InvScale - BarSize * 0.5f;
+
+		FSlateDrawElement::MakeBox(
+			OutDrawElements, BackgroundLayer,
+			AllottedGeometry.ToPaintGeometry(BarSize, FSlateLayoutTransform(TopLeft)),
+			BarBrush, ESlateDrawEffect::None, BackgroundColor.CopyWithNewOpacity(BackgroundColor.A * Bar.Opacity));
+
+		if (Bar.TrailPercent > Bar.Percent)
+		{
+			FSlateDrawElement::MakeBox(
+				OutDrawElements, TrailLayer,
+				AllottedGeometry.ToPaintGeometry(FVector2D(BarSize.X * Bar.TrailPercent, BarSize.Y), FSlateLayoutTransform(TopLeft)),
+				BarBrush, ESlateDrawEffect::None, TrailColor.CopyWithNewOpacity(TrailColor.A * Bar.Opacity));
+		}
+
+		if (Bar.Percent > 0.f)
+		{
+			FSlateDrawElement::MakeBox(
+				OutDrawElements, FillLayer,
+				AllottedGeometry.ToPaintGeometry(FVector2D(BarSize.X * Bar.Percent, BarSize.Y), FSlateLayoutTransform(TopLeft)),
+				BarBrush, ESlateDrawEffect::None, Bar.Color.CopyWithNewOpacity(Bar.Color.A * Bar.Opacity));
+		}
+	}
+
+	return FillLayer;
+}
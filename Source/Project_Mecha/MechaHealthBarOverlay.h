@@ -0,0 +1,51 @@
+// MechaHealthBarOverlay.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SLeafWidget.h"
+// 설명:
+// - 적 체력바 일괄 그리기용 Slate 오버레이 (게임 뷰포트 전체를 덮는 잎 위젯 하나).
+// - UMechaHealthBarSubsystem이 매 프레임 Bars를 채우고, OnPaint는 배경 / 잔상 / 체력 세 레이어로
+//   같은 브러시의 박스만 그립니다. 레이어·브러시가 같은 요소는 Slate가 묶어서 그리므로
+//   적 수와 상관없이 드로우 배치는 세 개입니다.
+// - Bars 배열은 비우기만 하고 다시 채워 쓰므로 프레임마다 할당이 없습니다.
+
+// 바 하나 (화면 좌표는 뷰포트 픽셀)
+struct FMechaHealthBarElement
+{
+    FVector2D ScreenPosition = FVector2D::ZeroVector;
+    float Percent = 1.f;
+    float TrailPercent = 1.f;
+    float Opacity = 1.f;
+    FLinearColor Color = FLinearColor::White;
+};
+
+class PROJECT_MECHA_API SMechaHealthBarOverlay : public SLeafWidget
+{
+public:
+    SLATE_BEGIN_ARGS(SMechaHealthBarOverlay)
+        : _BarSize(FVector2D(80.f, 6.f))
+    {
+        _Visibility = EVisibility::HitTestInvisible;
+    }
+        SLATE_ARGUMENT(FVector2D, BarSize)
+    SLATE_END_ARGS()
+
+    void Construct(const FArguments& InArgs);
+
+    // 서브시스템이 매 프레임 다시 채움
+    TArray<FMechaHealthBarElement>& GetMutableBars() { return Bars; }
+
+    void SetBarSize(const FVector2D& InBarSize) { BarSize = InBarSize; }
+
+    virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+        FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+
+    virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override { return FVector2D::ZeroVector; }
+
+private:
+    TArray<FMechaHealthBarElement> Bars;
+    FVector2D BarSize = FVector2D(80.f, 6.f);
+
+    const FSlateBrush* BarBrush = nullptr;
+};
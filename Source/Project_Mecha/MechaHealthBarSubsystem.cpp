@@ -0,0 +1,267 @@
+// MechaHealthBarSubsystem.cpp
+// 적 체력바 오버레이 - 등록부 기반 일괄 투영, 거리/화면/중요도 컬링, 클라이언트 보간
+
+#include "MechaHealthBarSubsystem.h"
+#include "MechaHealthBarOverlay.h"
+#include "MechaStats.h"
+#include "MechaCombatRegistrySubsystem.h"
+#include "MechaSignificanceSubsystem.h"
+#include "EnemyMecha.h"
+#include "EnemyHUDWidget.h"
+
+#include "Engine/Engine.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "SceneView.h"
+#include "UnrealClient.h"
+
+DECLARE_CYCLE_STAT(TEXT("Health Bar Update"), STAT_Mecha_HealthBarUpdate, STATGROUP_Mecha);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Health Bars Drawn"), STAT_Mecha_HealthBarsDrawn, STATGROUP_Mecha);
+
+static TAutoConsoleVariable<int32> CVarMechaHealthBarOverlay(
+	TEXT("Mecha.UI.HealthBarOverlay"),
+	1,
+	TEXT("1이면 적 체력바를 뷰포트 오버레이 하나로 일괄 그립니다. 0이면 적마다 위젯 컴포넌트를 씁니다 (이후 스폰되는 적부터 적용)."));
+
+// ========================================
+// 접근자
+// ========================================
+UMechaHealthBarSubsystem* UMechaHealthBarSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine || !WorldContextObject) return nullptr;
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UMechaHealthBarSubsystem>() : nullptr;
+}
+
+bool UMechaHealthBarSubsystem::IsOverlayEnabled(const UObject* WorldContextObject)
+{
+	if (CVarMechaHealthBarOverlay.GetValueOnGameThread() == 0)
+	{
+		return false;
+	}
+
+	// 화면이 없는 전용 서버는 어느 쪽도 그리지 않음
+	const UWorld* World = (GEngine && WorldContextObject)
+		? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull)
+		: nullptr;
+	return World && World->GetNetMode() != NM_DedicatedServer;
+}
+
+bool UMechaHealthBarSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UMechaHealthBarSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMechaHealthBarSubsystem, STATGROUP_Tickables);
+}
+
+void UMechaHealthBarSubsystem::Deinitialize()
+{
+	RemoveOverlay();
+	States.Empty();
+
+	Super::Deinitialize();
+}
+
+// ========================================
+// 오버레이 생성 / 제거
+// ========================================
+void UMechaHealthBarSubsystem::EnsureOverlay()
+{
+	if (Overlay.IsValid())
+	{
+		return;
+	}
+
+	UGameViewportClient* ViewportClient = GetWorld() ? GetWorld()->GetGameViewport() : nullptr;
+	if (!ViewportClient)
+	{
+		return;
+	}
+
+	// UMG HUD(AddToViewport)보다 아래
+	SAssignNew(Overlay, SMechaHealthBarOverlay).BarSize(BarSize);
+	ViewportClient->AddViewportWidgetContent(Overlay.ToSharedRef(), 0);
+}
+
+void UMechaHealthBarSubsystem::RemoveOverlay()
+{
+	if (!Overlay.IsValid())
+	{
+		return;
+	}
+
+	if (UGameViewportClient* ViewportClient = GetWorld() ? GetWorld()->GetGameViewport() : nullptr)
+	{
+		ViewportClient->RemoveViewportWidgetContent(Overlay.ToSharedRef());
+	}
+	Overlay.Reset();
+}
+
+// ========================================
+// 매 프레임 - 상태 보간 + 투영 + 바 목록 채우기
+// ========================================
+void UMechaHealthBarSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Mecha_HealthBarUpdate);
+
+	Super::Tick(DeltaTime);
+
+	NumDrawnBars = 0;
+
+	if (!IsOverlayEnabled(this))
+	{
+		RemoveOverlay();
+		States.Reset();
+		return;
+	}
+
+	// ========== 로컬 플레이어 뷰-투영 (프레임당 한 번) ==========
+	const APlayerController* PC = GetWorld()->GetFirstPlayerController();
+	const ULocalPlayer* LocalPlayer = PC ? PC->GetLocalPlayer() : nullptr;
+	if (!LocalPlayer || !LocalPlayer->ViewportClient)
+	{
+		return;
+	}
+
+	FSceneViewProjectionData ProjectionData;
+	if (!LocalPlayer->GetProjectionData(LocalPlayer->ViewportClient->Viewport, ProjectionData))
+	{
+		return;
+	}
+
+	EnsureOverlay();
+	if (!Overlay.IsValid())
+	{
+		return;
+	}
+
+	const FMatrix ViewProjection = ProjectionData.ComputeViewProjectionMatrix();
+	const FIntRect ViewRect = ProjectionData.GetConstrainedViewRect();
+	const FVector ViewOrigin = ProjectionData.ViewOrigin;
+
+	// ========== 1. 등록부의 살아 있는 적 → 상태 갱신 ==========
+	for (TPair<TObjectKey<AActor>, FBarState>& Pair : States)
+	{
+		Pair.Value.bSeenThisFrame = false;
+	}
+
+	const UMechaSignificanceSubsystem* Significance = UMechaSignificanceSubsystem::Get(this);
+
+	if (const UMechaCombatRegistrySubsystem* Registry = UMechaCombatRegistrySubsystem::Get(this))
+	{
+		for (const FMechaCombatEntry& Entry : Registry->GetEntries())
+		{
+			if (Entry.Team != EMechaCombatTeam::Enemy) continue;
+
+			AEnemyMecha* Enemy = Cast<AEnemyMecha>(Entry.Actor.Get());
+			if (!Enemy) continue;
+
+			const float MaxHealth = Enemy->GetMaxHealth();
+			const float Percent = MaxHealth > 0.f ? FMath::Clamp(Enemy->GetHealth() / MaxHealth, 0.f, 1.f) : 0.f;
+
+			FBarState* State = States.Find(Entry.Key);
+			if (!State)
+			{
+				State = &States.Add(Entry.Key);
+				State->Enemy = Enemy;
+				State->TargetPercent = State->DisplayPercent = State->TrailPercent = Percent;
+			}
+
+			State->Location = Entry.Location;
+			State->Opacity = 1.f;
+			State->bSeenThisFrame = true;
+			State->bHiddenBySignificance = Significance && !Significance->GetSettings(Enemy->GetSignificance()).bShowHealthWidget;
+
+			// 깎이면 잔상 유지 시간 재시작
+			if (Percent < State->TargetPercent)
+			{
+				State->TrailHoldTime = TrailDelay;
+			}
+			State->TargetPercent = Percent;
+		}
+	}
+
+	// ========== 2. 보간 / 사망 페이드 / 투영 ==========
+	TArray<FMechaHealthBarElement>& Bars = Overlay->GetMutableBars();
+	Bars.Reset();
+
+	const float MaxDistSq = FMath::Square(MaxDrawDistance);
+	const float FadeRate = FadeOutTime > 0.f ? 1.f / FadeOutTime : 1000.f;
+
+	for (auto It = States.CreateIterator(); It; ++It)
+	{
+		FBarState& State = It.Value();
+
+		if (!State.bSeenThisFrame)
+		{
+			// 등록부에서 빠짐: 사망이면 0으로 줄이며 페이드, 그 외(파괴/강등)는 즉시 제거
+			const AEnemyMecha* Enemy = State.Enemy.Get();
+			if (!Enemy || !Enemy->IsDead())
+			{
+				It.RemoveCurrent();
+				continue;
+			}
+
+			State.TargetPercent = 0.f;
+			State.Opacity -= DeltaTime * FadeRate;
+			if (State.Opacity <= 0.f)
+			{
+				It.RemoveCurrent();
+				continue;
+			}
+		}
+
+		State.DisplayPercent = FMath::FInterpTo(State.DisplayPercent, State.TargetPercent, DeltaTime, InterpSpeed);
+
+		if (State.TrailHoldTime > 0.f)
+		{
+			State.TrailHoldTime -= DeltaTime;
+		}
+		else
+		{
+			State.TrailPercent = FMath::FInterpConstantTo(State.TrailPercent, State.DisplayPercent, DeltaTime, TrailSpeed);
+		}
+		State.TrailPercent = FMath::Max(State.TrailPercent, State.DisplayPercent);
+
+		// ========== 컬링 ==========
+		if (State.bHiddenBySignificance)
+		{
+			continue;
+		}
+
+		const FVector BarLocation = State.Location + FVector(0.f, 0.f, WorldOffsetZ);
+		if (FVector::DistSquared(BarLocation, ViewOrigin) > MaxDistSq)
+		{
+			continue;
+		}
+
+		FVector2D ScreenPosition;
+		if (!FSceneView::ProjectWorldToScreen(BarLocation, ViewRect, ViewProjection, ScreenPosition))
+		{
+			continue;
+		}
+
+		if (ScreenPosition.X < ViewRect.Min.X - BarSize.X || ScreenPosition.X > ViewRect.Max.X + BarSize.X
+			|| ScreenPosition.Y < ViewRect.Min.Y - BarSize.Y || ScreenPosition.Y > ViewRect.Max.Y + BarSize.Y)
+		{
+			continue;
+		}
+
+		FMechaHealthBarElement& Bar = Bars.AddDefaulted_GetRef();
+		Bar.ScreenPosition = ScreenPosition;
+		Bar.Percent = State.DisplayPercent;
+		Bar.TrailPercent = State.TrailPercent;
+		Bar.Opacity = State.Opacity;
+		Bar.Color = UEnemyHUDWidget::GetHealthColor(State.DisplayPercent);
+	}
+
+	NumDrawnBars = Bars.Num();
+	SET_DWORD_STAT(STAT_Mecha_HealthBarsDrawn, NumDrawnBars);
+}
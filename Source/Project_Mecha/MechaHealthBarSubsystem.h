@@ -0,0 +1,88 @@
+// MechaHealthBarSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+// 설명:
+// - 적 머리 위 체력바를 적마다 UWidgetComponent(UEnemyHUDWidget) 대신 뷰포트 오버레이 하나(SMechaHealthBarOverlay)로 그립니다.
+// - 매 프레임 전투 등록부의 적 위치 캐시를 로컬 플레이어 뷰-투영 행렬 하나로 투영하고,
+//   MaxDrawDistance 밖 / 화면 밖 / 중요도 설정상 체력바를 숨기는 적은 건너뜁니다.
+// - 표시 값은 클라이언트에서 보간합니다 (체력은 InterpSpeed로 따라가고, 깎인 부분은 잔상으로 남았다가 줄어듦).
+//   사망한 적은 등록부에서 빠진 뒤 FadeOutTime 동안 흐려지며 사라집니다.
+// - 색상 기준은 UEnemyHUDWidget::GetHealthColor (위젯 컴포넌트 방식과 같은 색).
+// - Mecha.UI.HealthBarOverlay 0이면 예전처럼 적마다 위젯 컴포넌트를 씁니다 (적 BeginPlay 시점에 적용).
+#include "MechaHealthBarSubsystem.generated.h"
+
+class SMechaHealthBarOverlay;
+class AEnemyMecha;
+
+UCLASS(Config = Game)
+class PROJECT_MECHA_API UMechaHealthBarSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    static UMechaHealthBarSubsystem* Get(const UObject* WorldContextObject);
+
+    // 적이 위젯 컴포넌트 대신 오버레이를 써야 하는지 (CVar, 전용 서버 제외)
+    static bool IsOverlayEnabled(const UObject* WorldContextObject);
+
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    UFUNCTION(BlueprintPure, Category = "Mecha|UI")
+    int32 GetNumDrawnBars() const { return NumDrawnBars; }
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+    // ===== 표시 설정 (DefaultGame.ini) =====
+    UPROPERTY(Config)
+    float MaxDrawDistance = 8000.f;
+
+    // 액터 원점 기준 바 높이 (예전 위젯 컴포넌트 위치와 같음)
+    UPROPERTY(Config)
+    float WorldOffsetZ = 200.f;
+
+    UPROPERTY(Config)
+    FVector2D BarSize = FVector2D(80.f, 6.f);
+
+    UPROPERTY(Config)
+    float InterpSpeed = 12.f;
+
+    // 잔상이 줄어들기 시작하기까지 대기 시간 / 줄어드는 속도 (초당 비율)
+    UPROPERTY(Config)
+    float TrailDelay = 0.4f;
+
+    UPROPERTY(Config)
+    float TrailSpeed = 0.8f;
+
+    UPROPERTY(Config)
+    float FadeOutTime = 0.4f;
+
+private:
+    // 적별 보간 상태
+    struct FBarState
+    {
+        TWeakObjectPtr<AEnemyMecha> Enemy;
+        FVector Location = FVector::ZeroVector;
+        float TargetPercent = 1.f;
+        float DisplayPercent = 1.f;
+        float TrailPercent = 1.f;
+        float TrailHoldTime = 0.f;
+        float Opacity = 1.f;
+        bool bSeenThisFrame = false;
+        bool bHiddenBySignificance = false;
+    };
+
+    TMap<TObjectKey<AActor>, FBarState> States;
+
+    TSharedPtr<SMechaHealthBarOverlay> Overlay;
+
+    int32 NumDrawnBars = 0;
+
+    void EnsureOverlay();
+    void RemoveOverlay();
+};
@@ -0,0 +1,382 @@
+// MechaHomingKernel.cpp
+// 유도 미사일 일괄 이동 커널 - 스칼라 기준 구현 / VectorRegister 4발 동시 처리 / 검증용 벤치마크
+
+#include "MechaHomingKernel.h"
+#include "Project_Mecha.h"
+
+#include "GameFramework/ProjectileMovementComponent.h"
+#include "Components/SceneComponent.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/VectorRegister.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+// ========================================
+// 1발 처리 (ProjectileMovement와 같은 식)
+// - 가속 = (타겟 - 위치).SafeNormal * HomingAccel
+// - 새 속도 = 속도 + 가속 * dt, MaxSpeed로 제한
+// - 이동량 = 0.5 * (이전 속도 + 새 속도) * dt
+// ========================================
+static FORCEINLINE void IntegrateOne(const FMechaHomingStreams& S, int32 i, float DeltaTime)
+{
+	const float Vx = S.VelX[i];
+	const float Vy = S.VelY[i];
+	const float Vz = S.VelZ[i];
+
+	float Ax = 0.f, Ay = 0.f, Az = 0.f;
+	if (S.HomingAccel[i] > 0.f)
+	{
+		const float Dx = S.TargetX[i] - S.PosX[i];
+		const float Dy = S.TargetY[i] - S.PosY[i];
+		const float Dz = S.TargetZ[i] - S.PosZ[i];
+		const float LenSq = Dx * Dx + Dy * Dy + Dz * Dz;
+		if (LenSq > UE_SMALL_NUMBER)
+		{
+			const float Scale = S.HomingAccel[i] * FMath::InvSqrt(LenSq);
+			Ax = Dx * Scale;
+			Ay = Dy * Scale;
+			Az = Dz * Scale;
+		}
+	}
+
+	float Nx = Vx + Ax * DeltaTime;
+	float Ny = Vy + Ay * DeltaTime;
+	float Nz = Vz + Az * DeltaTime;
+
+	// 최대 속도 제한
+	const float Max = S.MaxSpeed[i];
+	float SpeedSq = Nx * Nx + Ny * Ny + Nz * Nz;
+	if (Max > 0.f && SpeedSq > Max * Max)
+	{
+		const float Scale = Max * FMath::InvSqrt(SpeedSq);
+		Nx *= Scale;
+		Ny *= Scale;
+		Nz *= Scale;
+		SpeedSq = Max * Max;
+	}
+
+	const float HalfDt = 0.5f * DeltaTime;
+	S.PosX[i] += (Vx + Nx) * HalfDt;
+	S.PosY[i] += (Vy + Ny) * HalfDt;
+	S.PosZ[i] += (Vz + Nz) * HalfDt;
+
+	S.VelX[i] = Nx;
+	S.VelY[i] = Ny;
+	S.VelZ[i] = Nz;
+
+	// 회전은 속도 방향을 따름
+	const float DirScale = SpeedSq > UE_SMALL_NUMBER ? FMath::InvSqrt(SpeedSq) : 0.f;
+	S.DirX[i] = Nx * DirScale;
+	S.DirY[i] = Ny * DirScale;
+	S.DirZ[i] = Nz * DirScale;
+}
+
+// ========================================
+// 스칼라 버전
+// ========================================
+void FMechaHomingKernel::IntegrateScalar(const FMechaHomingStreams& Streams, float DeltaTime)
+{
+	for (int32 i = 0; i < Streams.Num; ++i)
+	{
+		IntegrateOne(Streams, i, DeltaTime);
+	}
+}
+
+// ========================================
+// SIMD 버전 (4발씩, 조건 분기는 마스크 Select로 처리)
+// ========================================
+void FMechaHomingKernel::IntegrateSIMD(const FMechaHomingStreams& S, float DeltaTime)
+{
+	const VectorRegister4Float VDt = VectorSetFloat1(DeltaTime);
+	const VectorRegister4Float VHalfDt = VectorSetFloat1(0.5f * DeltaTime);
+	const VectorRegister4Float VZero = VectorZeroFloat();
+	const VectorRegister4Float VOne = VectorOneFloat();
+	const VectorRegister4Float VSmall = VectorSetFloat1(UE_SMALL_NUMBER);
+
+	int32 i = 0;
+	for (; i + 4 <= S.Num; i += 4)
+	{
+		VectorRegister4Float Px = VectorLoad(S.PosX + i);
+		VectorRegister4Float Py = VectorLoad(S.PosY + i);
+		VectorRegister4Float Pz = VectorLoad(S.PosZ + i);
+		const VectorRegister4Float Vx = VectorLoad(S.VelX + i);
+		const VectorRegister4Float Vy = VectorLoad(S.VelY + i);
+		const VectorRegister4Float Vz = VectorLoad(S.VelZ + i);
+		const VectorRegister4Float Accel = VectorLoad(S.HomingAccel + i);
+		const VectorRegister4Float Max = VectorLoad(S.MaxSpeed + i);
+
+		// ========== 유도 가속 ==========
+		const VectorRegister4Float Dx = VectorSubtract(VectorLoad(S.TargetX + i), Px);
+		const VectorRegister4Float Dy = VectorSubtract(VectorLoad(S.TargetY + i), Py);
+		const VectorRegister4Float Dz = VectorSubtract(VectorLoad(S.TargetZ + i), Pz);
+		const VectorRegister4Float LenSq = VectorMultiplyAdd(Dx, Dx, VectorMultiplyAdd(Dy, Dy, VectorMultiply(Dz, Dz)));
+
+		const VectorRegister4Float HomingMask = VectorBitwiseAnd(VectorCompareGT(LenSq, VSmall), VectorCompareGT(Accel, VZero));
+		const VectorRegister4Float AccelScale = VectorSelect(HomingMask, VectorMultiply(Accel, VectorReciprocalSqrt(LenSq)), VZero);
+		const VectorRegister4Float AccelDt = VectorMultiply(AccelScale, VDt);
+
+		VectorRegister4Float Nx = VectorMultiplyAdd(Dx, AccelDt, Vx);
+		VectorRegister4Float Ny = VectorMultiplyAdd(Dy, AccelDt, Vy);
+		VectorRegister4Float Nz = VectorMultiplyAdd(Dz, AccelDt, Vz);
+
+		// ========== 최대 속도 제한 ==========
+		VectorRegister4Float SpeedSq = VectorMultiplyAdd(Nx, Nx, VectorMultiplyAdd(Ny, Ny, VectorMultiply(Nz, Nz)));
+		const VectorRegister4Float MaxSq = VectorMultiply(Max, Max);
+		const VectorRegister4Float ClampMask = VectorBitwiseAnd(VectorCompareGT(Max, VZero), VectorCompareGT(SpeedSq, MaxSq));
+		const VectorRegister4Float ClampScale = VectorSelect(ClampMask, VectorMultiply(Max, VectorReciprocalSqrt(SpeedSq)), VOne);
+
+		Nx = VectorMultiply(Nx, ClampScale);
+		Ny = VectorMultiply(Ny, ClampScale);
+		Nz = VectorMultiply(Nz, ClampScale);
+		SpeedSq = VectorSelect(ClampMask, MaxSq, SpeedSq);
+
+		// ========== 위치 적분 ==========
+		Px = VectorMultiplyAdd(VectorAdd(Vx, Nx), VHalfDt, Px);
+		Py = VectorMultiplyAdd(VectorAdd(Vy, Ny), VHalfDt, Py);
+		Pz = VectorMultiplyAdd(VectorAdd(Vz, Nz), VHalfDt, Pz);
+
+		VectorStore(Px, S.PosX + i);
+		VectorStore(Py, S.PosY + i);
+		VectorStore(Pz, S.PosZ + i);
+		VectorStore(Nx, S.VelX + i);
+		VectorStore(Ny, S.VelY + i);
+		VectorStore(Nz, S.VelZ + i);
+
+		// ========== 진행 방향 ==========
+		const VectorRegister4Float DirScale = VectorSelect(VectorCompareGT(SpeedSq, VSmall), VectorReciprocalSqrt(SpeedSq), VZero);
+		VectorStore(VectorMultiply(Nx, DirScale), S.DirX + i);
+		VectorStore(VectorMultiply(Ny, DirScale), S.DirY + i);
+		VectorStore(VectorMultiply(Nz, DirScale), S.DirZ + i);
+	}
+
+	// 4개 단위로 나누고 남은 것
+	for (; i < S.Num; ++i)
+	{
+		IntegrateOne(S, i, DeltaTime);
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+
+// ========================================
+// 검증 / 벤치마크
+// ========================================
+namespace MechaHomingBench
+{
+	// 벤치마크용 스트림 저장소
+	struct FBuffers
+	{
+		TArray<float> PosX, PosY, PosZ, VelX, VelY, VelZ;
+		TArray<float> TargetX, TargetY, TargetZ, HomingAccel, MaxSpeed;
+		TArray<float> DirX, DirY, DirZ;
+
+		void Init(int32 Num, int32 Seed)
+		{
+			FRandomStream Rand(Seed);
+			for (TArray<float>* Arr : { &PosX, &PosY, &PosZ, &VelX, &VelY, &VelZ, &TargetX, &TargetY, &TargetZ, &HomingAccel, &MaxSpeed, &DirX, &DirY, &DirZ })
+			{
+				Arr->SetNumZeroed(Num);
+			}
+
+			for (int32 i = 0; i < Num; ++i)
+			{
+				PosX[i] = Rand.FRandRange(-20000.f, 20000.f);
+				PosY[i] = Rand.FRandRange(-20000.f, 20000.f);
+				PosZ[i] = Rand.FRandRange(0.f, 3000.f);
+
+				const FVector Dir = Rand.GetUnitVector();
+				VelX[i] = Dir.X * 3000.f;
+				VelY[i] = Dir.Y * 3000.f;
+				VelZ[i] = Dir.Z * 3000.f;
+
+				TargetX[i] = Rand.FRandRange(-20000.f, 20000.f);
+				TargetY[i] = Rand.FRandRange(-20000.f, 20000.f);
+				TargetZ[i] = Rand.FRandRange(0.f, 3000.f);
+
+				// 일부는 유도 없음 / 속도 제한 없음으로 분기 경로도 검증
+				HomingAccel[i] = (i % 7 == 0) ? 0.f : 8000.f;
+				MaxSpeed[i] = (i % 11 == 0) ? 0.f : 6000.f;
+			}
+		}
+
+		FMechaHomingStreams MakeStreams()
+		{
+			FMechaHomingStreams S;
+			S.PosX = PosX.GetData(); S.PosY = PosY.GetData(); S.PosZ = PosZ.GetData();
+			S.VelX = VelX.GetData(); S.VelY = VelY.GetData(); S.VelZ = VelZ.GetData();
+			S.TargetX = TargetX.GetData(); S.TargetY = TargetY.GetData(); S.TargetZ = TargetZ.GetData();
+			S.HomingAccel = HomingAccel.GetData();
+			S.MaxSpeed = MaxSpeed.GetData();
+			S.DirX = DirX.GetData(); S.DirY = DirY.GetData(); S.DirZ = DirZ.GetData();
+			S.Num = PosX.Num();
+			return S;
+		}
+	};
+
+	// 최대 오차 (성분별 절댓값)
+	struct FErrors
+	{
+		float MaxPosError = 0.f;
+		float MaxVelError = 0.f;
+	};
+
+	// 스칼라 커널 1스텝이 실제 UProjectileMovementComponent::ComputeVelocity/ComputeMoveDelta와 같은지 확인
+	static FErrors CompareWithProjectileMovement(int32 NumSamples, float DeltaTime)
+	{
+		UProjectileMovementComponent* Move = NewObject<UProjectileMovementComponent>(GetTransientPackage());
+		USceneComponent* Updated = NewObject<USceneComponent>(GetTransientPackage());
+		USceneComponent* Target = NewObject<USceneComponent>(GetTransientPackage());
+
+		Move->SetUpdatedComponent(Updated);
+		Move->bIsHomingProjectile = true;
+		Move->HomingTargetComponent = Target;
+		Move->ProjectileGravityScale = 0.f;
+
+		FBuffers Buffers;
+		Buffers.Init(NumSamples, 7);
+		FMechaHomingStreams S = Buffers.MakeStreams();
+
+		FErrors Errors;
+		for (int32 i = 0; i < NumSamples; ++i)
+		{
+			const FVector Pos(S.PosX[i], S.PosY[i], S.PosZ[i]);
+			const FVector Vel(S.VelX[i], S.VelY[i], S.VelZ[i]);
+			Updated->SetWorldLocation(Pos);
+			Target->SetWorldLocation(FVector(S.TargetX[i], S.TargetY[i], S.TargetZ[i]));
+			Move->HomingAccelerationMagnitude = S.HomingAccel[i];
+			Move->MaxSpeed = S.MaxSpeed[i];
+
+			const FVector ExpectedVel = Move->ComputeVelocity(Vel, DeltaTime);
+			const FVector ExpectedPos = Pos + Move->ComputeMoveDelta(Vel, DeltaTime);
+
+			IntegrateOne(S, i, DeltaTime);
+			const FVector ActualVel(S.VelX[i], S.VelY[i], S.VelZ[i]);
+			const FVector ActualPos(S.PosX[i], S.PosY[i], S.PosZ[i]);
+
+			Errors.MaxVelError = FMath::Max(Errors.MaxVelError, (float)(ExpectedVel - ActualVel).GetAbsMax());
+			Errors.MaxPosError = FMath::Max(Errors.MaxPosError, (float)(ExpectedPos - ActualPos).GetAbsMax());
+		}
+
+		Move->MarkAsGarbage();
+		Updated->MarkAsGarbage();
+		Target->MarkAsGarbage();
+		return Errors;
+	}
+
+	// 같은 입력으로 Steps번 적분한 SIMD 결과가 스칼라 결과와 같은지 확인
+	static FErrors CompareSIMDWithScalar(int32 Num, int32 Steps, float DeltaTime)
+	{
+		FBuffers ScalarBuf, SimdBuf;
+		ScalarBuf.Init(Num, 1234);
+		SimdBuf.Init(Num, 1234);
+		const FMechaHomingStreams ScalarStreams = ScalarBuf.MakeStreams();
+		const FMechaHomingStreams SimdStreams = SimdBuf.MakeStreams();
+
+		for (int32 Step = 0; Step < Steps; ++Step)
+		{
+			FMechaHomingKernel::IntegrateScalar(ScalarStreams, DeltaTime);
+			FMechaHomingKernel::IntegrateSIMD(SimdStreams, DeltaTime);
+		}
+
+		FErrors Errors;
+		for (int32 i = 0; i < Num; ++i)
+		{
+			Errors.MaxPosError = FMath::Max(Errors.MaxPosError, FMath::Abs(ScalarBuf.PosX[i] - SimdBuf.PosX[i]));
+			Errors.MaxPosError = FMath::Max(Errors.MaxPosError, FMath::Abs(ScalarBuf.PosY[i] - SimdBuf.PosY[i]));
+			Errors.MaxPosError = FMath::Max(Errors.MaxPosError, FMath::Abs(ScalarBuf.PosZ[i] - SimdBuf.PosZ[i]));
+			Errors.MaxVelError = FMath::Max(Errors.MaxVelError, FMath::Abs(ScalarBuf.VelX[i] - SimdBuf.VelX[i]));
+			Errors.MaxVelError = FMath::Max(Errors.MaxVelError, FMath::Abs(ScalarBuf.VelY[i] - SimdBuf.VelY[i]));
+			Errors.MaxVelError = FMath::Max(Errors.MaxVelError, FMath::Abs(ScalarBuf.VelZ[i] - SimdBuf.VelZ[i]));
+		}
+		return Errors;
+	}
+
+	// 실행 시간만 측정 (정확도는 자동화 테스트 Project_Mecha.ProjectileSim.HomingKernel)
+	static void Run(int32 Num)
+	{
+		const float DeltaTime = 1.f / 60.f;
+		const int32 Steps = 120;
+
+		FBuffers ScalarBuf, SimdBuf;
+		ScalarBuf.Init(Num, 1234);
+		SimdBuf.Init(Num, 1234);
+		const FMechaHomingStreams ScalarStreams = ScalarBuf.MakeStreams();
+		const FMechaHomingStreams SimdStreams = SimdBuf.MakeStreams();
+
+		double Start = FPlatformTime::Seconds();
+		for (int32 Step = 0; Step < Steps; ++Step)
+		{
+			FMechaHomingKernel::IntegrateScalar(ScalarStreams, DeltaTime);
+		}
+		const double ScalarMs = (FPlatformTime::Seconds() - Start) * 1000.0 / Steps;
+
+		Start = FPlatformTime::Seconds();
+		for (int32 Step = 0; Step < Steps; ++Step)
+		{
+			FMechaHomingKernel::IntegrateSIMD(SimdStreams, DeltaTime);
+		}
+		const double SimdMs = (FPlatformTime::Seconds() - Start) * 1000.0 / Steps;
+
+		UE_LOG(LogMecha, Log, TEXT("[HomingKernel] N=%d Scalar=%.4fms SIMD=%.4fms (x%.2f)"),
+			Num, ScalarMs, SimdMs, SimdMs > 0.0 ? ScalarMs / SimdMs : 0.0);
+	}
+}
+
+// 콘솔: Mecha.ProjectileSim.BenchHoming [개수] (생략 시 1000, 10000)
+static FAutoConsoleCommand GMechaBenchHomingCmd(
+	TEXT("Mecha.ProjectileSim.BenchHoming"),
+	TEXT("유도 커널 스칼라/SIMD 실행 시간 측정. 인자: 미사일 수 (기본 1000, 10000)"),
+	FConsoleCommandWithArgsDelegate::CreateStatic([](const TArray<FString>& Args)
+		{
+			if (Args.Num() > 0)
+			{
+				MechaHomingBench::Run(FMath::Max(1, FCString::Atoi(*Args[0])));
+			}
+			else
+			{
+				MechaHomingBench::Run(1000);
+				MechaHomingBench::Run(10000);
+			}
+		}));
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ========================================
+// 자동화 테스트: 커널 정확도 (허용 오차 초과 시 실패)
+// ========================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMechaHomingKernelTest, "Project_Mecha.ProjectileSim.HomingKernel",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FMechaHomingKernelTest::RunTest(const FString& Parameters)
+{
+	const float DeltaTime = 1.f / 60.f;
+
+	// 1스텝 비교: double(ProjectileMovement) vs float(커널) 반올림 차이만 허용
+	const float PmcPosTolerance = 0.05f;
+	const float PmcVelTolerance = 0.01f;
+
+	// 120스텝 누적 비교: 4발 묶음 연산 순서 차이만 허용
+	const int32 SimdSteps = 120;
+	const float SimdPosTolerance = 0.5f;
+	const float SimdVelTolerance = 0.05f;
+
+	const MechaHomingBench::FErrors Pmc = MechaHomingBench::CompareWithProjectileMovement(256, DeltaTime);
+	TestTrue(FString::Printf(TEXT("Scalar vs ProjectileMovement MaxPosErr=%.4f (<= %.2f)"), Pmc.MaxPosError, PmcPosTolerance),
+		Pmc.MaxPosError <= PmcPosTolerance);
+	TestTrue(FString::Printf(TEXT("Scalar vs ProjectileMovement MaxVelErr=%.4f (<= %.2f)"), Pmc.MaxVelError, PmcVelTolerance),
+		Pmc.MaxVelError <= PmcVelTolerance);
+
+	// 4의 배수가 아닌 개수로 나머지(스칼라) 경로도 포함
+	const MechaHomingBench::FErrors Simd = MechaHomingBench::CompareSIMDWithScalar(1027, SimdSteps, DeltaTime);
+	TestTrue(FString::Printf(TEXT("SIMD vs Scalar MaxPosErr=%.4f (<= %.2f)"), Simd.MaxPosError, SimdPosTolerance),
+		Simd.MaxPosError <= SimdPosTolerance);
+	TestTrue(FString::Printf(TEXT("SIMD vs Scalar MaxVelErr=%.4f (<= %.2f)"), Simd.MaxVelError, SimdVelTolerance),
+		Simd.MaxVelError <= SimdVelTolerance);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
+
+#endif // !UE_BUILD_SHIPPING
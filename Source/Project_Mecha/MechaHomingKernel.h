@@ -0,0 +1,48 @@
+// MechaHomingKernel.h
+#pragma once
+
+#include "CoreMinimal.h"
+// 설명:
+// - 유도 미사일 일괄 이동 커널 (ProjectileSim 서브시스템에서 사용).
+// - 입력/출력은 성분별 float 배열(SoA). 스칼라 버전은 UProjectileMovementComponent의
+//   ComputeVelocity/ComputeMoveDelta와 같은 식이며, SIMD 버전은 VectorRegister로 4발씩 처리합니다.
+// - 정확도 검증: 자동화 테스트 Project_Mecha.ProjectileSim.HomingKernel
+//   (스칼라 vs UProjectileMovementComponent, SIMD vs 스칼라. 허용 오차 초과 시 실패)
+// - 실행 시간: 콘솔 Mecha.ProjectileSim.BenchHoming [개수] (비 Shipping 빌드)
+
+// 커널 입출력 스트림. 모든 포인터는 Num개 이상의 원소를 가리켜야 함
+struct FMechaHomingStreams
+{
+    // 위치/속도 (입력 + 출력)
+    float* PosX = nullptr;
+    float* PosY = nullptr;
+    float* PosZ = nullptr;
+    float* VelX = nullptr;
+    float* VelY = nullptr;
+    float* VelZ = nullptr;
+
+    // 유도 타겟 위치 (입력)
+    const float* TargetX = nullptr;
+    const float* TargetY = nullptr;
+    const float* TargetZ = nullptr;
+
+    // 유도 가속도 (0이면 유도 없음), 최대 속도 (0 이하면 제한 없음)
+    const float* HomingAccel = nullptr;
+    const float* MaxSpeed = nullptr;
+
+    // 진행 방향 단위 벡터 (출력, 속도가 0이면 0). 프록시 회전에 사용
+    float* DirX = nullptr;
+    float* DirY = nullptr;
+    float* DirZ = nullptr;
+
+    int32 Num = 0;
+};
+
+struct PROJECT_MECHA_API FMechaHomingKernel
+{
+    // 1발씩 처리 (기준 구현)
+    static void IntegrateScalar(const FMechaHomingStreams& Streams, float DeltaTime);
+
+    // 4발씩 VectorRegister로 처리, 나머지는 스칼라
+    static void IntegrateSIMD(const FMechaHomingStreams& Streams, float DeltaTime);
+};
@@ -0,0 +1,277 @@
+// MechaLockOnScorer.cpp
+// 락온 후보 점수 계산 - cos 임계값 시야각 컬링, 가중치 점수, 소프트 락 좌우 전환
+
+#include "MechaLockOnScorer.h"
+
+#include "Math/VectorRegister.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+namespace MechaLockOn
+{
+	// 쿼리에서 후보와 무관한 값들을 한 번만 계산
+	struct FPrepared
+	{
+		float MaxDistSq;
+		float InvMaxDist;
+		float CosMaxAngle;
+	};
+
+	static FPrepared Prepare(const FMechaLockOnQuery& Query)
+	{
+		FPrepared P;
+		P.MaxDistSq = FMath::Square(Query.MaxDistance);
+		P.InvMaxDist = Query.MaxDistance > 0.f ? 1.f / Query.MaxDistance : 0.f;
+		P.CosMaxAngle = FMath::Cos(FMath::DegreesToRadians(Query.MaxAngleDeg));
+		return P;
+	}
+
+	// 후보 1개 점수 / 좌우 위치
+	static void ScoreOne(const FMechaLockOnQuery& Q, const FPrepared& P, const FMechaLockOnCandidates& C, int32 i, float& OutScore, float& OutSide)
+	{
+		const FVector Location(C.X[i], C.Y[i], C.Z[i]);
+
+		// ========== 거리 / 시야각 컬링 ==========
+		const FVector ToTarget = Location - Q.Origin;
+		const float DistSq = ToTarget.SizeSquared();
+		const float InvDist = FMath::InvSqrt(FMath::Max(DistSq, UE_SMALL_NUMBER));
+		const float ConeCos = FVector::DotProduct(Q.Forward, ToTarget) * InvDist;
+
+		// ========== 카메라 기준 (화면 중앙 / 좌우) ==========
+		const FVector ToTargetView = Location - Q.ViewLocation;
+		const float InvViewDist = FMath::InvSqrt(FMath::Max(ToTargetView.SizeSquared(), UE_SMALL_NUMBER));
+		const float ViewCos = FVector::DotProduct(Q.ViewForward, ToTargetView) * InvViewDist;
+		OutSide = FVector::DotProduct(Q.ViewRight, ToTargetView) * InvViewDist;
+
+		if (DistSq > P.MaxDistSq || ConeCos < P.CosMaxAngle)
+		{
+			OutScore = FMechaLockOnScorer::CulledScore;
+			return;
+		}
+
+		const float DistNorm = DistSq * InvDist * P.InvMaxDist;
+		OutScore = Q.Weights.DistanceWeight * (1.f - DistNorm)
+			+ Q.Weights.ScreenCenterWeight * ViewCos
+			+ Q.Weights.ThreatWeight * C.Threat[i];
+	}
+}
+
+// ========================================
+// 스칼라 버전
+// ========================================
+void FMechaLockOnScorer::ScoreScalar(const FMechaLockOnQuery& Query, const FMechaLockOnCandidates& Candidates, TArray<float>& OutScores, TArray<float>& OutSides)
+{
+	const int32 Num = Candidates.Num();
+	OutScores.SetNumUninitialized(Num);
+	OutSides.SetNumUninitialized(Num);
+
+	const MechaLockOn::FPrepared P = MechaLockOn::Prepare(Query);
+	for (int32 i = 0; i < Num; ++i)
+	{
+		MechaLockOn::ScoreOne(Query, P, Candidates, i, OutScores[i], OutSides[i]);
+	}
+}
+
+// ========================================
+// SIMD 버전 (4개씩)
+// ========================================
+void FMechaLockOnScorer::ScoreSIMD(const FMechaLockOnQuery& Query, const FMechaLockOnCandidates& Candidates, TArray<float>& OutScores, TArray<float>& OutSides)
+{
+	const int32 Num = Candidates.Num();
+	OutScores.SetNumUninitialized(Num);
+	OutSides.SetNumUninitialized(Num);
+
+	const MechaLockOn::FPrepared P = MechaLockOn::Prepare(Query);
+
+	const VectorRegister4Float OX = VectorSetFloat1((float)Query.Origin.X);
+	const VectorRegister4Float OY = VectorSetFloat1((float)Query.Origin.Y);
+	const VectorRegister4Float OZ = VectorSetFloat1((float)Query.Origin.Z);
+	const VectorRegister4Float FX = VectorSetFloat1((float)Query.Forward.X);
+	const VectorRegister4Float FY = VectorSetFloat1((float)Query.Forward.Y);
+	const VectorRegister4Float FZ = VectorSetFloat1((float)Query.Forward.Z);
+
+	const VectorRegister4Float VLX = VectorSetFloat1((float)Query.ViewLocation.X);
+	const VectorRegister4Float VLY = VectorSetFloat1((float)Query.ViewLocation.Y);
+	const VectorRegister4Float VLZ = VectorSetFloat1((float)Query.ViewLocation.Z);
+	const VectorRegister4Float VFX = VectorSetFloat1((float)Query.ViewForward.X);
+	const VectorRegister4Float VFY = VectorSetFloat1((float)Query.ViewForward.Y);
+	const VectorRegister4Float VFZ = VectorSetFloat1((float)Query.ViewForward.Z);
+	const VectorRegister4Float VRX = VectorSetFloat1((float)Query.ViewRight.X);
+	const VectorRegister4Float VRY = VectorSetFloat1((float)Query.ViewRight.Y);
+	const VectorRegister4Float VRZ = VectorSetFloat1((float)Query.ViewRight.Z);
+
+	const VectorRegister4Float VMaxDistSq = VectorSetFloat1(P.MaxDistSq);
+	const VectorRegister4Float VInvMaxDist = VectorSetFloat1(P.InvMaxDist);
+	const VectorRegister4Float VCosMax = VectorSetFloat1(P.CosMaxAngle);
+	const VectorRegister4Float VSmall = VectorSetFloat1(UE_SMALL_NUMBER);
+	const VectorRegister4Float VOne = VectorOneFloat();
+	const VectorRegister4Float VCulled = VectorSetFloat1(CulledScore);
+
+	const VectorRegister4Float WDist = VectorSetFloat1(Query.Weights.DistanceWeight);
+	const VectorRegister4Float WScreen = VectorSetFloat1(Query.Weights.ScreenCenterWeight);
+	const VectorRegister4Float WThreat = VectorSetFloat1(Query.Weights.ThreatWeight);
+
+	const float* XS = Candidates.X.GetData();
+	const float* YS = Candidates.Y.GetData();
+	const float* ZS = Candidates.Z.GetData();
+	const float* TS = Candidates.Threat.GetData();
+	float* ScoreOut = OutScores.GetData();
+	float* SideOut = OutSides.GetData();
+
+	int32 i = 0;
+	for (; i + 4 <= Num; i += 4)
+	{
+		const VectorRegister4Float X = VectorLoad(XS + i);
+		const VectorRegister4Float Y = VectorLoad(YS + i);
+		const VectorRegister4Float Z = VectorLoad(ZS + i);
+
+		// ========== 거리 / 시야각 컬링 ==========
+		const VectorRegister4Float Dx = VectorSubtract(X, OX);
+		const VectorRegister4Float Dy = VectorSubtract(Y, OY);
+		const VectorRegister4Float Dz = VectorSubtract(Z, OZ);
+		const VectorRegister4Float DistSq = VectorMultiplyAdd(Dx, Dx, VectorMultiplyAdd(Dy, Dy, VectorMultiply(Dz, Dz)));
+		const VectorRegister4Float InvDist = VectorReciprocalSqrt(VectorMax(DistSq, VSmall));
+		const VectorRegister4Float ConeCos = VectorMultiply(VectorMultiplyAdd(FX, Dx, VectorMultiplyAdd(FY, Dy, VectorMultiply(FZ, Dz))), InvDist);
+
+		const VectorRegister4Float ValidMask = VectorBitwiseAnd(VectorCompareLE(DistSq, VMaxDistSq), VectorCompareGE(ConeCos, VCosMax));
+
+		// ========== 카메라 기준 (화면 중앙 / 좌우) ==========
+		const VectorRegister4Float Vx = VectorSubtract(X, VLX);
+		const VectorRegister4Float Vy = VectorSubtract(Y, VLY);
+		const VectorRegister4Float Vz = VectorSubtract(Z, VLZ);
+		const VectorRegister4Float ViewDistSq = VectorMultiplyAdd(Vx, Vx, VectorMultiplyAdd(Vy, Vy, VectorMultiply(Vz, Vz)));
+		const VectorRegister4Float InvViewDist = VectorReciprocalSqrt(VectorMax(ViewDistSq, VSmall));
+		const VectorRegister4Float ViewCos = VectorMultiply(VectorMultiplyAdd(VFX, Vx, VectorMultiplyAdd(VFY, Vy, VectorMultiply(VFZ, Vz))), InvViewDist);
+		const VectorRegister4Float Side = VectorMultiply(VectorMultiplyAdd(VRX, Vx, VectorMultiplyAdd(VRY, Vy, VectorMultiply(VRZ, Vz))), InvViewDist);
+
+		// ========== 점수 ==========
+		const VectorRegister4Float DistNorm = VectorMultiply(VectorMultiply(DistSq, InvDist), VInvMaxDist);
+		VectorRegister4Float Score = VectorMultiply(WDist, VectorSubtract(VOne, DistNorm));
+		Score = VectorMultiplyAdd(WScreen, ViewCos, Score);
+		Score = VectorMultiplyAdd(WThreat, VectorLoad(TS + i), Score);
+
+		VectorStore(VectorSelect(ValidMask, Score, VCulled), ScoreOut + i);
+		VectorStore(Side, SideOut + i);
+	}
+
+	// 4개 단위로 나누고 남은 것
+	for (; i < Num; ++i)
+	{
+		MechaLockOn::ScoreOne(Query, P, Candidates, i, ScoreOut[i], SideOut[i]);
+	}
+}
+
+// ========================================
+// 선택
+// ========================================
+float FMechaLockOnScorer::ComputeSide(const FMechaLockOnQuery& Query, const FVector& Location)
+{
+	const FVector ToTargetView = Location - Query.ViewLocation;
+	return FVector::DotProduct(Query.ViewRight, ToTargetView) * FMath::InvSqrt(FMath::Max(ToTargetView.SizeSquared(), UE_SMALL_NUMBER));
+}
+
+int32 FMechaLockOnScorer::PickBest(const TArray<float>& Scores)
+{
+	int32 Best = INDEX_NONE;
+	float BestScore = CulledScore;
+
+	for (int32 i = 0; i < Scores.Num(); ++i)
+	{
+		if (Scores[i] > BestScore)
+		{
+			BestScore = Scores[i];
+			Best = i;
+		}
+	}
+	return Best;
+}
+
+int32 FMechaLockOnScorer::PickNeighbour(const TArray<float>& Scores, const TArray<float>& Sides, float CurrentSide, int32 Direction, int32 ExcludeIndex)
+{
+	// 같은 위치로 보이는 후보는 건너뜀
+	constexpr float MinSideDelta = 0.01f;
+
+	int32 Best = INDEX_NONE;
+	float BestDelta = TNumericLimits<float>::Max();
+
+	for (int32 i = 0; i < Scores.Num(); ++i)
+	{
+		if (i == ExcludeIndex || Scores[i] <= CulledScore) continue;
+
+		// 요청 방향 쪽에 있는 후보 중 현재 타겟과 가장 가까운 것
+		const float Delta = (Sides[i] - CurrentSide) * (float)Direction;
+		if (Delta < MinSideDelta) continue;
+
+		if (Delta < BestDelta)
+		{
+			BestDelta = Delta;
+			Best = i;
+		}
+	}
+	return Best;
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ========================================
+// 자동화 테스트: SIMD 점수 = 스칼라 점수
+// ========================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMechaLockOnScorerTest, "Project_Mecha.LockOn.Scorer",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FMechaLockOnScorerTest::RunTest(const FString& Parameters)
+{
+	// 연산 순서(FMA) 차이만 허용
+	const float ScoreTolerance = 1.e-4f;
+	const float SideTolerance = 1.e-5f;
+
+	FMechaLockOnQuery Query;
+	Query.Origin = FVector(1000.f, -2000.f, 300.f);
+	Query.Forward = FVector(1.f, 1.f, 0.f).GetSafeNormal();
+	Query.ViewLocation = Query.Origin - Query.Forward * 400.f + FVector(0.f, 0.f, 150.f);
+	Query.ViewForward = Query.Forward;
+	Query.ViewRight = FVector::CrossProduct(FVector::UpVector, Query.ViewForward).GetSafeNormal();
+	Query.Weights.ThreatWeight = 0.5f;
+
+	// 거리/시야각 밖 후보도 섞고, 4의 배수가 아닌 개수로 나머지(스칼라) 경로도 포함
+	FRandomStream Rand(42);
+	FMechaLockOnCandidates Candidates;
+	for (int32 i = 0; i < 1027; ++i)
+	{
+		const FVector Offset = Rand.GetUnitVector() * Rand.FRandRange(0.f, Query.MaxDistance * 1.5f);
+		Candidates.Add(nullptr, Query.Origin + Offset, (i % 13 == 0) ? 1.f : Rand.FRand() * 0.5f);
+	}
+
+	TArray<float> ScalarScores, ScalarSides, SimdScores, SimdSides;
+	FMechaLockOnScorer::ScoreScalar(Query, Candidates, ScalarScores, ScalarSides);
+	FMechaLockOnScorer::ScoreSIMD(Query, Candidates, SimdScores, SimdSides);
+
+	int32 NumCullMismatch = 0;
+	float MaxScoreError = 0.f;
+	float MaxSideError = 0.f;
+	for (int32 i = 0; i < Candidates.Num(); ++i)
+	{
+		const bool bScalarCulled = ScalarScores[i] <= FMechaLockOnScorer::CulledScore;
+		const bool bSimdCulled = SimdScores[i] <= FMechaLockOnScorer::CulledScore;
+		if (bScalarCulled != bSimdCulled)
+		{
+			++NumCullMismatch;
+			continue;
+		}
+
+		if (!bScalarCulled)
+		{
+			MaxScoreError = FMath::Max(MaxScoreError, FMath::Abs(ScalarScores[i] - SimdScores[i]));
+		}
+		MaxSideError = FMath::Max(MaxSideError, FMath::Abs(ScalarSides[i] - SimdSides[i]));
+	}
+
+	TestEqual(TEXT("Culled candidates match"), NumCullMismatch, 0);
+	TestTrue(FString::Printf(TEXT("SIMD vs Scalar MaxScoreErr=%.6f (<= %.6f)"), MaxScoreError, ScoreTolerance), MaxScoreError <= ScoreTolerance);
+	TestTrue(FString::Printf(TEXT("SIMD vs Scalar MaxSideErr=%.6f (<= %.6f)"), MaxSideError, SideTolerance), MaxSideError <= SideTolerance);
+	TestEqual(TEXT("Best candidate matches"), FMechaLockOnScorer::PickBest(SimdScores), FMechaLockOnScorer::PickBest(ScalarScores));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,95 @@
+// MechaLockOnScorer.h
+#pragma once
+
+#include "CoreMinimal.h"
+// 설명:
+// - 락온 후보 일괄 점수 계산 (MechaCharacterBase 락온/소프트 락 전환에서 사용).
+// - 후보 위치는 성분별 float 배열(SoA)로 받고, 시야각 판정은 후보마다 Acos를 부르는 대신
+//   미리 계산한 cos(최대 각도)와 내적을 비교합니다. SIMD 버전은 VectorRegister로 4개씩 처리.
+// - 점수 = 거리 가중치 * (1 - 거리/최대거리) + 화면 중앙 가중치 * cos(카메라 시선과의 각도)
+//        + 위협 가중치 * 위협도(보스 = 1)
+// - 소프트 락 전환용으로 카메라 기준 좌우 위치(Side, -1 ~ 1)도 함께 계산합니다.
+// - 스칼라 버전은 기준 구현. 자동화 테스트 Project_Mecha.LockOn.Scorer가 SIMD 결과와 비교합니다.
+#include "MechaLockOnScorer.generated.h"
+
+// 락온 점수 가중치 (캐릭터 BP에서 조정)
+USTRUCT(BlueprintType)
+struct FMechaLockOnWeights
+{
+    GENERATED_BODY()
+
+    // 가까울수록 높은 점수
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LockOn")
+    float DistanceWeight = 1.0f;
+
+    // 화면 중앙(카메라 시선)에 가까울수록 높은 점수
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LockOn")
+    float ScreenCenterWeight = 0.5f;
+
+    // 위협도(보스 우선)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LockOn")
+    float ThreatWeight = 0.25f;
+};
+
+// 한 번의 점수 계산에 쓰는 조건
+struct FMechaLockOnQuery
+{
+    // 탐색 기준 위치/방향 (캐릭터 위치, 시점 Yaw 방향. 방향은 단위 벡터)
+    FVector Origin = FVector::ZeroVector;
+    FVector Forward = FVector::ForwardVector;
+
+    // 카메라 위치/방향 (화면 중앙 점수, 좌우 판정)
+    FVector ViewLocation = FVector::ZeroVector;
+    FVector ViewForward = FVector::ForwardVector;
+    FVector ViewRight = FVector::RightVector;
+
+    float MaxDistance = 5000.f;
+    float MaxAngleDeg = 60.f;
+
+    FMechaLockOnWeights Weights;
+};
+
+// 후보 목록 (SoA)
+struct FMechaLockOnCandidates
+{
+    TArray<float> X, Y, Z;
+    TArray<float> Threat;
+    TArray<TWeakObjectPtr<AActor>> Actors;
+
+    void Reset()
+    {
+        X.Reset(); Y.Reset(); Z.Reset();
+        Threat.Reset();
+        Actors.Reset();
+    }
+
+    void Add(AActor* Actor, const FVector& Location, float InThreat)
+    {
+        X.Add(Location.X); Y.Add(Location.Y); Z.Add(Location.Z);
+        Threat.Add(InThreat);
+        Actors.Add(Actor);
+    }
+
+    int32 Num() const { return X.Num(); }
+};
+
+struct PROJECT_MECHA_API FMechaLockOnScorer
+{
+    // 거리/시야각 밖으로 컬링된 후보의 점수
+    static constexpr float CulledScore = -1.e30f;
+
+    // 1개씩 처리 (기준 구현)
+    static void ScoreScalar(const FMechaLockOnQuery& Query, const FMechaLockOnCandidates& Candidates, TArray<float>& OutScores, TArray<float>& OutSides);
+
+    // 4개씩 VectorRegister로 처리, 나머지는 스칼라
+    static void ScoreSIMD(const FMechaLockOnQuery& Query, const FMechaLockOnCandidates& Candidates, TArray<float>& OutScores, TArray<float>& OutSides);
+
+    // 카메라 기준 좌우 위치 (-1 왼쪽 ~ 1 오른쪽)
+    static float ComputeSide(const FMechaLockOnQuery& Query, const FVector& Location);
+
+    // 최고 점수 후보 (없으면 INDEX_NONE)
+    static int32 PickBest(const TArray<float>& Scores);
+
+    // CurrentSide 기준 Direction(+1 오른쪽 / -1 왼쪽) 방향으로 가장 가까운 후보 (없으면 INDEX_NONE)
+    static int32 PickNeighbour(const TArray<float>& Scores, const TArray<float>& Sides, float CurrentSide, int32 Direction, int32 ExcludeIndex);
+};
@@ -0,0 +1,583 @@
+// MechaMovementComponent.cpp
+// 메카 이동 컴포넌트 - 호버/부스트/대시 커스텀 이동 모드 (서브스텝 적분, 저장 이동 예측)
+
+#include "MechaMovementComponent.h"
+#include "MechaStats.h"
+
+#include "GameFramework/Character.h"
+
+DECLARE_CYCLE_STAT(TEXT("Hover Phys"), STAT_Mecha_PhysHover, STATGROUP_Mecha);
+DECLARE_CYCLE_STAT(TEXT("Boost Phys"), STAT_Mecha_PhysBoost, STATGROUP_Mecha);
+
+// ========================================
+// 저장 이동 (클라이언트 예측)
+// ========================================
+// 압축 플래그: FLAG_Custom_0 호버 / 1 어설트 부스트 / 2 퀵부스트 / 3 대시
+class FSavedMove_Mecha : public FSavedMove_Character
+{
+public:
+	typedef FSavedMove_Character Super;
+
+	uint8 bSavedWantsToHover : 1;
+	uint8 bSavedWantsAssaultBoost : 1;
+	uint8 bSavedWantsQuickBoost : 1;
+	uint8 bSavedWantsDash : 1;
+
+	// 리플레이 시 이동 시작 시점 상태로 되돌리기 위한 값 (서버로 보내지 않음)
+	uint8 bSavedPrevWantsToHover : 1;
+	uint8 bSavedPrevWantsAssaultBoost : 1;
+	uint8 bSavedPrevWantsQuickBoost : 1;
+	uint8 bSavedPrevWantsDash : 1;
+	FVector SavedBoostVelocity;
+	float SavedBoostTimeRemaining = 0.f;
+
+	virtual void Clear() override
+	{
+		Super::Clear();
+
+		bSavedWantsToHover = false;
+		bSavedWantsAssaultBoost = false;
+		bSavedWantsQuickBoost = false;
+		bSavedWantsDash = false;
+		bSavedPrevWantsToHover = false;
+		bSavedPrevWantsAssaultBoost = false;
+		bSavedPrevWantsQuickBoost = false;
+		bSavedPrevWantsDash = false;
+		SavedBoostVelocity = FVector::ZeroVector;
+		SavedBoostTimeRemaining = 0.f;
+	}
+
+	virtual uint8 GetCompressedFlags() const override
+	{
+		uint8 Result = Super::GetCompressedFlags();
+
+		if (bSavedWantsToHover)      Result |= FLAG_Custom_0;
+		if (bSavedWantsAssaultBoost) Result |= FLAG_Custom_1;
+		if (bSavedWantsQuickBoost)   Result |= FLAG_Custom_2;
+		if (bSavedWantsDash)         Result |= FLAG_Custom_3;
+
+		return Result;
+	}
+
+	virtual bool CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const override
+	{
+		const FSavedMove_Mecha* Other = static_cast<const FSavedMove_Mecha*>(NewMove.Get());
+
+		// 플래그가 바뀌는 이동은 합치지 않음 (모드 진입 시점 보존)
+		if (bSavedWantsToHover != Other->bSavedWantsToHover ||
+			bSavedWantsAssaultBoost != Other->bSavedWantsAssaultBoost ||
+			bSavedWantsQuickBoost != Other->bSavedWantsQuickBoost ||
+			bSavedWantsDash != Other->bSavedWantsDash)
+		{
+			return false;
+		}
+
+		return Super::CanCombineWith(NewMove, InCharacter, MaxDelta);
+	}
+
+	virtual void SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData) override
+	{
+		Super::SetMoveFor(C, InDeltaTime, NewAccel, ClientData);
+
+		const UMechaMovementComponent* Move = Cast<UMechaMovementComponent>(C->GetCharacterMovement());
+		if (!Move) return;
+
+		bSavedWantsToHover = Move->bWantsToHover;
+		bSavedWantsAssaultBoost = Move->bWantsAssaultBoost;
+		bSavedWantsQuickBoost = Move->bWantsQuickBoost;
+		bSavedWantsDash = Move->bWantsDash;
+		bSavedPrevWantsToHover = Move->bPrevWantsToHover;
+		bSavedPrevWantsAssaultBoost = Move->bPrevWantsAssaultBoost;
+		bSavedPrevWantsQuickBoost = Move->bPrevWantsQuickBoost;
+		bSavedPrevWantsDash = Move->bPrevWantsDash;
+		SavedBoostVelocity = Move->BoostVelocity;
+		SavedBoostTimeRemaining = Move->BoostTimeRemaining;
+	}
+
+	virtual void PrepMoveFor(ACharacter* C) override
+	{
+		Super::PrepMoveFor(C);
+
+		UMechaMovementComponent* Move = Cast<UMechaMovementComponent>(C->GetCharacterMovement());
+		if (!Move) return;
+
+		// 원함 플래그는 UpdateFromCompressedFlags가 복원
+		Move->bPrevWantsToHover = bSavedPrevWantsToHover;
+		Move->bPrevWantsAssaultBoost = bSavedPrevWantsAssaultBoost;
+		Move->bPrevWantsQuickBoost = bSavedPrevWantsQuickBoost;
+		Move->bPrevWantsDash = bSavedPrevWantsDash;
+		Move->BoostVelocity = SavedBoostVelocity;
+		Move->BoostTimeRemaining = SavedBoostTimeRemaining;
+	}
+};
+
+class FNetworkPredictionData_Client_Mecha : public FNetworkPredictionData_Client_Character
+{
+public:
+	typedef FNetworkPredictionData_Client_Character Super;
+
+	FNetworkPredictionData_Client_Mecha(const UCharacterMovementComponent& ClientMovement)
+		: Super(ClientMovement)
+	{
+	}
+
+	virtual FSavedMovePtr AllocateNewMove() override
+	{
+		return FSavedMovePtr(new FSavedMove_Mecha());
+	}
+};
+
+FNetworkPredictionData_Client* UMechaMovementComponent::GetPredictionData_Client() const
+{
+	check(PawnOwner != nullptr);
+
+	if (!ClientPredictionData)
+	{
+		UMechaMovementComponent* MutableThis = const_cast<UMechaMovementComponent*>(this);
+		MutableThis->ClientPredictionData = new FNetworkPredictionData_Client_Mecha(*this);
+	}
+
+	return ClientPredictionData;
+}
+
+void UMechaMovementComponent::UpdateFromCompressedFlags(uint8 Flags)
+{
+	Super::UpdateFromCompressedFlags(Flags);
+
+	bWantsToHover = (Flags & FSavedMove_Character::FLAG_Custom_0) != 0;
+	bWantsAssaultBoost = (Flags & FSavedMove_Character::FLAG_Custom_1) != 0;
+	bWantsQuickBoost = (Flags & FSavedMove_Character::FLAG_Custom_2) != 0;
+	bWantsDash = (Flags & FSavedMove_Character::FLAG_Custom_3) != 0;
+}
+
+// ========================================
+// 호버 시작 / 종료 - 시작은 플래그만 설정, 진입은 다음 이동 틱
+// ========================================
+void UMechaMovementComponent::StartHover(const FMechaHoverParams& Params)
+{
+	bWantsToHover = true;
+	bHoverLiftEnabled = Params.bApplyLift;
+	HoverGravityScale = Params.GravityScale;
+	HoverExitGravityScale = Params.ExitGravityScale;
+	HoverLiftImpulse = Params.LiftImpulse;
+}
+
+void UMechaMovementComponent::EnterHover()
+{
+	const bool bOnGround = IsMovingOnGround();
+	SetMovementMode(MOVE_Custom, (uint8)EMechaMovementMode::Hover);
+
+	// 지상이면 상승 속도 추가, 공중에서 하강 중이면 속도 보정
+	if (bOnGround)
+	{
+		Velocity.Z += HoverLiftImpulse;
+	}
+	else if (Velocity.Z < HoverMinEntryVelocityZ)
+	{
+		Velocity.Z = HoverMinEntryVelocityZ;
+	}
+}
+
+void UMechaMovementComponent::StopHover()
+{
+	if (!bWantsToHover) return;
+
+	bWantsToHover = false;
+	bHoverLiftEnabled = false;
+
+	// 사망 등으로 이동이 꺼져 있거나 부스트 중이면 모드는 그대로 둠
+	if (IsHovering())
+	{
+		SetMovementMode(MOVE_Falling);
+	}
+
+	if (HoverExitGravityScale >= 0.f)
+	{
+		GravityScale = HoverExitGravityScale;
+	}
+}
+
+void UMechaMovementComponent::SetHoverBoostFloor(bool bEnabled, float MinVelocityZ)
+{
+	bHoverBoostFloor = bEnabled;
+	HoverBoostMinVelocityZ = MinVelocityZ;
+}
+
+bool UMechaMovementComponent::IsHovering() const
+{
+	return IsCustomMovementMode(EMechaMovementMode::Hover);
+}
+
+// ========================================
+// 부스트 시작 / 종료 - 플래그만 설정, 진입은 다음 이동 틱
+// ========================================
+void UMechaMovementComponent::StartAssaultBoost(float Speed, float Duration)
+{
+	AssaultBoostSpeed = Speed;
+	AssaultBoostDuration = Duration;
+	bWantsAssaultBoost = true;
+}
+
+void UMechaMovementComponent::StopAssaultBoost()
+{
+	bWantsAssaultBoost = false;
+	if (IsCustomMovementMode(EMechaMovementMode::AssaultBoost))
+	{
+		EndBoost(EMechaMovementMode::AssaultBoost);
+	}
+}
+
+void UMechaMovementComponent::StartQuickBoost(float HorizontalSpeed, float VerticalSpeed, float Duration)
+{
+	QuickBoostSpeed = HorizontalSpeed;
+	QuickBoostLiftZ = VerticalSpeed;
+	QuickBoostDuration = Duration;
+	bWantsQuickBoost = true;
+}
+
+void UMechaMovementComponent::StopQuickBoost()
+{
+	bWantsQuickBoost = false;
+	if (IsCustomMovementMode(EMechaMovementMode::QuickBoost))
+	{
+		EndBoost(EMechaMovementMode::QuickBoost);
+	}
+}
+
+void UMechaMovementComponent::StartDash(const FVector& InDashVelocity, float Duration)
+{
+	DashVelocity = InDashVelocity;
+	DashDuration = Duration;
+	bWantsDash = true;
+}
+
+void UMechaMovementComponent::StopDash()
+{
+	bWantsDash = false;
+	if (IsCustomMovementMode(EMechaMovementMode::Dash))
+	{
+		EndBoost(EMechaMovementMode::Dash);
+	}
+}
+
+bool UMechaMovementComponent::IsBoosting() const
+{
+	return IsCustomMovementMode(EMechaMovementMode::AssaultBoost) ||
+		IsCustomMovementMode(EMechaMovementMode::QuickBoost) ||
+		IsCustomMovementMode(EMechaMovementMode::Dash);
+}
+
+void UMechaMovementComponent::EnterBoost(EMechaMovementMode Mode)
+{
+	if (!CharacterOwner) return;
+
+	const FVector Forward = CharacterOwner->GetActorForwardVector();
+
+	switch (Mode)
+	{
+	case EMechaMovementMode::AssaultBoost:
+		BoostVelocity = Forward * AssaultBoostSpeed;
+		BoostGravityScale = 0.f;
+		BoostTimeRemaining = AssaultBoostDuration;
+		break;
+
+	case EMechaMovementMode::QuickBoost:
+	{
+		// 이번 이동의 입력 가속 방향 (서버도 같은 이동의 가속값을 받음)
+		FVector Dir = Acceleration.GetSafeNormal2D();
+		if (Dir.IsNearlyZero())
+		{
+			Dir = Forward.GetSafeNormal2D();
+		}
+		BoostVelocity = Dir * QuickBoostSpeed + FVector(0.f, 0.f, QuickBoostLiftZ);
+		BoostGravityScale = 1.f;
+		BoostTimeRemaining = QuickBoostDuration;
+		break;
+	}
+
+	case EMechaMovementMode::Dash:
+		BoostVelocity = FVector(DashVelocity.X, DashVelocity.Y, 0.f);
+		BoostGravityScale = 1.f;
+		BoostTimeRemaining = DashDuration;
+		break;
+
+	default:
+		return;
+	}
+
+	Velocity = BoostVelocity;
+	SetMovementMode(MOVE_Custom, (uint8)Mode);
+}
+
+void UMechaMovementComponent::EndBoost(EMechaMovementMode Mode)
+{
+	BoostTimeRemaining = 0.f;
+
+	switch (Mode)
+	{
+	case EMechaMovementMode::AssaultBoost:
+		bWantsAssaultBoost = false;
+		Velocity = FVector::ZeroVector;
+		break;
+
+	case EMechaMovementMode::QuickBoost:
+		// 퀵부스트는 관성 유지
+		bWantsQuickBoost = false;
+		break;
+
+	case EMechaMovementMode::Dash:
+		bWantsDash = false;
+		Velocity = FVector::ZeroVector;
+		break;
+
+	default:
+		break;
+	}
+
+	// 착지 판정은 Falling이 처리 (호버 중이었으면 다음 이동 틱에 호버로 복귀)
+	SetMovementMode(MOVE_Falling);
+}
+
+// ========================================
+// 모드별 속도 한계 - 호버는 Flying 설정, 부스트는 부스트 속도
+// ========================================
+float UMechaMovementComponent::GetMaxSpeed() const
+{
+	if (IsHovering())
+	{
+		return MaxFlySpeed;
+	}
+	if (IsBoosting())
+	{
+		return BoostVelocity.Size();
+	}
+	return Super::GetMaxSpeed();
+}
+
+float UMechaMovementComponent::GetMaxBrakingDeceleration() const
+{
+	if (IsHovering())
+	{
+		return BrakingDecelerationFlying;
+	}
+	return Super::GetMaxBrakingDeceleration();
+}
+
+bool UMechaMovementComponent::IsFlying() const
+{
+	return Super::IsFlying() || IsHovering() || IsCustomMovementMode(EMechaMovementMode::AssaultBoost);
+}
+
+bool UMechaMovementComponent::IsFalling() const
+{
+	return Super::IsFalling() || IsCustomMovementMode(EMechaMovementMode::QuickBoost);
+}
+
+// ========================================
+// 이동 틱 시작 - 플래그에 따라 모드 진입 / 호버 유지
+// ========================================
+void UMechaMovementComponent::UpdateCharacterStateBeforeMovement(float DeltaSeconds)
+{
+	Super::UpdateCharacterStateBeforeMovement(DeltaSeconds);
+
+	// 부스트는 플래그가 켜지는 이동에서만 진입 (서버가 먼저 끝내도 같은 플래그로 재진입하지 않음)
+	const bool bCanMove = MovementMode != MOVE_None;
+
+	if (bCanMove && bWantsAssaultBoost && !bPrevWantsAssaultBoost)
+	{
+		EnterBoost(EMechaMovementMode::AssaultBoost);
+	}
+	else if (bCanMove && bWantsQuickBoost && !bPrevWantsQuickBoost)
+	{
+		EnterBoost(EMechaMovementMode::QuickBoost);
+	}
+	else if (bCanMove && bWantsDash && !bPrevWantsDash)
+	{
+		EnterBoost(EMechaMovementMode::Dash);
+	}
+
+	bPrevWantsAssaultBoost = bWantsAssaultBoost;
+	bPrevWantsQuickBoost = bWantsQuickBoost;
+	bPrevWantsDash = bWantsDash;
+
+	// 호버 플래그가 켜지는 이동에서 진입 (부스트 중이면 부스트가 끝난 뒤 아래 복귀로 진입, 상승 속도 없음)
+	const bool bHoverStarted = bWantsToHover && !bPrevWantsToHover;
+	bPrevWantsToHover = bWantsToHover;
+
+	if (bHoverStarted && bCanMove && !IsBoosting())
+	{
+		EnterHover();
+		return;
+	}
+
+	// LaunchCharacter(→Falling)나 착지(→Walking)로 밀려났으면 호버로 복귀.
+	// 부스트 등 다른 커스텀 모드, Flying, None(사망)은 건드리지 않음
+	if (bWantsToHover && !IsHovering() &&
+		(MovementMode == MOVE_Walking || MovementMode == MOVE_NavWalking || MovementMode == MOVE_Falling))
+	{
+		SetMovementMode(MOVE_Custom, (uint8)EMechaMovementMode::Hover);
+	}
+}
+
+// ========================================
+// PhysCustom
+// ========================================
+void UMechaMovementComponent::PhysCustom(float deltaTime, int32 Iterations)
+{
+	switch ((EMechaMovementMode)CustomMovementMode)
+	{
+	case EMechaMovementMode::Hover:
+		PhysHover(deltaTime, Iterations);
+		break;
+
+	case EMechaMovementMode::AssaultBoost:
+	case EMechaMovementMode::QuickBoost:
+	case EMechaMovementMode::Dash:
+		PhysBoost(deltaTime, Iterations);
+		break;
+
+	default:
+		Super::PhysCustom(deltaTime, Iterations);
+		break;
+	}
+}
+
+// ========================================
+// 호버 물리 - PhysFlying 기반, 서브스텝마다 수직 속도 적분 후 이동
+// ========================================
+void UMechaMovementComponent::PhysHover(float deltaTime, int32 Iterations)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Mecha_PhysHover);
+
+	if (deltaTime < MIN_TICK_TIME) return;
+
+	float RemainingTime = deltaTime;
+	int32 NumSubsteps = 0;
+
+	while (RemainingTime >= MIN_TICK_TIME && IsHovering() && CharacterOwner)
+	{
+		++Iterations;
+		++NumSubsteps;
+
+		// 마지막 서브스텝은 남은 시간을 모두 사용 (히치 프레임에서도 반복 횟수 제한)
+		const bool bLastSubstep = NumSubsteps >= CustomMaxSubsteps || Iterations >= MaxSimulationIterations;
+		const float TimeTick = bLastSubstep ? RemainingTime : FMath::Min(RemainingTime, CustomMaxSubstepTime);
+		RemainingTime -= TimeTick;
+
+		bJustTeleported = false;
+		RestorePreAdditiveRootMotionVelocity();
+
+		if (!HasAnimRootMotion() && !CurrentRootMotion.HasOverrideVelocity())
+		{
+			// 입력 가속 / 제동 (HoverFriction, BrakingDecelerationFlying)
+			CalcVelocity(TimeTick, HoverFriction, true, GetMaxBrakingDeceleration());
+			ApplyHoverVerticalVelocity(TimeTick);
+		}
+
+		ApplyRootMotionToVelocity(TimeTick);
+
+		// ========== 이동 (막히면 표면을 따라 미끄러짐) ==========
+		const FVector OldLocation = UpdatedComponent->GetComponentLocation();
+		const FVector Adjusted = Velocity * TimeTick;
+		FHitResult Hit(1.f);
+		SafeMoveUpdatedComponent(Adjusted, UpdatedComponent->GetComponentQuat(), true, Hit);
+
+		if (Hit.Time < 1.f)
+		{
+			HandleImpact(Hit, TimeTick, Adjusted);
+			SlideAlongSurface(Adjusted, 1.f - Hit.Time, Hit.Normal, Hit, true);
+		}
+
+		// 실제 이동량으로 속도 갱신 (천장/벽에 막힌 성분 제거)
+		if (!bJustTeleported && !HasAnimRootMotion() && !CurrentRootMotion.HasOverrideVelocity())
+		{
+			Velocity = (UpdatedComponent->GetComponentLocation() - OldLocation) / TimeTick;
+		}
+
+		if (bLastSubstep) break;
+	}
+}
+
+void UMechaMovementComponent::ApplyHoverVerticalVelocity(float DeltaTime)
+{
+	// 호버 중력 (캐릭터 GravityScale은 호버 종료 후 낙하용이므로 월드 중력 기준)
+	Velocity.Z += UMovementComponent::GetGravityZ() * HoverGravityScale * DeltaTime;
+
+	// 상승 보정 - 최대 상승 속도까지 천천히 가속
+	if (bHoverLiftEnabled && Velocity.Z < HoverMaxRiseSpeed)
+	{
+		Velocity.Z = FMath::Min(Velocity.Z + HoverLiftAcceleration * DeltaTime, HoverMaxRiseSpeed);
+	}
+
+	// 부스팅 중 최소 상승 속도 유지
+	if (bHoverBoostFloor)
+	{
+		Velocity.Z = FMath::Max(Velocity.Z, HoverBoostMinVelocityZ);
+	}
+}
+
+// ========================================
+// 부스트 물리 - 수평 속도 고정, 수직은 중력 배율로 적분, 시간이 다 되면 Falling
+// ========================================
+void UMechaMovementComponent::PhysBoost(float deltaTime, int32 Iterations)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Mecha_PhysBoost);
+
+	if (deltaTime < MIN_TICK_TIME) return;
+
+	const EMechaMovementMode Mode = (EMechaMovementMode)CustomMovementMode;
+	float RemainingTime = deltaTime;
+	int32 NumSubsteps = 0;
+
+	while (RemainingTime >= MIN_TICK_TIME && IsCustomMovementMode(Mode) && CharacterOwner)
+	{
+		++Iterations;
+		++NumSubsteps;
+
+		const bool bLastSubstep = NumSubsteps >= CustomMaxSubsteps || Iterations >= MaxSimulationIterations;
+		float TimeTick = bLastSubstep ? RemainingTime : FMath::Min(RemainingTime, CustomMaxSubstepTime);
+
+		// 부스트 종료 시점에서 끊고 남은 시간은 다음 모드로
+		const bool bBoostEnds = TimeTick >= BoostTimeRemaining;
+		TimeTick = FMath::Min(TimeTick, FMath::Max(BoostTimeRemaining, 0.f));
+		RemainingTime -= TimeTick;
+		BoostTimeRemaining -= TimeTick;
+
+		bJustTeleported = false;
+
+		if (TimeTick >= MIN_TICK_TIME)
+		{
+			// 수평 속도는 고정, 수직은 진입 속도 + 중력
+			Velocity.X = BoostVelocity.X;
+			Velocity.Y = BoostVelocity.Y;
+			Velocity.Z = (BoostGravityScale != 0.f)
+				? Velocity.Z + UMovementComponent::GetGravityZ() * BoostGravityScale * TimeTick
+				: BoostVelocity.Z;
+
+			const FVector OldLocation = UpdatedComponent->GetComponentLocation();
+			const FVector Adjusted = Velocity * TimeTick;
+			FHitResult Hit(1.f);
+			SafeMoveUpdatedComponent(Adjusted, UpdatedComponent->GetComponentQuat(), true, Hit);
+
+			if (Hit.Time < 1.f)
+			{
+				HandleImpact(Hit, TimeTick, Adjusted);
+				SlideAlongSurface(Adjusted, 1.f - Hit.Time, Hit.Normal, Hit, true);
+			}
+
+			if (!bJustTeleported)
+			{
+				Velocity = (UpdatedComponent->GetComponentLocation() - OldLocation) / TimeTick;
+			}
+		}
+
+		if (bBoostEnds)
+		{
+			EndBoost(Mode);
+			StartNewPhysics(RemainingTime, Iterations);
+			return;
+		}
+
+		if (bLastSubstep) break;
+	}
+}
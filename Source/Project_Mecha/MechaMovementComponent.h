@@ -0,0 +1,188 @@
+// MechaMovementComponent.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+// 설명:
+// - 메카 전용 CharacterMovementComponent. AMechaCharacterBase / AEnemyMecha가 기본 이동 컴포넌트 대신 사용합니다.
+// - MOVE_Custom 하위 모드(EMechaMovementMode)로 호버, 어설트 부스트, 퀵부스트, 적 대시를 처리합니다.
+//   PhysCustom 안에서 서브스텝 단위로 적분하므로 능력 타이머나 GravityScale·마찰 저장/복원이 필요 없습니다.
+// - 호버: 상승 보정 / 중력 배율 / 마찰 / 부스트 최소 상승 속도.
+//   진입(모드 전환 + 지상 시작 시 1회 상승 속도)은 부스트처럼 플래그가 켜지는 이동 틱에서 합니다.
+//   LaunchCharacter나 착지로 다른 모드가 되면 다음 이동 틱에 호버로 되돌립니다.
+// - 부스트(어설트/퀵/대시): 진입 시 정한 속도로 지정 시간 동안 직선 이동 후 Falling으로 종료.
+// - 능력은 Start*/Stop*으로 "원함" 플래그만 켜고, 실제 모드 진입은 다음 이동 틱에서 합니다.
+//   플래그는 FSavedMove_Mecha의 압축 플래그(FLAG_Custom_0~3)로 서버에 전달되어
+//   클라이언트 예측/리플레이와 서버 이동이 같은 시점에 같은 모드로 들어갑니다.
+// - 애님 BP 호환: 호버/어설트 부스트 중 IsFlying(), 퀵부스트 중 IsFalling()이 true.
+#include "MechaMovementComponent.generated.h"
+
+// MOVE_Custom 하위 모드
+UENUM(BlueprintType)
+enum class EMechaMovementMode : uint8
+{
+    None         UMETA(Hidden),
+    Hover        UMETA(DisplayName = "Hover"),
+    AssaultBoost UMETA(DisplayName = "Assault Boost"),
+    QuickBoost   UMETA(DisplayName = "Quick Boost"),
+    Dash         UMETA(DisplayName = "Dash"),
+    MAX          UMETA(Hidden)
+};
+
+// 호버 시작 시 능력이 넘기는 설정
+USTRUCT(BlueprintType)
+struct FMechaHoverParams
+{
+    GENERATED_BODY()
+
+    // 호버 중 중력 배율 (월드 중력 기준, 캐릭터 GravityScale과 무관)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hover")
+    float GravityScale = 0.f;
+
+    // 상승 보정 사용 여부
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hover")
+    bool bApplyLift = true;
+
+    // 지상에서 시작할 때 더하는 상승 속도
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hover")
+    float LiftImpulse = 1800.f;
+
+    // 호버 종료 후 낙하 중력 배율 (음수면 GravityScale 유지)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hover")
+    float ExitGravityScale = -1.f;
+};
+
+UCLASS()
+class PROJECT_MECHA_API UMechaMovementComponent : public UCharacterMovementComponent
+{
+    GENERATED_BODY()
+
+    friend class FSavedMove_Mecha;
+
+public:
+    // ===== 호버 =====
+    void StartHover(const FMechaHoverParams& Params);
+    void StopHover();
+
+    // 에너지 부족 등으로 상승 보정만 끄고 켬
+    void SetHoverLiftEnabled(bool bEnabled) { bHoverLiftEnabled = bEnabled; }
+
+    // 부스팅 중 최소 상승 속도 (State.Boosting 태그 변화 시 캐릭터가 설정)
+    void SetHoverBoostFloor(bool bEnabled, float MinVelocityZ);
+
+    UFUNCTION(BlueprintPure, Category = "Mecha|Movement")
+    bool IsHovering() const;
+
+    // ===== 부스트 =====
+    // 액터 정면으로 Speed 속도, Duration 동안 직선 돌진 (중력 없음)
+    UFUNCTION(BlueprintCallable, Category = "Mecha|Movement")
+    void StartAssaultBoost(float Speed, float Duration);
+
+    UFUNCTION(BlueprintCallable, Category = "Mecha|Movement")
+    void StopAssaultBoost();
+
+    // 입력 방향(없으면 정면)으로 수평 HorizontalSpeed + 상승 VerticalSpeed, Duration 동안 유지 후 관성 낙하
+    UFUNCTION(BlueprintCallable, Category = "Mecha|Movement")
+    void StartQuickBoost(float HorizontalSpeed, float VerticalSpeed, float Duration);
+
+    UFUNCTION(BlueprintCallable, Category = "Mecha|Movement")
+    void StopQuickBoost();
+
+    // 지정 속도(수평)로 Duration 동안 미끄러지듯 이동 후 정지 (적 대시)
+    UFUNCTION(BlueprintCallable, Category = "Mecha|Movement")
+    void StartDash(const FVector& DashVelocity, float Duration);
+
+    UFUNCTION(BlueprintCallable, Category = "Mecha|Movement")
+    void StopDash();
+
+    bool IsCustomMovementMode(EMechaMovementMode Mode) const
+    {
+        return MovementMode == MOVE_Custom && CustomMovementMode == (uint8)Mode;
+    }
+
+    // ===== UCharacterMovementComponent =====
+    virtual float GetMaxSpeed() const override;
+    virtual float GetMaxBrakingDeceleration() const override;
+    virtual bool IsFlying() const override;
+    virtual bool IsFalling() const override;
+    virtual FNetworkPredictionData_Client* GetPredictionData_Client() const override;
+
+protected:
+    virtual void PhysCustom(float deltaTime, int32 Iterations) override;
+    virtual void UpdateCharacterStateBeforeMovement(float DeltaSeconds) override;
+    virtual void UpdateFromCompressedFlags(uint8 Flags) override;
+
+    // ===== 호버 튜닝 =====
+    // 상승 보정 가속도 (cm/s^2)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Character Movement: Hover")
+    float HoverLiftAcceleration = 600.f;
+
+    // 상승 보정으로 도달하는 최대 상승 속도
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Character Movement: Hover")
+    float HoverMaxRiseSpeed = 800.f;
+
+    // 공중에서 호버 시작 시 최소 Z 속도 (하강 중이면 이 값으로 보정)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Character Movement: Hover")
+    float HoverMinEntryVelocityZ = 80.f;
+
+    // 호버 중 마찰 (0이면 미끄러지는 공중 이동)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Character Movement: Hover", meta = (ClampMin = "0"))
+    float HoverFriction = 0.f;
+
+    // ===== 커스텀 모드 공통 =====
+    // 서브스텝 최대 길이 (초). 프레임이 길면 여러 번 나눠 적분
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Character Movement: Mecha", meta = (ClampMin = "0.001", ClampMax = "0.05"))
+    float CustomMaxSubstepTime = 1.f / 60.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Character Movement: Mecha", meta = (ClampMin = "1", ClampMax = "16"))
+    int32 CustomMaxSubsteps = 4;
+
+private:
+    // ===== 예측 입력 플래그 (FSavedMove_Mecha 압축 플래그) =====
+    bool bWantsToHover = false;
+    bool bWantsAssaultBoost = false;
+    bool bWantsQuickBoost = false;
+    bool bWantsDash = false;
+
+    // 직전 이동의 호버/부스트 플래그 (켜지는 순간에만 진입)
+    bool bPrevWantsToHover = false;
+    bool bPrevWantsAssaultBoost = false;
+    bool bPrevWantsQuickBoost = false;
+    bool bPrevWantsDash = false;
+
+    // ===== 호버 상태 =====
+    bool bHoverLiftEnabled = false;
+    float HoverGravityScale = 0.f;
+    float HoverExitGravityScale = -1.f;
+    float HoverLiftImpulse = 0.f;
+
+    bool bHoverBoostFloor = false;
+    float HoverBoostMinVelocityZ = 0.f;
+
+    // ===== 부스트 설정 (Start*에서 능력 값으로 설정) =====
+    float AssaultBoostSpeed = 4000.f;
+    float AssaultBoostDuration = 0.8f;
+    float QuickBoostSpeed = 1500.f;
+    float QuickBoostLiftZ = 200.f;
+    float QuickBoostDuration = 0.15f;
+    FVector DashVelocity = FVector::ZeroVector;
+    float DashDuration = 0.35f;
+
+    // ===== 진행 중인 부스트 =====
+    FVector BoostVelocity = FVector::ZeroVector;
+    float BoostGravityScale = 0.f;
+    float BoostTimeRemaining = 0.f;
+
+    void PhysHover(float deltaTime, int32 Iterations);
+    void PhysBoost(float deltaTime, int32 Iterations);
+
+    // 중력 / 상승 보정 / 부스트 최소 상승 속도를 Velocity.Z에 적용
+    void ApplyHoverVerticalVelocity(float DeltaTime);
+
+    // 호버 진입 (지상이면 상승 속도 추가, 공중에서 하강 중이면 속도 보정)
+    void EnterHover();
+
+    void EnterBoost(EMechaMovementMode Mode);
+    void EndBoost(EMechaMovementMode Mode);
+    bool IsBoosting() const;
+};
@@ -0,0 +1,171 @@
+// MechaNativeTags.cpp
+// 네이티브 게임플레이 태그 정의 및 DefaultGameplayTags.ini 대조 검증
+
+#include "MechaNativeTags.h"
+
+#include "Project_Mecha.h"
+#include "GameplayTagsSettings.h"
+
+namespace MechaTags
+{
+	// ===== Ability =====
+	UE_DEFINE_GAMEPLAY_TAG(Ability_AssaultBoost, "Ability.AssaultBoost");
+	UE_DEFINE_GAMEPLAY_TAG(Ability_Attack, "Ability.Attack");
+	UE_DEFINE_GAMEPLAY_TAG(Ability_Boost, "Ability.Boost");
+	UE_DEFINE_GAMEPLAY_TAG(Ability_Dash_Enemy, "Ability.Dash.Enemy");
+	UE_DEFINE_GAMEPLAY_TAG(Ability_GunFire, "Ability.GunFire");
+	UE_DEFINE_GAMEPLAY_TAG(Ability_Hook_Boss, "Ability.Hook.Boss");
+	UE_DEFINE_GAMEPLAY_TAG(Ability_Hover, "Ability.Hover");
+	UE_DEFINE_GAMEPLAY_TAG(Ability_Missile_Enemy, "Ability.Missile.Enemy");
+	UE_DEFINE_GAMEPLAY_TAG(Ability_MissileFire, "Ability.MissileFire");
+	UE_DEFINE_GAMEPLAY_TAG(Ability_QuickBoost, "Ability.QuickBoost");
+	UE_DEFINE_GAMEPLAY_TAG(Ability_QuickBoost_Boss, "Ability.QuickBoost.Boss");
+	UE_DEFINE_GAMEPLAY_TAG(Ability_Reload, "Ability.Reload");
+
+	// ===== Block =====
+	UE_DEFINE_GAMEPLAY_TAG(Block_AssaultBoost, "Block.AssaultBoost");
+	UE_DEFINE_GAMEPLAY_TAG(Block_Boost, "Block.Boost");
+	UE_DEFINE_GAMEPLAY_TAG(Block_Fire, "Block.Fire");
+	UE_DEFINE_GAMEPLAY_TAG(Block_Hover, "Block.Hover");
+	UE_DEFINE_GAMEPLAY_TAG(Block_MissileFire, "Block.MissileFire");
+	UE_DEFINE_GAMEPLAY_TAG(Block_Overheat, "Block.Overheat");
+	UE_DEFINE_GAMEPLAY_TAG(Block_State, "Block.State");
+
+	// ===== Cooldown =====
+	UE_DEFINE_GAMEPLAY_TAG(Cooldown_Boost, "Cooldown.Boost");
+	UE_DEFINE_GAMEPLAY_TAG(Cooldown_Dash, "Cooldown.Dash");
+	UE_DEFINE_GAMEPLAY_TAG(Cooldown_Hover, "Cooldown.Hover");
+	UE_DEFINE_GAMEPLAY_TAG(Cooldown_Missile_Enemy, "Cooldown.Missile.Enemy");
+	UE_DEFINE_GAMEPLAY_TAG(Cooldown_MissileFire, "Cooldown.MissileFire");
+
+	// ===== Data =====
+	UE_DEFINE_GAMEPLAY_TAG(Data_Damage, "Data.Damage");
+
+	// ===== GameplayCue =====
+	UE_DEFINE_GAMEPLAY_TAG(GameplayCue_AssaultBoost, "GameplayCue.AssaultBoost");
+	UE_DEFINE_GAMEPLAY_TAG(GameplayCue_Hovering, "GameplayCue.Hovering");
+	UE_DEFINE_GAMEPLAY_TAG(GameplayCue_QuickBoost, "GameplayCue.QuickBoost");
+
+	// ===== Input =====
+	UE_DEFINE_GAMEPLAY_TAG(Input_QuickBoost, "Input.QuickBoost");
+
+	// ===== State =====
+	UE_DEFINE_GAMEPLAY_TAG(State_Attacking, "State.Attacking");
+	UE_DEFINE_GAMEPLAY_TAG(State_Boosting, "State.Boosting");
+	UE_DEFINE_GAMEPLAY_TAG(State_Dashing, "State.Dashing");
+	UE_DEFINE_GAMEPLAY_TAG(State_Dead, "State.Dead");
+	UE_DEFINE_GAMEPLAY_TAG(State_Firing, "State.Firing");
+	UE_DEFINE_GAMEPLAY_TAG(State_Hovering, "State.Hovering");
+	UE_DEFINE_GAMEPLAY_TAG(State_Overheat, "State.Overheat");
+	UE_DEFINE_GAMEPLAY_TAG(State_Overheated, "State.Overheated");
+	UE_DEFINE_GAMEPLAY_TAG(State_Reloading, "State.Reloading");
+	UE_DEFINE_GAMEPLAY_TAG(State_SuperArmor, "State.SuperArmor");
+}
+
+// ========================================
+// SetByCaller 키 변환
+// ========================================
+FGameplayTag FMechaNativeTags::ResolveSetByCallerTag(FName TagName)
+{
+	const FGameplayTag DamageTag = MechaTags::Data_Damage;
+	if (TagName == DamageTag.GetTagName())
+	{
+		return DamageTag;
+	}
+	return FGameplayTag::RequestGameplayTag(TagName, false);
+}
+
+// ========================================
+// ini 대조 검증
+// ========================================
+void FMechaNativeTags::ValidateAgainstConfig()
+{
+	// 위에서 선언한 네이티브 태그 목록
+	static const FNativeGameplayTag* const NativeTags[] =
+	{
+		&MechaTags::Ability_AssaultBoost,
+		&MechaTags::Ability_Attack,
+		&MechaTags::Ability_Boost,
+		&MechaTags::Ability_Dash_Enemy,
+		&MechaTags::Ability_GunFire,
+		&MechaTags::Ability_Hook_Boss,
+		&MechaTags::Ability_Hover,
+		&MechaTags::Ability_Missile_Enemy,
+		&MechaTags::Ability_MissileFire,
+		&MechaTags::Ability_QuickBoost,
+		&MechaTags::Ability_QuickBoost_Boss,
+		&MechaTags::Ability_Reload,
+		&MechaTags::Block_AssaultBoost,
+		&MechaTags::Block_Boost,
+		&MechaTags::Block_Fire,
+		&MechaTags::Block_Hover,
+		&MechaTags::Block_MissileFire,
+		&MechaTags::Block_Overheat,
+		&MechaTags::Block_State,
+		&MechaTags::Cooldown_Boost,
+		&MechaTags::Cooldown_Dash,
+		&MechaTags::Cooldown_Hover,
+		&MechaTags::Cooldown_Missile_Enemy,
+		&MechaTags::Cooldown_MissileFire,
+		&MechaTags::Data_Damage,
+		&MechaTags::GameplayCue_AssaultBoost,
+		&MechaTags::GameplayCue_Hovering,
+		&MechaTags::GameplayCue_QuickBoost,
+		&MechaTags::Input_QuickBoost,
+		&MechaTags::State_Attacking,
+		&MechaTags::State_Boosting,
+		&MechaTags::State_Dashing,
+		&MechaTags::State_Dead,
+		&MechaTags::State_Firing,
+		&MechaTags::State_Hovering,
+		&MechaTags::State_Overheat,
+		&MechaTags::State_Overheated,
+		&MechaTags::State_Reloading,
+		&MechaTags::State_SuperArmor,
+	};
+
+	TSet<FName> NativeNames;
+	for (const FNativeGameplayTag* Tag : NativeTags)
+	{
+		NativeNames.Add(Tag->GetTag().GetTagName());
+	}
+
+	const UGameplayTagsSettings* Settings = GetDefault<UGameplayTagsSettings>();
+	if (!Settings) return;
+
+	// ========== ini → 네이티브 누락 (오류) ==========
+	TSet<FName> ConfigNames;
+	TArray<FString> Missing;
+	for (const FGameplayTagTableRow& Row : Settings->GameplayTagList)
+	{
+		ConfigNames.Add(Row.Tag);
+		if (!NativeNames.Contains(Row.Tag))
+		{
+			Missing.Add(Row.Tag.ToString());
+		}
+	}
+
+	// ========== 네이티브 → ini 누락 (경고만, 네이티브 등록으로 동작에는 문제 없음) ==========
+	for (const FName& NativeName : NativeNames)
+	{
+		if (!ConfigNames.Contains(NativeName))
+		{
+			UE_LOG(LogMecha, Warning, TEXT("[NativeTags] Native tag %s is not listed in DefaultGameplayTags.ini"), *NativeName.ToString());
+		}
+	}
+
+	if (Missing.Num() == 0)
+	{
+		UE_LOG(LogMecha, Log, TEXT("[NativeTags] %d native tags match DefaultGameplayTags.ini"), NativeNames.Num());
+		return;
+	}
+
+	const FString MissingList = FString::Join(Missing, TEXT(", "));
+
+#if WITH_EDITOR
+	ensureAlwaysMsgf(false, TEXT("[NativeTags] Tags in DefaultGameplayTags.ini without a native declaration in MechaNativeTags: %s"), *MissingList);
+	UE_LOG(LogMecha, Error, TEXT("[NativeTags] Missing native tags: %s"), *MissingList);
+#else
+	UE_LOG(LogMecha, Fatal, TEXT("[NativeTags] Tags in DefaultGameplayTags.ini without a native declaration in MechaNativeTags: %s"), *MissingList);
+#endif
+}
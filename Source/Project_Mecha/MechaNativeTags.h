@@ -0,0 +1,77 @@
+// MechaNativeTags.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NativeGameplayTags.h"
+// 설명:
+// - DefaultGameplayTags.ini의 모든 태그를 네이티브 태그로 선언합니다 (모듈 로드 시 한 번 등록).
+// - C++ 코드는 FGameplayTag::RequestGameplayTag(TEXT("...")) 문자열 조회 대신 MechaTags::X를 사용합니다.
+// - 모듈 시작 시 FMechaNativeTags::ValidateAgainstConfig()로 ini 태그가 모두 선언되어 있는지 검사합니다.
+// - ini에 태그를 추가하면 여기(.h/.cpp)에도 같이 추가해야 합니다.
+
+namespace MechaTags
+{
+    // ===== Ability (능력) =====
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Ability_AssaultBoost);
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Ability_Attack);
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Ability_Boost);
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Ability_Dash_Enemy);
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Ability_GunFire);
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Ability_Hook_Boss);
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Ability_Hover);
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Ability_Missile_Enemy);
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Ability_MissileFire);
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Ability_QuickBoost);
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Ability_QuickBoost_Boss);
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Ability_Reload);
+
+    // ===== Block (차단) =====
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Block_AssaultBoost);
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Block_Boost);
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Block_Fire);
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Block_Hover);
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Block_MissileFire);
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Block_Overheat);
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Block_State);
+
+    // ===== Cooldown (쿨타임) =====
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Cooldown_Boost);
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Cooldown_Dash);
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Cooldown_Hover);
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Cooldown_Missile_Enemy);
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Cooldown_MissileFire);
+
+    // ===== Data (SetByCaller 데이터) =====
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_Damage);
+
+    // ===== GameplayCue (게임플레이 큐) =====
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GameplayCue_AssaultBoost);
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GameplayCue_Hovering);
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GameplayCue_QuickBoost);
+
+    // ===== Input (입력) =====
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Input_QuickBoost);
+
+    // ===== State (상태) =====
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Attacking);
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Boosting);
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Dashing);
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Dead);
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Firing);
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Hovering);
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Overheat);
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Overheated);
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Reloading);
+    PROJECT_MECHA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_SuperArmor);
+}
+
+struct PROJECT_MECHA_API FMechaNativeTags
+{
+    // ini(GameplayTagsSettings)에 있는데 네이티브로 선언되지 않은 태그가 있으면
+    // 에디터에서는 ensure, 그 외 빌드에서는 Fatal로 중단
+    static void ValidateAgainstConfig();
+
+    // BP에서 FName으로 지정하는 SetByCaller 키를 태그로 변환
+    // (기본값 Data.Damage는 문자열 조회 없이 네이티브 태그 반환)
+    static FGameplayTag ResolveSetByCallerTag(FName TagName);
+};
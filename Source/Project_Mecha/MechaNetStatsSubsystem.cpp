@@ -0,0 +1,131 @@
+// MechaNetStatsSubsystem.cpp
+// 연결별 대역폭 리포트 - 콘솔 명령 / 주기적 로그
+
+#include "MechaNetStatsSubsystem.h"
+#include "Project_Mecha.h"
+
+#include "Engine/Engine.h"
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarMechaNetBandwidthLogInterval(
+	TEXT("Mecha.Net.BandwidthLogInterval"),
+	0.f,
+	TEXT("0보다 크면 이 간격(초)마다 연결별 대역폭을 로그로 출력합니다."));
+
+// 콘솔 명령: 현재 월드의 연결별 대역폭 출력
+static FAutoConsoleCommandWithWorld GMechaNetBandwidthCmd(
+	TEXT("Mecha.Net.Bandwidth"),
+	TEXT("연결(클라이언트)별 In/Out 바이트/초, 핑, 패킷 손실을 출력합니다."),
+	FConsoleCommandWithWorldDelegate::CreateStatic([](UWorld* World)
+		{
+			if (const UMechaNetStatsSubsystem* NetStats = UMechaNetStatsSubsystem::Get(World))
+			{
+				NetStats->DumpBandwidth();
+			}
+		}));
+
+// ========================================
+// 접근자
+// ========================================
+UMechaNetStatsSubsystem* UMechaNetStatsSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine || !WorldContextObject) return nullptr;
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UMechaNetStatsSubsystem>() : nullptr;
+}
+
+bool UMechaNetStatsSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UMechaNetStatsSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMechaNetStatsSubsystem, STATGROUP_Tickables);
+}
+
+// ========================================
+// 매 프레임 - 주기 로그 (CVar가 0이면 아무것도 안 함)
+// ========================================
+void UMechaNetStatsSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const float Interval = CVarMechaNetBandwidthLogInterval.GetValueOnGameThread();
+	if (Interval <= 0.f)
+	{
+		TimeSinceLastLog = 0.f;
+		return;
+	}
+
+	TimeSinceLastLog += DeltaTime;
+	if (TimeSinceLastLog >= Interval)
+	{
+		TimeSinceLastLog = 0.f;
+		DumpBandwidth();
+	}
+}
+
+// ========================================
+// 출력
+// ========================================
+void UMechaNetStatsSubsystem::DumpBandwidth() const
+{
+	const UWorld* World = GetWorld();
+	const UNetDriver* NetDriver = World ? World->GetNetDriver() : nullptr;
+	if (!NetDriver)
+	{
+		UE_LOG(LogMecha, Log, TEXT("[NetStats] No net driver (standalone)"));
+		return;
+	}
+
+	// 클라이언트: 서버 연결 하나
+	if (NetDriver->ServerConnection)
+	{
+		UE_LOG(LogMecha, Log, TEXT("[NetStats] Client -> server"));
+		LogConnection(NetDriver->ServerConnection, 0);
+		return;
+	}
+
+	// 서버: 클라이언트 연결 전체 + 합계
+	int32 TotalIn = 0;
+	int32 TotalOut = 0;
+	for (const UNetConnection* Connection : NetDriver->ClientConnections)
+	{
+		if (Connection)
+		{
+			TotalIn += Connection->InBytesPerSecond;
+			TotalOut += Connection->OutBytesPerSecond;
+		}
+	}
+
+	UE_LOG(LogMecha, Log, TEXT("[NetStats] Server %s: %d client(s), Total In=%.1f KB/s Out=%.1f KB/s"),
+		*NetDriver->GetName(), NetDriver->ClientConnections.Num(), TotalIn / 1024.f, TotalOut / 1024.f);
+
+	for (int32 i = 0; i < NetDriver->ClientConnections.Num(); ++i)
+	{
+		LogConnection(NetDriver->ClientConnections[i], i);
+	}
+}
+
+void UMechaNetStatsSubsystem::LogConnection(const UNetConnection* Connection, int32 Index)
+{
+	if (!Connection) return;
+
+	const APlayerController* PC = Connection->PlayerController;
+
+	UE_LOG(LogMecha, Log, TEXT("  [%d] %s (%s): In=%.1f KB/s Out=%.1f KB/s Ping=%.0f ms Loss In=%.1f%% Out=%.1f%%"),
+		Index,
+		*Connection->LowLevelGetRemoteAddress(true),
+		*GetNameSafe(PC),
+		Connection->InBytesPerSecond / 1024.f,
+		Connection->OutBytesPerSecond / 1024.f,
+		Connection->AvgLag * 1000.f,
+		Connection->GetInLossPercentage().GetAvgLossPercentage() * 100.f,
+		Connection->GetOutLossPercentage().GetAvgLossPercentage() * 100.f);
+}
@@ -0,0 +1,39 @@
+// MechaNetStatsSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+// 설명:
+// - 연결(클라이언트)별 대역폭 리포트. 서버에서는 모든 클라이언트 연결, 클라이언트에서는 서버 연결을 출력합니다.
+// - 콘솔: Mecha.Net.Bandwidth (한 번 출력)
+//         Mecha.Net.BandwidthLogInterval <초> (0보다 크면 주기적으로 로그, 기본 0)
+// - 루프백 테스트:
+//   서버    UnrealEditor Project_Mecha.uproject /Game/Main/StartMap -server -log -port=7777
+//   클라    UnrealEditor Project_Mecha.uproject 127.0.0.1:7777 -game -log -windowed -resx=960 -resy=540  (여러 개 실행)
+//   에디터에서는 Play Net Mode = Play As Client, Number of Players = N 으로도 확인할 수 있습니다.
+#include "MechaNetStatsSubsystem.generated.h"
+
+class UNetConnection;
+
+UCLASS()
+class PROJECT_MECHA_API UMechaNetStatsSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    static UMechaNetStatsSubsystem* Get(const UObject* WorldContextObject);
+
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // 연결별 In/Out 바이트/초, 핑, 패킷 손실을 로그로 출력
+    void DumpBandwidth() const;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    float TimeSinceLastLog = 0.f;
+
+    static void LogConnection(const UNetConnection* Connection, int32 Index);
+};
@@ -0,0 +1,94 @@
+// MechaNumericText.cpp
+// HUD 숫자 텍스트 캐시 - 정수/비율 FText 재사용, 값이 바뀔 때만 SetText
+
+#include "MechaNumericText.h"
+
+#include "Components/TextBlock.h"
+
+namespace MechaNumericText
+{
+	// 탄약/체력 범위를 덮는 크기
+	static constexpr int32 NumberCacheSize = 4096;
+	static constexpr int32 MaxRatioEntries = 8192;
+
+	static TArray<FText> Numbers;
+	static TArray<bool> NumberBuilt;
+	static TMap<uint64, FText> Ratios;
+
+	static uint64 MakeRatioKey(int32 Value, int32 Max)
+	{
+		return ((uint64)(uint32)Max << 32) | (uint64)(uint32)Value;
+	}
+}
+
+// ========================================
+// 캐시
+// ========================================
+FText FMechaNumericTextCache::Number(int32 Value)
+{
+	using namespace MechaNumericText;
+
+	if (Value < 0 || Value >= NumberCacheSize)
+	{
+		return FText::AsNumber(Value);
+	}
+
+	if (Numbers.Num() == 0)
+	{
+		Numbers.SetNum(NumberCacheSize);
+		NumberBuilt.Init(false, NumberCacheSize);
+	}
+
+	if (!NumberBuilt[Value])
+	{
+		Numbers[Value] = FText::AsNumber(Value);
+		NumberBuilt[Value] = true;
+	}
+	return Numbers[Value];
+}
+
+FText FMechaNumericTextCache::Ratio(int32 Value, int32 Max)
+{
+	using namespace MechaNumericText;
+
+	const uint64 Key = MakeRatioKey(Value, Max);
+	if (const FText* Cached = Ratios.Find(Key))
+	{
+		return *Cached;
+	}
+
+	FText Text = FText::FromString(FString::Printf(TEXT("%d / %d"), Value, Max));
+	if (Ratios.Num() < MaxRatioEntries)
+	{
+		Ratios.Add(Key, Text);
+	}
+	return Text;
+}
+
+// ========================================
+// 텍스트 블록 슬롯
+// ========================================
+void FMechaNumericText::SetRatio(UTextBlock* TextBlock, int32 Value, int32 Max)
+{
+	if (!TextBlock || (bHasValue && LastValue == Value && LastMax == Max))
+	{
+		return;
+	}
+
+	TextBlock->SetText(FMechaNumericTextCache::Ratio(Value, Max));
+	LastValue = Value;
+	LastMax = Max;
+	bHasValue = true;
+}
+
+void FMechaNumericText::SetNumber(UTextBlock* TextBlock, int32 Value)
+{
+	if (!TextBlock || (bHasValue && LastValue == Value))
+	{
+		return;
+	}
+
+	TextBlock->SetText(FMechaNumericTextCache::Number(Value));
+	LastValue = Value;
+	bHasValue = true;
+}
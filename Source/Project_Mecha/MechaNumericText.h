@@ -0,0 +1,36 @@
+// MechaNumericText.h
+#pragma once
+
+#include "CoreMinimal.h"
+// 설명:
+// - HUD 숫자 표시용 텍스트 캐시. "%d / %d" Printf + FText::FromString을 값이 바뀔 때마다 만들지 않고
+//   한 번 만든 FText를 재사용합니다 (게임 스레드 전용).
+//   - Number(값) : FText::AsNumber 결과를 0 ~ NumberCacheSize-1 범위에서 캐시
+//   - Ratio(값, 최대) : "값 / 최대" 를 (값, 최대) 쌍으로 캐시, 항목 수 상한 초과 시 캐시 없이 생성
+// - FMechaNumericText는 텍스트 블록 하나에 붙는 슬롯으로, 반올림한 정수가 바뀔 때만 SetText를 호출합니다.
+// - 숫자 구분자 등 문화권 포맷은 처음 만들 때 기준입니다.
+
+class UTextBlock;
+
+struct PROJECT_MECHA_API FMechaNumericTextCache
+{
+    static FText Number(int32 Value);
+    static FText Ratio(int32 Value, int32 Max);
+};
+
+struct PROJECT_MECHA_API FMechaNumericText
+{
+    // "Value / Max"
+    void SetRatio(UTextBlock* TextBlock, int32 Value, int32 Max);
+
+    // FText::AsNumber(Value)
+    void SetNumber(UTextBlock* TextBlock, int32 Value);
+
+    // 다음 Set*에서 무조건 다시 씀 (위젯 재생성 등)
+    void Invalidate() { bHasValue = false; }
+
+private:
+    int32 LastValue = 0;
+    int32 LastMax = 0;
+    bool bHasValue = false;
+};
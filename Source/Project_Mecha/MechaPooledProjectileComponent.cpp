@@ -0,0 +1,180 @@
+// MechaPooledProjectileComponent.cpp
+// 풀 소속 투사체의 충돌/수명 만료를 감지해 풀로 반납하는 컴포넌트
+
+#include "MechaPooledProjectileComponent.h"
+#include "MechaProjectilePoolSubsystem.h"
+#include "MechaCrowdSubsystem.h"
+
+#include "GameFramework/Actor.h"
+#include "GameFramework/ProjectileMovementComponent.h"
+#include "TimerManager.h"
+#include "Engine/World.h"
+
+// ========================================
+// 생성자
+// ========================================
+UMechaPooledProjectileComponent::UMechaPooledProjectileComponent()
+{
+	// 이벤트 기반. 군중 판정이 있는 발사만 이동 이후에 틱
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+	PrimaryComponentTick.TickGroup = TG_PostPhysics;
+}
+
+// ========================================
+// 풀로 반납
+// ========================================
+void UMechaPooledProjectileComponent::ReturnToPool()
+{
+	AActor* Owner = GetOwner();
+	if (!Owner) return;
+
+	if (UMechaProjectilePoolSubsystem* Pool = OwningPool.Get())
+	{
+		Pool->ReleaseProjectile(Owner);
+	}
+	else
+	{
+		// 풀이 사라졌으면 일반 투사체처럼 파괴
+		Owner->Destroy();
+	}
+}
+
+// ========================================
+// 군중 데미지 설정 / 이동 구간 판정
+// ========================================
+void UMechaPooledProjectileComponent::SetCrowdDamage(float Damage, float SplashRadius)
+{
+	AActor* Owner = GetOwner();
+	if (!Owner || !bInUse || Damage <= 0.f || !UMechaCrowdSubsystem::Get(this))
+	{
+		ClearCrowdDamage();
+		return;
+	}
+
+	CrowdDamage = Damage;
+	CrowdSplashRadius = SplashRadius;
+	LastCrowdLocation = Owner->GetActorLocation();
+	SetComponentTickEnabled(true);
+}
+
+void UMechaPooledProjectileComponent::ClearCrowdDamage()
+{
+	CrowdDamage = 0.f;
+	CrowdSplashRadius = 0.f;
+	SetComponentTickEnabled(false);
+}
+
+bool UMechaPooledProjectileComponent::SweepCrowd(const FVector& End, FVector& OutHitLocation)
+{
+	UMechaCrowdSubsystem* Crowd = UMechaCrowdSubsystem::Get(this);
+	if (!Crowd) return false;
+
+	// 범위 데미지는 멈춘 뒤 HandleProjectileStop에서 (맞은 개체 중복 방지)
+	const bool bHit = CrowdSplashRadius > 0.f
+		? Crowd->TraceAlongSegment(LastCrowdLocation, End, OutHitLocation)
+		: Crowd->ApplyDamageAlongSegment(LastCrowdLocation, End, CrowdDamage, OutHitLocation);
+
+	LastCrowdLocation = End;
+	return bHit;
+}
+
+void UMechaPooledProjectileComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	AActor* Owner = GetOwner();
+	if (!Owner || !bInUse || CrowdDamage <= 0.f)
+	{
+		ClearCrowdDamage();
+		return;
+	}
+
+	FVector HitLocation;
+	if (!SweepCrowd(Owner->GetActorLocation(), HitLocation)) return;
+
+	// 맞은 자리에서 멈춤 → OnProjectileStop (BP 착탄 연출 + HandleProjectileStop 반납)
+	const FVector Normal = -Owner->GetVelocity().GetSafeNormal();
+	Owner->SetActorLocation(HitLocation, false, nullptr, ETeleportType::TeleportPhysics);
+
+	UProjectileMovementComponent* Move = Owner->FindComponentByClass<UProjectileMovementComponent>();
+	if (Move && Move->UpdatedComponent)
+	{
+		bStoppingOnCrowd = true;
+		Move->StopSimulating(FHitResult(nullptr, nullptr, HitLocation, Normal));
+		bStoppingOnCrowd = false;
+	}
+	else
+	{
+		HandleProjectileStop(FHitResult(nullptr, nullptr, HitLocation, Normal));
+	}
+}
+
+// ========================================
+// ProjectileMovement 이벤트 바인딩
+// ========================================
+void UMechaPooledProjectileComponent::BindMovementEvents()
+{
+	AActor* Owner = GetOwner();
+	if (!Owner) return;
+
+	if (UProjectileMovementComponent* Move = Owner->FindComponentByClass<UProjectileMovementComponent>())
+	{
+		Move->OnProjectileStop.AddUniqueDynamic(this, &UMechaPooledProjectileComponent::HandleProjectileStop);
+	}
+}
+
+// ========================================
+// 충돌로 투사체가 멈췄을 때
+// ========================================
+void UMechaPooledProjectileComponent::HandleProjectileStop(const FHitResult& ImpactResult)
+{
+	if (!bInUse) return;
+
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	// 승격 전 군중 개체 (충돌체 없음)
+	if (CrowdDamage > 0.f)
+	{
+		// 벽/액터에 멈춘 경우 마지막 틱 이후 구간도 판정 (벽 바로 앞 개체)
+		FVector CrowdHitLocation;
+		if (!bStoppingOnCrowd)
+		{
+			SweepCrowd(ImpactResult.ImpactPoint, CrowdHitLocation);
+		}
+
+		if (CrowdSplashRadius > 0.f)
+		{
+			if (UMechaCrowdSubsystem* Crowd = UMechaCrowdSubsystem::Get(World))
+			{
+				Crowd->ApplyDamageInRadius(ImpactResult.ImpactPoint, CrowdSplashRadius, CrowdDamage);
+			}
+		}
+		ClearCrowdDamage();
+	}
+
+	// 같은 프레임의 BP 피격 처리(데미지/이펙트)가 끝난 뒤 반납
+	TWeakObjectPtr<UMechaPooledProjectileComponent> WeakThis(this);
+	World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateLambda([WeakThis]()
+		{
+			if (WeakThis.IsValid() && WeakThis->bInUse)
+			{
+				WeakThis->ReturnToPool();
+			}
+		}));
+}
+
+// ========================================
+// BP 등에서 액터가 직접 파괴된 경우 풀에서 제외
+// ========================================
+void UMechaPooledProjectileComponent::OnComponentDestroyed(bool bDestroyingHierarchy)
+{
+	if (UMechaProjectilePoolSubsystem* Pool = OwningPool.Get())
+	{
+		Pool->HandlePooledActorDestroyed(this);
+	}
+	OwningPool.Reset();
+
+	Super::OnComponentDestroyed(bDestroyingHierarchy);
+}
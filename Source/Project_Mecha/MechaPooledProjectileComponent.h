@@ -0,0 +1,79 @@
+// MechaPooledProjectileComponent.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+// 설명:
+// - 투사체 풀(UMechaProjectilePoolSubsystem)이 관리하는 액터에 자동으로 붙는 컴포넌트.
+// - 충돌(ProjectileMovement 정지)이나 수명 만료 시 액터를 파괴하지 않고 풀로 반납합니다.
+// - 블루프린트 투사체는 DestroyActor 대신 ReturnToPool을 호출하면 재사용됩니다.
+// - SetCrowdDamage로 설정하면 매 틱 이동 구간(이전 → 현재 위치)으로 승격 전 군중 개체(충돌체 없음)를 판정해서
+//   맞은 자리에서 투사체를 멈춥니다 (OnProjectileStop). SplashRadius > 0이면 멈춘 지점 범위 데미지, 아니면 맞은 개체만.
+//   발사마다 초기화되며 서버에서만 판정합니다.
+#include "MechaPooledProjectileComponent.generated.h"
+
+class UMechaProjectilePoolSubsystem;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnPooledProjectileEvent);
+
+UCLASS(ClassGroup = (Mecha), meta = (BlueprintSpawnableComponent))
+class PROJECT_MECHA_API UMechaPooledProjectileComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UMechaPooledProjectileComponent();
+
+    // 풀로 반납 (블루프린트에서 DestroyActor 대신 호출)
+    UFUNCTION(BlueprintCallable, Category = "Mecha|Pool")
+    void ReturnToPool();
+
+    // 현재 발사되어 사용 중인지
+    UFUNCTION(BlueprintPure, Category = "Mecha|Pool")
+    bool IsInUse() const { return bInUse; }
+
+    // 이번 발사의 군중 데미지 (충돌체가 없는 승격 전 군중 개체용)
+    UFUNCTION(BlueprintCallable, Category = "Mecha|Pool")
+    void SetCrowdDamage(float Damage, float SplashRadius);
+
+    // 풀에서 꺼내져 다시 활성화될 때 (BP 상태 리셋용)
+    UPROPERTY(BlueprintAssignable, Category = "Mecha|Pool")
+    FOnPooledProjectileEvent OnPoolActivated;
+
+    // 풀로 돌아가 비활성화될 때
+    UPROPERTY(BlueprintAssignable, Category = "Mecha|Pool")
+    FOnPooledProjectileEvent OnPoolDeactivated;
+
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+protected:
+    virtual void OnComponentDestroyed(bool bDestroyingHierarchy) override;
+
+    // ProjectileMovement 정지(충돌) 콜백
+    UFUNCTION()
+    void HandleProjectileStop(const FHitResult& ImpactResult);
+
+private:
+    friend class UMechaProjectilePoolSubsystem;
+
+    // 소속 풀 정보
+    TWeakObjectPtr<UMechaProjectilePoolSubsystem> OwningPool;
+    const UClass* PoolClass = nullptr;
+
+    bool bInUse = false;
+
+    // 군중 판정 (CrowdDamage > 0일 때만 틱)
+    float CrowdDamage = 0.f;
+    float CrowdSplashRadius = 0.f;
+    FVector LastCrowdLocation = FVector::ZeroVector;
+    bool bStoppingOnCrowd = false;
+
+    // LastCrowdLocation → End 구간에 군중 개체가 있으면 데미지 처리 후 맞은 위치 반환
+    bool SweepCrowd(const FVector& End, FVector& OutHitLocation);
+    void ClearCrowdDamage();
+
+    // 수명 만료 타이머
+    FTimerHandle LifetimeTimerHandle;
+
+    void BindMovementEvents();
+};
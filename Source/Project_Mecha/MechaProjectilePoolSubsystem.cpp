@@ -0,0 +1,470 @@
+// MechaProjectilePoolSubsystem.cpp
+// 투사체 액터 풀 - 미리 스폰, 재사용 시 상태 리셋, 충돌/수명 만료 시 반납, 통계 집계
+
+#include "MechaProjectilePoolSubsystem.h"
+#include "MechaStats.h"
+#include "MechaPooledProjectileComponent.h"
+#include "Project_Mecha.h"
+
+#include "GameFramework/Actor.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/ProjectileMovementComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Particles/ParticleSystemComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "TimerManager.h"
+
+// 콘솔 명령: 현재 월드의 풀 통계 출력
+static FAutoConsoleCommandWithWorld GMechaProjectilePoolDumpCmd(
+	TEXT("Mecha.ProjectilePool.Dump"),
+	TEXT("투사체 풀의 클래스별 Hit/Miss/High-water mark를 출력합니다."),
+	FConsoleCommandWithWorldDelegate::CreateStatic([](UWorld* World)
+		{
+			if (const UMechaProjectilePoolSubsystem* Pool = UMechaProjectilePoolSubsystem::Get(World))
+			{
+				Pool->DumpStats();
+			}
+		}));
+
+// ========================================
+// 접근자
+// ========================================
+UMechaProjectilePoolSubsystem* UMechaProjectilePoolSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine || !WorldContextObject) return nullptr;
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UMechaProjectilePoolSubsystem>() : nullptr;
+}
+
+bool UMechaProjectilePoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	// 게임/PIE 월드에서만 생성
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// ========================================
+// 레벨 시작 - 설정된 클래스 미리 채우기
+// ========================================
+void UMechaProjectilePoolSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	for (const FMechaProjectilePoolPrewarm& Entry : PrewarmClasses)
+	{
+		if (UClass* ProjectileClass = Entry.ProjectileClass.LoadSynchronous())
+		{
+			PrewarmPool(ProjectileClass, Entry.Count);
+		}
+	}
+}
+
+void UMechaProjectilePoolSubsystem::Deinitialize()
+{
+	// 액터 자체는 월드 정리 시 함께 파괴됨
+	Pools.Empty();
+
+	Super::Deinitialize();
+}
+
+// ========================================
+// 미리 채우기
+// ========================================
+void UMechaProjectilePoolSubsystem::PrewarmPool(TSubclassOf<AActor> ProjectileClass, int32 Count)
+{
+	if (!ProjectileClass || Count <= 0 || IsNetClient()) return;
+
+	FProjectilePool& Pool = FindOrAddPool(ProjectileClass);
+
+	// 이미 만들어진 개수(대기 + 사용 중)는 제외
+	const int32 Target = FMath::Min(Count, MaxPooledPerClass);
+	const int32 ToSpawn = Target - (Pool.Available.Num() + Pool.Stats.InUse);
+
+	for (int32 i = 0; i < ToSpawn; ++i)
+	{
+		AActor* Projectile = SpawnPooledActor(ProjectileClass, Pool, ParkingLocation, FRotator::ZeroRotator, nullptr, nullptr);
+		if (!Projectile) break;
+
+		DeactivatePooledActor(Projectile, Projectile->FindComponentByClass<UMechaPooledProjectileComponent>());
+		Pool.Available.Add(Projectile);
+	}
+
+	Pool.Stats.Available = Pool.Available.Num();
+}
+
+// ========================================
+// 풀에서 꺼내기
+// ========================================
+AActor* UMechaProjectilePoolSubsystem::AcquireProjectile(
+	TSubclassOf<AActor> ProjectileClass,
+	const FVector& Location,
+	const FRotator& Rotation,
+	AActor* InOwner,
+	APawn* InInstigator)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Mecha_PoolAcquire);
+
+	if (!ProjectileClass || IsNetClient()) return nullptr;
+
+	FProjectilePool& Pool = FindOrAddPool(ProjectileClass);
+
+	// 대기 목록에서 유효한 액터 찾기 (외부에서 파괴된 항목은 버림)
+	AActor* Projectile = nullptr;
+	while (Pool.Available.Num() > 0)
+	{
+		AActor* Candidate = Pool.Available.Pop(false).Get();
+		if (IsValid(Candidate) && !Candidate->IsActorBeingDestroyed())
+		{
+			Projectile = Candidate;
+			break;
+		}
+	}
+
+	if (Projectile)
+	{
+		++Pool.Stats.Hits;
+	}
+	else
+	{
+		// 풀이 비었으면 새로 스폰
+		++Pool.Stats.Misses;
+		Projectile = SpawnPooledActor(ProjectileClass, Pool, Location, Rotation, InOwner, InInstigator);
+		if (!Projectile) return nullptr;
+	}
+
+	ActivatePooledActor(Projectile, Pool, Location, Rotation, InOwner, InInstigator);
+
+	++Pool.Stats.InUse;
+	Pool.Stats.HighWaterMark = FMath::Max(Pool.Stats.HighWaterMark, Pool.Stats.InUse);
+	Pool.Stats.Available = Pool.Available.Num();
+
+	return Projectile;
+}
+
+// ========================================
+// 풀로 반납
+// ========================================
+void UMechaProjectilePoolSubsystem::ReleaseProjectile(AActor* Projectile)
+{
+	if (!IsValid(Projectile)) return;
+
+	UMechaPooledProjectileComponent* PoolComp = Projectile->FindComponentByClass<UMechaPooledProjectileComponent>();
+	FProjectilePool* Pool = (PoolComp && PoolComp->OwningPool.Get() == this) ? Pools.Find(PoolComp->PoolClass) : nullptr;
+
+	// 풀 소속이 아니면 일반 투사체처럼 파괴
+	if (!Pool)
+	{
+		Projectile->Destroy();
+		return;
+	}
+
+	// 이미 반납된 경우 무시 (충돌 + 수명 만료 중복 등)
+	if (!PoolComp->bInUse) return;
+
+	Pool->Stats.InUse = FMath::Max(0, Pool->Stats.InUse - 1);
+
+	// 보관 한도를 넘으면 파괴
+	if (Pool->Available.Num() >= MaxPooledPerClass)
+	{
+		PoolComp->bInUse = false;
+		Projectile->Destroy();
+		return;
+	}
+
+	DeactivatePooledActor(Projectile, PoolComp);
+	Pool->Available.Add(Projectile);
+	Pool->Stats.Available = Pool->Available.Num();
+}
+
+// ========================================
+// 통계
+// ========================================
+FMechaProjectilePoolStats UMechaProjectilePoolSubsystem::GetPoolStats(TSubclassOf<AActor> ProjectileClass) const
+{
+	const FProjectilePool* Pool = Pools.Find(ProjectileClass.Get());
+	return Pool ? Pool->Stats : FMechaProjectilePoolStats();
+}
+
+void UMechaProjectilePoolSubsystem::DumpStats() const
+{
+	UE_LOG(LogMecha, Log, TEXT("[ProjectilePool] %d class(es)"), Pools.Num());
+
+	for (const TPair<const UClass*, FProjectilePool>& Pair : Pools)
+	{
+		const FMechaProjectilePoolStats& Stats = Pair.Value.Stats;
+		UE_LOG(LogMecha, Log, TEXT("  %s: Hits=%d Misses=%d HighWater=%d InUse=%d Available=%d"),
+			*GetNameSafe(Pair.Key), Stats.Hits, Stats.Misses, Stats.HighWaterMark, Stats.InUse, Stats.Available);
+	}
+}
+
+// ========================================
+// 내부 - 풀 생성
+// ========================================
+UMechaProjectilePoolSubsystem::FProjectilePool& UMechaProjectilePoolSubsystem::FindOrAddPool(UClass* ProjectileClass)
+{
+	if (FProjectilePool* Existing = Pools.Find(ProjectileClass))
+	{
+		return *Existing;
+	}
+
+	FProjectilePool& Pool = Pools.Add(ProjectileClass);
+
+	// 클래스 기본 수명은 엔진 파괴 대신 풀 반납 타이머로 사용
+	if (const AActor* CDO = ProjectileClass->GetDefaultObject<AActor>())
+	{
+		Pool.LifeSpan = CDO->InitialLifeSpan;
+	}
+	return Pool;
+}
+
+// ========================================
+// 내부 - 새 액터 스폰 후 풀 컴포넌트 부착
+// ========================================
+AActor* UMechaProjectilePoolSubsystem::SpawnPooledActor(
+	UClass* ProjectileClass,
+	FProjectilePool& Pool,
+	const FVector& Location,
+	const FRotator& Rotation,
+	AActor* InOwner,
+	APawn* InInstigator)
+{
+	UWorld* World = GetWorld();
+	if (!World) return nullptr;
+
+	FActorSpawnParameters Params;
+	Params.Owner = InOwner;
+	Params.Instigator = InInstigator;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	AActor* Projectile = World->SpawnActor<AActor>(ProjectileClass, Location, Rotation, Params);
+	if (!Projectile) return nullptr;
+
+	// 엔진 수명 만료(Destroy)는 끄고 풀 타이머로 대체
+	Projectile->SetLifeSpan(0.f);
+
+	// 네트워크 세션: 서버 권한 투사체로 복제 (BP 클래스가 복제를 꺼 두었어도 강제)
+	if (World->GetNetMode() != NM_Standalone)
+	{
+		Projectile->SetReplicates(true);
+		Projectile->SetReplicateMovement(true);
+	}
+
+	// 최초 인스턴스의 이동 기본값 기록 (호출부에서 바꾼 값을 재사용 시 되돌리기 위함)
+	if (!Pool.MovementDefaults.bCaptured)
+	{
+		if (const UProjectileMovementComponent* Move = Projectile->FindComponentByClass<UProjectileMovementComponent>())
+		{
+			FMovementDefaults& Defaults = Pool.MovementDefaults;
+			Defaults.bIsHomingProjectile = Move->bIsHomingProjectile;
+			Defaults.bRotationFollowsVelocity = Move->bRotationFollowsVelocity;
+			Defaults.InitialSpeed = Move->InitialSpeed;
+			Defaults.MaxSpeed = Move->MaxSpeed;
+			Defaults.HomingAccelerationMagnitude = Move->HomingAccelerationMagnitude;
+			Defaults.ProjectileGravityScale = Move->ProjectileGravityScale;
+			Defaults.bCaptured = true;
+		}
+	}
+
+	UMechaPooledProjectileComponent* PoolComp = NewObject<UMechaPooledProjectileComponent>(Projectile, TEXT("MechaPooledProjectile"));
+	PoolComp->OwningPool = this;
+	PoolComp->PoolClass = ProjectileClass;
+	PoolComp->RegisterComponent();
+	PoolComp->BindMovementEvents();
+
+	return Projectile;
+}
+
+// ========================================
+// 내부 - 활성화 (위치/소유자/이동 상태 리셋)
+// ========================================
+void UMechaProjectilePoolSubsystem::ActivatePooledActor(
+	AActor* Projectile,
+	FProjectilePool& Pool,
+	const FVector& Location,
+	const FRotator& Rotation,
+	AActor* InOwner,
+	APawn* InInstigator)
+{
+	UMechaPooledProjectileComponent* PoolComp = Projectile->FindComponentByClass<UMechaPooledProjectileComponent>();
+	if (!PoolComp) return;
+
+	// 대기 중 휴면 상태였으면 깨워서 바로 복제
+	if (Projectile->GetIsReplicated())
+	{
+		Projectile->SetNetDormancy(DORM_Awake);
+	}
+
+	Projectile->SetOwner(InOwner);
+	Projectile->SetInstigator(InInstigator);
+	Projectile->SetActorLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::ResetPhysics);
+
+	Projectile->SetActorHiddenInGame(false);
+	Projectile->SetActorEnableCollision(true);
+	Projectile->SetActorTickEnabled(true);
+
+	// 이전 발사에서 추가된 충돌 무시 목록 초기화
+	UPrimitiveComponent* RootPrim = Cast<UPrimitiveComponent>(Projectile->GetRootComponent());
+	if (RootPrim)
+	{
+		RootPrim->ClearMoveIgnoreActors();
+		RootPrim->ClearMoveIgnoreComponents();
+	}
+
+	// ========== 이동 상태 리셋 ==========
+	if (UProjectileMovementComponent* Move = Projectile->FindComponentByClass<UProjectileMovementComponent>())
+	{
+		const FMovementDefaults& Defaults = Pool.MovementDefaults;
+		if (Defaults.bCaptured)
+		{
+			Move->bIsHomingProjectile = Defaults.bIsHomingProjectile;
+			Move->bRotationFollowsVelocity = Defaults.bRotationFollowsVelocity;
+			Move->InitialSpeed = Defaults.InitialSpeed;
+			Move->MaxSpeed = Defaults.MaxSpeed;
+			Move->HomingAccelerationMagnitude = Defaults.HomingAccelerationMagnitude;
+			Move->ProjectileGravityScale = Defaults.ProjectileGravityScale;
+		}
+		Move->HomingTargetComponent = nullptr;
+
+		// 충돌로 멈추면 UpdatedComponent가 해제되므로 다시 지정
+		Move->SetUpdatedComponent(Projectile->GetRootComponent());
+		Move->Velocity = Rotation.Vector() * Move->InitialSpeed;
+		Move->SetComponentTickEnabled(true);
+		Move->Activate(true);
+		Move->UpdateComponentVelocity();
+	}
+
+	// 트레일 등 파티클 재시작
+	TArray<UFXSystemComponent*> FXComps;
+	Projectile->GetComponents<UFXSystemComponent>(FXComps);
+	for (UFXSystemComponent* FX : FXComps)
+	{
+		if (FX && FX->bAutoActivate)
+		{
+			FX->Activate(true);
+		}
+	}
+
+	PoolComp->bInUse = true;
+	PoolComp->ClearCrowdDamage();
+
+	// ========== 수명 만료 시 반납 ==========
+	if (Pool.LifeSpan > 0.f)
+	{
+		TWeakObjectPtr<UMechaPooledProjectileComponent> WeakComp(PoolComp);
+		Projectile->GetWorldTimerManager().SetTimer(
+			PoolComp->LifetimeTimerHandle,
+			FTimerDelegate::CreateLambda([WeakComp]()
+				{
+					if (WeakComp.IsValid())
+					{
+						WeakComp->ReturnToPool();
+					}
+				}),
+			Pool.LifeSpan,
+			false
+		);
+	}
+
+	PoolComp->OnPoolActivated.Broadcast();
+
+	if (Projectile->GetIsReplicated())
+	{
+		Projectile->ForceNetUpdate();
+	}
+}
+
+// ========================================
+// 내부 - 비활성화 (숨김/충돌 해제/이동 정지)
+// ========================================
+void UMechaProjectilePoolSubsystem::DeactivatePooledActor(AActor* Projectile, UMechaPooledProjectileComponent* PoolComp)
+{
+	if (!Projectile) return;
+
+	if (PoolComp)
+	{
+		PoolComp->bInUse = false;
+		PoolComp->ClearCrowdDamage();
+		Projectile->GetWorldTimerManager().ClearTimer(PoolComp->LifetimeTimerHandle);
+		PoolComp->OnPoolDeactivated.Broadcast();
+	}
+
+	if (UProjectileMovementComponent* Move = Projectile->FindComponentByClass<UProjectileMovementComponent>())
+	{
+		Move->StopMovementImmediately();
+		Move->HomingTargetComponent = nullptr;
+		Move->SetComponentTickEnabled(false);
+		Move->Deactivate();
+	}
+
+	TArray<UFXSystemComponent*> FXComps;
+	Projectile->GetComponents<UFXSystemComponent>(FXComps);
+	for (UFXSystemComponent* FX : FXComps)
+	{
+		if (FX)
+		{
+			FX->DeactivateImmediate();
+		}
+	}
+
+	// 발사 쪽에서 건 상호 무시 해제 (상대 컴포넌트 목록에 남으면 오너가 이 투사체를 계속 무시하고 목록이 쌓임)
+	if (UPrimitiveComponent* RootPrim = Cast<UPrimitiveComponent>(Projectile->GetRootComponent()))
+	{
+		for (UPrimitiveComponent* IgnoredComp : RootPrim->GetMoveIgnoreComponents())
+		{
+			if (IgnoredComp)
+			{
+				IgnoredComp->IgnoreComponentWhenMoving(RootPrim, false);
+			}
+		}
+		RootPrim->ClearMoveIgnoreActors();
+		RootPrim->ClearMoveIgnoreComponents();
+	}
+
+	Projectile->SetActorHiddenInGame(true);
+	Projectile->SetActorEnableCollision(false);
+	Projectile->SetActorTickEnabled(false);
+	Projectile->SetActorLocation(ParkingLocation, false, nullptr, ETeleportType::ResetPhysics);
+	Projectile->SetOwner(nullptr);
+	Projectile->SetInstigator(nullptr);
+
+	// 숨김 상태까지 보낸 뒤 휴면 (대기 중에는 복제 비용 없음)
+	if (Projectile->GetIsReplicated())
+	{
+		Projectile->SetNetDormancy(DORM_DormantAll);
+	}
+}
+
+bool UMechaProjectilePoolSubsystem::IsNetClient() const
+{
+	const UWorld* World = GetWorld();
+	return World && World->GetNetMode() == NM_Client;
+}
+
+// ========================================
+// 내부 - 풀 액터가 외부에서 파괴됨
+// ========================================
+void UMechaProjectilePoolSubsystem::HandlePooledActorDestroyed(UMechaPooledProjectileComponent* PoolComp)
+{
+	if (!PoolComp) return;
+
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(PoolComp->LifetimeTimerHandle);
+	}
+
+	FProjectilePool* Pool = Pools.Find(PoolComp->PoolClass);
+	if (!Pool) return;
+
+	if (PoolComp->bInUse)
+	{
+		PoolComp->bInUse = false;
+		Pool->Stats.InUse = FMath::Max(0, Pool->Stats.InUse - 1);
+	}
+	else
+	{
+		Pool->Available.RemoveSwap(PoolComp->GetOwner());
+		Pool->Stats.Available = Pool->Available.Num();
+	}
+}
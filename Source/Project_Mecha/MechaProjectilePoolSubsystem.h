@@ -0,0 +1,139 @@
+// MechaProjectilePoolSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+// 설명:
+// - 투사체(총알/미사일) 액터 풀. 레벨 시작 시 클래스별로 N개를 미리 스폰해 두고,
+//   발사 시 꺼내서 위치/속도/유도 상태를 리셋 후 활성화합니다.
+// - 충돌(ProjectileMovement 정지) 또는 수명 만료 시 파괴 대신 풀로 반납됩니다.
+// - 클래스별 Hit/Miss/최대 동시 사용 수(High-water mark)를 집계합니다.
+//   콘솔: Mecha.ProjectilePool.Dump
+// - 네트워크 세션에서는 서버만 풀을 가지며, 풀 액터를 복제(이동 포함)하고
+//   대기 중에는 DORM_DormantAll로 재워 대역폭을 쓰지 않게 합니다. 클라이언트는 복제된 액터만 받습니다.
+#include "MechaProjectilePoolSubsystem.generated.h"
+
+class UMechaPooledProjectileComponent;
+
+// 클래스별 풀 통계
+USTRUCT(BlueprintType)
+struct FMechaProjectilePoolStats
+{
+    GENERATED_BODY()
+
+    // 풀에서 바로 꺼내 쓴 횟수
+    UPROPERTY(BlueprintReadOnly, Category = "Mecha|Pool")
+    int32 Hits = 0;
+
+    // 풀이 비어 새로 스폰한 횟수
+    UPROPERTY(BlueprintReadOnly, Category = "Mecha|Pool")
+    int32 Misses = 0;
+
+    // 동시에 사용된 최대 개수
+    UPROPERTY(BlueprintReadOnly, Category = "Mecha|Pool")
+    int32 HighWaterMark = 0;
+
+    // 현재 사용 중인 개수
+    UPROPERTY(BlueprintReadOnly, Category = "Mecha|Pool")
+    int32 InUse = 0;
+
+    // 대기 중인 개수
+    UPROPERTY(BlueprintReadOnly, Category = "Mecha|Pool")
+    int32 Available = 0;
+};
+
+// 레벨 시작 시 미리 채워 둘 클래스 (DefaultGame.ini)
+USTRUCT()
+struct FMechaProjectilePoolPrewarm
+{
+    GENERATED_BODY()
+
+    UPROPERTY(Config)
+    TSoftClassPtr<AActor> ProjectileClass;
+
+    UPROPERTY(Config)
+    int32 Count = 0;
+};
+
+UCLASS(Config = Game)
+class PROJECT_MECHA_API UMechaProjectilePoolSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    static UMechaProjectilePoolSubsystem* Get(const UObject* WorldContextObject);
+
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Deinitialize() override;
+
+    // 클래스별 풀을 Count개까지 미리 채움 (이미 있는 만큼은 건너뜀)
+    UFUNCTION(BlueprintCallable, Category = "Mecha|Pool")
+    void PrewarmPool(TSubclassOf<AActor> ProjectileClass, int32 Count);
+
+    // 풀에서 투사체를 꺼내 지정 위치/회전으로 활성화 (없으면 새로 스폰)
+    // - ProjectileMovement 속도는 Rotation 방향 * InitialSpeed 로 리셋됩니다.
+    UFUNCTION(BlueprintCallable, Category = "Mecha|Pool")
+    AActor* AcquireProjectile(TSubclassOf<AActor> ProjectileClass, const FVector& Location, const FRotator& Rotation,
+        AActor* InOwner, APawn* InInstigator);
+
+    // 투사체를 풀로 반납 (풀 소속이 아니면 파괴)
+    UFUNCTION(BlueprintCallable, Category = "Mecha|Pool")
+    void ReleaseProjectile(AActor* Projectile);
+
+    UFUNCTION(BlueprintPure, Category = "Mecha|Pool")
+    FMechaProjectilePoolStats GetPoolStats(TSubclassOf<AActor> ProjectileClass) const;
+
+    // 전체 풀 통계를 로그로 출력
+    void DumpStats() const;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+    // 레벨 시작 시 미리 채울 클래스 목록
+    UPROPERTY(Config)
+    TArray<FMechaProjectilePoolPrewarm> PrewarmClasses;
+
+    // 클래스별 최대 보관 개수 (초과분은 반납 시 파괴)
+    UPROPERTY(Config)
+    int32 MaxPooledPerClass = 128;
+
+    // 대기 중인 투사체를 숨겨 둘 위치
+    UPROPERTY(Config)
+    FVector ParkingLocation = FVector(0.f, 0.f, -100000.f);
+
+private:
+    // 최초 스폰 시점의 ProjectileMovement 기본값 (재사용 시 리셋용)
+    struct FMovementDefaults
+    {
+        bool bCaptured = false;
+        bool bIsHomingProjectile = false;
+        bool bRotationFollowsVelocity = false;
+        float InitialSpeed = 0.f;
+        float MaxSpeed = 0.f;
+        float HomingAccelerationMagnitude = 0.f;
+        float ProjectileGravityScale = 1.f;
+    };
+
+    struct FProjectilePool
+    {
+        TArray<TWeakObjectPtr<AActor>> Available;
+        FMovementDefaults MovementDefaults;
+        float LifeSpan = 0.f;
+        FMechaProjectilePoolStats Stats;
+    };
+
+    TMap<const UClass*, FProjectilePool> Pools;
+
+    FProjectilePool& FindOrAddPool(UClass* ProjectileClass);
+    AActor* SpawnPooledActor(UClass* ProjectileClass, FProjectilePool& Pool, const FVector& Location, const FRotator& Rotation,
+        AActor* InOwner, APawn* InInstigator);
+    void ActivatePooledActor(AActor* Projectile, FProjectilePool& Pool, const FVector& Location, const FRotator& Rotation,
+        AActor* InOwner, APawn* InInstigator);
+    void DeactivatePooledActor(AActor* Projectile, UMechaPooledProjectileComponent* PoolComp);
+
+    // 클라이언트 월드면 풀을 쓰지 않음 (투사체는 서버가 스폰해 복제)
+    bool IsNetClient() const;
+
+    friend class UMechaPooledProjectileComponent;
+    void HandlePooledActorDestroyed(UMechaPooledProjectileComponent* PoolComp);
+};
@@ -0,0 +1,442 @@
+// MechaProjectileSimSubsystem.cpp
+// SoA 기반 투사체 일괄 시뮬레이션 - 유도 이동, 충돌, 데미지, ISM 프록시 렌더링
+
+#include "MechaProjectileSimSubsystem.h"
+#include "MechaStats.h"
+
+#include "EnemyMecha.h"
+#include "MechaCharacterBase.h"
+#include "MechaHomingKernel.h"
+#include "MechaFXPoolSubsystem.h"
+#include "MechaCrowdSubsystem.h"
+
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemBlueprintLibrary.h"
+#include "GameplayEffect.h"
+
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/SceneComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Kismet/GameplayStatics.h"
+#include "HAL/IConsoleManager.h"
+
+// 유도 이동 커널 선택 (1: SIMD, 0: 스칼라)
+static TAutoConsoleVariable<int32> CVarMechaProjectileSimUseSIMD(
+	TEXT("Mecha.ProjectileSim.UseSIMD"),
+	1,
+	TEXT("1이면 ProjectileSim 유도 이동을 SIMD 커널로, 0이면 스칼라 커널로 처리합니다."));
+
+// ========================================
+// 접근자
+// ========================================
+UMechaProjectileSimSubsystem* UMechaProjectileSimSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine || !WorldContextObject) return nullptr;
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UMechaProjectileSimSubsystem>() : nullptr;
+}
+
+bool UMechaProjectileSimSubsystem::IsSimulationAllowed(const UObject* WorldContextObject)
+{
+	if (!GEngine || !WorldContextObject) return false;
+
+	const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World && World->GetNetMode() == NM_Standalone;
+}
+
+bool UMechaProjectileSimSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UMechaProjectileSimSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMechaProjectileSimSubsystem, STATGROUP_Tickables);
+}
+
+void UMechaProjectileSimSubsystem::Deinitialize()
+{
+	for (TArray<float>* Stream : { &PosX, &PosY, &PosZ, &VelX, &VelY, &VelZ, &HomingAccels, &MaxSpeeds, &LifeRemaining })
+	{
+		Stream->Empty();
+	}
+	HomingTargets.Empty();
+	ArchetypeIndices.Empty();
+	Sources.Empty();
+	DamageSpecs.Empty();
+
+	ProxyComponents.Empty();
+	ProxyHost = nullptr;
+
+	Super::Deinitialize();
+}
+
+// ========================================
+// 투사체 발사
+// ========================================
+bool UMechaProjectileSimSubsystem::SpawnProjectile(
+	const FMechaSimProjectileArchetype& Archetype,
+	const FVector& Location,
+	const FVector& Direction,
+	AActor* HomingTarget,
+	AActor* Source,
+	const FMechaSimDamageSpec& DamageSpec)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Mecha_SimSpawn);
+
+	if (PosX.Num() >= MaxProjectiles) return false;
+
+	const int32 ArchetypeIndex = FindOrAddArchetype(Archetype);
+	const FVector Velocity = Direction.GetSafeNormal() * Archetype.InitialSpeed;
+
+	// 모든 버퍼에 같은 인덱스로 추가
+	PosX.Add(Location.X);
+	PosY.Add(Location.Y);
+	PosZ.Add(Location.Z);
+	VelX.Add(Velocity.X);
+	VelY.Add(Velocity.Y);
+	VelZ.Add(Velocity.Z);
+	HomingAccels.Add(Archetype.HomingAcceleration);
+	MaxSpeeds.Add(Archetype.MaxSpeed);
+	HomingTargets.Add((HomingTarget && Archetype.HomingAcceleration > 0.f) ? HomingTarget->GetRootComponent() : nullptr);
+	LifeRemaining.Add(Archetype.LifeSpan);
+	ArchetypeIndices.Add(ArchetypeIndex);
+	Sources.Add(Source);
+	DamageSpecs.Add(DamageSpec);
+
+	return true;
+}
+
+// ========================================
+// 프레임 업데이트 (모든 투사체 일괄 처리)
+// ========================================
+void UMechaProjectileSimSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (PosX.Num() == 0 || DeltaTime <= 0.f)
+	{
+		return;
+	}
+
+	// 충돌 검사용 이전 위치 보관
+	PrevX = PosX;
+	PrevY = PosY;
+	PrevZ = PosZ;
+
+	IntegrateMotion(DeltaTime);
+	ResolveCollisions(DeltaTime);
+	RemovePending();
+	UpdateProxies();
+}
+
+// ========================================
+// 이동 적분 - 타겟 위치 수집 후 FMechaHomingKernel로 일괄 처리
+// ========================================
+void UMechaProjectileSimSubsystem::IntegrateMotion(float DeltaTime)
+{
+	const int32 Num = PosX.Num();
+
+	for (TArray<float>* Stream : { &TargetX, &TargetY, &TargetZ, &FrameHomingAccels, &DirX, &DirY, &DirZ })
+	{
+		Stream->SetNumUninitialized(Num, false);
+	}
+
+	// 타겟 위치 수집 (타겟이 사라진 투사체는 이번 프레임 유도 없음)
+	for (int32 i = 0; i < Num; ++i)
+	{
+		if (const USceneComponent* Target = HomingTargets[i].Get())
+		{
+			const FVector TargetLoc = Target->GetComponentLocation();
+			TargetX[i] = TargetLoc.X;
+			TargetY[i] = TargetLoc.Y;
+			TargetZ[i] = TargetLoc.Z;
+			FrameHomingAccels[i] = HomingAccels[i];
+		}
+		else
+		{
+			TargetX[i] = PosX[i];
+			TargetY[i] = PosY[i];
+			TargetZ[i] = PosZ[i];
+			FrameHomingAccels[i] = 0.f;
+		}
+	}
+
+	FMechaHomingStreams Streams;
+	Streams.PosX = PosX.GetData();
+	Streams.PosY = PosY.GetData();
+	Streams.PosZ = PosZ.GetData();
+	Streams.VelX = VelX.GetData();
+	Streams.VelY = VelY.GetData();
+	Streams.VelZ = VelZ.GetData();
+	Streams.TargetX = TargetX.GetData();
+	Streams.TargetY = TargetY.GetData();
+	Streams.TargetZ = TargetZ.GetData();
+	Streams.HomingAccel = FrameHomingAccels.GetData();
+	Streams.MaxSpeed = MaxSpeeds.GetData();
+	Streams.DirX = DirX.GetData();
+	Streams.DirY = DirY.GetData();
+	Streams.DirZ = DirZ.GetData();
+	Streams.Num = Num;
+
+	if (CVarMechaProjectileSimUseSIMD.GetValueOnGameThread() != 0)
+	{
+		FMechaHomingKernel::IntegrateSIMD(Streams, DeltaTime);
+	}
+	else
+	{
+		FMechaHomingKernel::IntegrateScalar(Streams, DeltaTime);
+	}
+}
+
+// ========================================
+// 충돌 / 수명 처리
+// ========================================
+void UMechaProjectileSimSubsystem::ResolveCollisions(float DeltaTime)
+{
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	PendingRemoval.Reset();
+
+	UMechaCrowdSubsystem* Crowd = UMechaCrowdSubsystem::Get(World);
+
+	const int32 Num = PosX.Num();
+	for (int32 i = 0; i < Num; ++i)
+	{
+		LifeRemaining[i] -= DeltaTime;
+
+		const FMechaSimProjectileArchetype& Arch = Archetypes[ArchetypeIndices[i]];
+
+		// 이전 위치 → 현재 위치 구간 스윕
+		FCollisionQueryParams Params(SCENE_QUERY_STAT(MechaSimProjectile), false, Sources[i].Get());
+
+		FHitResult Hit;
+		const bool bHit = World->SweepSingleByChannel(
+			Hit,
+			FVector(PrevX[i], PrevY[i], PrevZ[i]),
+			FVector(PosX[i], PosY[i], PosZ[i]),
+			FQuat::Identity,
+			Arch.CollisionChannel,
+			FCollisionShape::MakeSphere(Arch.CollisionRadius),
+			Params
+		);
+
+		// 플레이어 투사체는 충돌체가 없는 승격 전 군중 개체도 판정 (벽에 막히기 전 구간만)
+		const AActor* SourceActor = Sources[i].Get();
+		if (Crowd && SourceActor && !SourceActor->ActorHasTag(TEXT("Enemy")))
+		{
+			const FVector SegmentStart(PrevX[i], PrevY[i], PrevZ[i]);
+			const FVector SegmentEnd = bHit ? Hit.Location : FVector(PosX[i], PosY[i], PosZ[i]);
+
+			FVector CrowdHitLocation;
+			if (Crowd->ApplyDamageAlongSegment(SegmentStart, SegmentEnd, DamageSpecs[i].Damage, CrowdHitLocation))
+			{
+				const FVector Normal = (SegmentStart - SegmentEnd).GetSafeNormal();
+				ApplyImpact(i, FHitResult(nullptr, nullptr, CrowdHitLocation, Normal));
+				PendingRemoval.Add(i);
+				continue;
+			}
+		}
+
+		if (bHit)
+		{
+			ApplyImpact(i, Hit);
+			PendingRemoval.Add(i);
+		}
+		else if (LifeRemaining[i] <= 0.f)
+		{
+			PendingRemoval.Add(i);
+		}
+	}
+}
+
+// ========================================
+// 명중 처리 - 데미지, 히트 리액션, 이펙트
+// ========================================
+void UMechaProjectileSimSubsystem::ApplyImpact(int32 Index, const FHitResult& Hit)
+{
+	UWorld* World = GetWorld();
+	const FMechaSimProjectileArchetype& Arch = Archetypes[ArchetypeIndices[Index]];
+	const FMechaSimDamageSpec& Spec = DamageSpecs[Index];
+
+	AActor* SourceActor = Sources[Index].Get();
+	AActor* HitActor = Hit.GetActor();
+
+	// 같은 편(Enemy 태그끼리)은 데미지 없음
+	const bool bFriendly = SourceActor && HitActor
+		&& SourceActor->ActorHasTag(TEXT("Enemy")) && HitActor->ActorHasTag(TEXT("Enemy"));
+
+	if (HitActor && !bFriendly && Spec.DamageEffect)
+	{
+		UAbilitySystemComponent* TargetASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(HitActor);
+		UAbilitySystemComponent* SourceASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(SourceActor);
+
+		if (TargetASC)
+		{
+			FGameplayEffectContextHandle Ctx = SourceASC ? SourceASC->MakeEffectContext() : TargetASC->MakeEffectContext();
+			Ctx.AddSourceObject(SourceActor);
+			Ctx.AddHitResult(Hit);
+
+			FGameplayEffectSpecHandle SpecHandle = (SourceASC ? SourceASC : TargetASC)->MakeOutgoingSpec(Spec.DamageEffect, 1.f, Ctx);
+			if (SpecHandle.IsValid())
+			{
+				if (Spec.SetByCallerTag.IsValid())
+				{
+					SpecHandle.Data->SetSetByCallerMagnitude(Spec.SetByCallerTag, Spec.Damage);
+				}
+				TargetASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
+			}
+		}
+
+		// 히트 리액션
+		if (AEnemyMecha* Enemy = Cast<AEnemyMecha>(HitActor))
+		{
+			Enemy->PlayHitReact();
+		}
+		else if (AMechaCharacterBase* Mecha = Cast<AMechaCharacterBase>(HitActor))
+		{
+			Mecha->PlayHitReactFromDirection(Hit.ImpactPoint);
+		}
+	}
+
+	if (Arch.ImpactEffect)
+	{
+		UMechaFXPoolSubsystem::SpawnFXAtLocation(World, Arch.ImpactEffect, Hit.ImpactPoint, Hit.ImpactNormal.Rotation());
+	}
+	if (Arch.ImpactSound)
+	{
+		UGameplayStatics::PlaySoundAtLocation(World, Arch.ImpactSound, Hit.ImpactPoint);
+	}
+}
+
+// ========================================
+// 제거 예정 투사체 정리 (뒤에서부터 Swap 제거)
+// ========================================
+void UMechaProjectileSimSubsystem::RemovePending()
+{
+	// ResolveCollisions에서 오름차순으로 쌓였으므로 역순으로 제거하면 인덱스가 유지됨
+	for (int32 k = PendingRemoval.Num() - 1; k >= 0; --k)
+	{
+		const int32 i = PendingRemoval[k];
+
+		// 프록시 회전에 쓰는 방향 스트림도 같이 정리
+		for (TArray<float>* Stream : { &PosX, &PosY, &PosZ, &VelX, &VelY, &VelZ, &HomingAccels, &MaxSpeeds, &LifeRemaining, &DirX, &DirY, &DirZ })
+		{
+			Stream->RemoveAtSwap(i, 1, false);
+		}
+		HomingTargets.RemoveAtSwap(i, 1, false);
+		ArchetypeIndices.RemoveAtSwap(i, 1, false);
+		Sources.RemoveAtSwap(i, 1, false);
+		DamageSpecs.RemoveAtSwap(i, 1, false);
+	}
+	PendingRemoval.Reset();
+}
+
+// ========================================
+// ISM 프록시 갱신 (아키타입별 일괄 Transform 업데이트)
+// ========================================
+void UMechaProjectileSimSubsystem::UpdateProxies()
+{
+	ProxyTransforms.SetNum(Archetypes.Num());
+	for (TArray<FTransform>& Group : ProxyTransforms)
+	{
+		Group.Reset();
+	}
+
+	// 회전은 속도 방향을 따름 (커널이 계산한 진행 방향 사용)
+	const int32 Num = PosX.Num();
+	for (int32 i = 0; i < Num; ++i)
+	{
+		const int32 ArchIdx = ArchetypeIndices[i];
+		if (!ProxyComponents[ArchIdx]) continue;
+
+		const FVector Dir(DirX[i], DirY[i], DirZ[i]);
+		ProxyTransforms[ArchIdx].Emplace(Dir.ToOrientationQuat(), FVector(PosX[i], PosY[i], PosZ[i]), Archetypes[ArchIdx].ProxyScale);
+	}
+
+	for (int32 ArchIdx = 0; ArchIdx < ProxyComponents.Num(); ++ArchIdx)
+	{
+		UInstancedStaticMeshComponent* ISM = ProxyComponents[ArchIdx];
+		if (!ISM) continue;
+
+		const TArray<FTransform>& Transforms = ProxyTransforms[ArchIdx];
+		const int32 Current = ISM->GetInstanceCount();
+		const int32 Wanted = Transforms.Num();
+
+		// 인스턴스 수 맞추기 (뒤쪽만 추가/삭제 → 나머지 인덱스 유지)
+		if (Current < Wanted)
+		{
+			TArray<FTransform> Added(&Transforms[Current], Wanted - Current);
+			ISM->AddInstances(Added, false, true);
+		}
+		else if (Current > Wanted)
+		{
+			TArray<int32> ToRemove;
+			ToRemove.Reserve(Current - Wanted);
+			for (int32 Idx = Current - 1; Idx >= Wanted; --Idx)
+			{
+				ToRemove.Add(Idx);
+			}
+			ISM->RemoveInstances(ToRemove);
+		}
+
+		if (Wanted > 0)
+		{
+			ISM->BatchUpdateInstancesTransforms(0, Transforms, true, true, true);
+		}
+	}
+}
+
+// ========================================
+// 아키타입 등록 (같은 설정은 하나의 ISM 공유)
+// ========================================
+int32 UMechaProjectileSimSubsystem::FindOrAddArchetype(const FMechaSimProjectileArchetype& Archetype)
+{
+	const int32 Existing = Archetypes.IndexOfByKey(Archetype);
+	if (Existing != INDEX_NONE)
+	{
+		return Existing;
+	}
+
+	const int32 NewIndex = Archetypes.Add(Archetype);
+	ProxyComponents.Add(Archetype.ProxyMesh ? CreateProxyComponent(Archetype.ProxyMesh) : nullptr);
+	return NewIndex;
+}
+
+// ========================================
+// ISM 프록시 생성
+// ========================================
+UInstancedStaticMeshComponent* UMechaProjectileSimSubsystem::CreateProxyComponent(UStaticMesh* Mesh)
+{
+	UWorld* World = GetWorld();
+	if (!World || !Mesh) return nullptr;
+
+	// 프록시 컴포넌트를 붙일 호스트 액터 (최초 1회)
+	if (!ProxyHost)
+	{
+		FActorSpawnParameters Params;
+		Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		Params.ObjectFlags |= RF_Transient;
+
+		ProxyHost = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, Params);
+		if (!ProxyHost) return nullptr;
+
+		USceneComponent* Root = NewObject<USceneComponent>(ProxyHost, TEXT("ProxyRoot"));
+		ProxyHost->SetRootComponent(Root);
+		Root->RegisterComponent();
+	}
+
+	UInstancedStaticMeshComponent* ISM = NewObject<UInstancedStaticMeshComponent>(ProxyHost);
+	ISM->SetStaticMesh(Mesh);
+	ISM->SetMobility(EComponentMobility::Movable);
+	ISM->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	ISM->SetCastShadow(false);
+	ISM->SetupAttachment(ProxyHost->GetRootComponent());
+	ISM->RegisterComponent();
+	ProxyHost->AddInstanceComponent(ISM);
+
+	return ISM;
+}
@@ -0,0 +1,158 @@
+// MechaProjectileSimSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+// 설명:
+// - 액터 없이 동작하는 투사체(미사일) 시뮬레이션 매니저.
+// - 위치/속도/유도 타겟/수명/데미지 정보를 SoA(배열별) 버퍼에 저장하고,
+//   매 프레임 한 번의 일괄 업데이트로 모든 투사체를 이동/충돌 처리합니다.
+// - 렌더링은 아키타입별 InstancedStaticMesh 프록시 하나로 처리합니다.
+// - 보스전처럼 수백 발이 동시에 날아가는 상황에서 투사체별 컴포넌트 Tick 비용을 제거하기 위함.
+#include "MechaProjectileSimSubsystem.generated.h"
+
+class UStaticMesh;
+class UParticleSystem;
+class USoundBase;
+class UGameplayEffect;
+class UInstancedStaticMeshComponent;
+
+// 시뮬레이션 투사체 외형/이동 설정 (능력/적 BP에서 지정)
+USTRUCT(BlueprintType)
+struct FMechaSimProjectileArchetype
+{
+    GENERATED_BODY()
+
+    // 렌더링 프록시 메쉬 (없으면 보이지 않는 투사체)
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Projectile")
+    UStaticMesh* ProxyMesh = nullptr;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Projectile")
+    FVector ProxyScale = FVector(1.f);
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Projectile|Movement")
+    float InitialSpeed = 3000.f;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Projectile|Movement")
+    float MaxSpeed = 6000.f;
+
+    // 유도 가속도 (0이면 직선 비행)
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Projectile|Movement")
+    float HomingAcceleration = 8000.f;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Projectile|Collision")
+    float CollisionRadius = 20.f;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Projectile|Collision")
+    TEnumAsByte<ECollisionChannel> CollisionChannel = ECC_Visibility;
+
+    // 수명 (초). 만료되면 충돌 없이 제거
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Projectile")
+    float LifeSpan = 8.f;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Projectile|FX")
+    UParticleSystem* ImpactEffect = nullptr;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Projectile|FX")
+    USoundBase* ImpactSound = nullptr;
+
+    bool operator==(const FMechaSimProjectileArchetype& Other) const
+    {
+        return ProxyMesh == Other.ProxyMesh && ProxyScale == Other.ProxyScale
+            && InitialSpeed == Other.InitialSpeed && MaxSpeed == Other.MaxSpeed
+            && HomingAcceleration == Other.HomingAcceleration && CollisionRadius == Other.CollisionRadius
+            && CollisionChannel == Other.CollisionChannel && LifeSpan == Other.LifeSpan
+            && ImpactEffect == Other.ImpactEffect && ImpactSound == Other.ImpactSound;
+    }
+};
+
+// 명중 시 적용할 데미지 (GE + SetByCaller)
+USTRUCT(BlueprintType)
+struct FMechaSimDamageSpec
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Damage")
+    TSubclassOf<UGameplayEffect> DamageEffect;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Damage")
+    FGameplayTag SetByCallerTag;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Damage")
+    float Damage = 0.f;
+};
+
+UCLASS(Config = Game)
+class PROJECT_MECHA_API UMechaProjectileSimSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    static UMechaProjectileSimSubsystem* Get(const UObject* WorldContextObject);
+
+    // 시뮬레이션 투사체 사용 가능 여부. 액터가 없어 복제되지 않으므로 스탠드얼론에서만 허용
+    // (리슨/데디케이티드 서버·클라이언트에서는 호출부가 풀 액터 경로로 대체)
+    static bool IsSimulationAllowed(const UObject* WorldContextObject);
+
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // 투사체 발사. HomingTarget이 있으면 유도 (최대 개수 초과 시 false)
+    UFUNCTION(BlueprintCallable, Category = "Mecha|ProjectileSim")
+    bool SpawnProjectile(const FMechaSimProjectileArchetype& Archetype, const FVector& Location, const FVector& Direction,
+        AActor* HomingTarget, AActor* Source, const FMechaSimDamageSpec& DamageSpec);
+
+    UFUNCTION(BlueprintPure, Category = "Mecha|ProjectileSim")
+    int32 GetNumActiveProjectiles() const { return PosX.Num(); }
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+    // 동시에 유지할 최대 투사체 수
+    UPROPERTY(Config)
+    int32 MaxProjectiles = 4096;
+
+private:
+    // ===== SoA 버퍼 (인덱스 i = 투사체 i) =====
+    // 위치/속도는 SIMD 커널(FMechaHomingKernel)용으로 성분별 float 스트림에 저장
+    TArray<float> PosX, PosY, PosZ;
+    TArray<float> VelX, VelY, VelZ;
+    TArray<float> HomingAccels;
+    TArray<float> MaxSpeeds;
+    TArray<TWeakObjectPtr<USceneComponent>> HomingTargets;
+    TArray<float> LifeRemaining;
+    TArray<int32> ArchetypeIndices;
+    TArray<TWeakObjectPtr<AActor>> Sources;
+    TArray<FMechaSimDamageSpec> DamageSpecs;
+
+    // ===== 프레임 임시 버퍼 (재할당 방지용으로 유지) =====
+    TArray<float> PrevX, PrevY, PrevZ;
+    TArray<float> TargetX, TargetY, TargetZ;
+    TArray<float> FrameHomingAccels;
+    TArray<float> DirX, DirY, DirZ;
+    TArray<int32> PendingRemoval;
+    TArray<TArray<FTransform>> ProxyTransforms;
+
+    // ===== 아키타입 / 렌더링 프록시 =====
+    UPROPERTY()
+    TArray<FMechaSimProjectileArchetype> Archetypes;
+
+    // 아키타입 인덱스별 ISM (메쉬가 없으면 nullptr)
+    UPROPERTY()
+    TArray<UInstancedStaticMeshComponent*> ProxyComponents;
+
+    UPROPERTY()
+    AActor* ProxyHost = nullptr;
+
+    int32 FindOrAddArchetype(const FMechaSimProjectileArchetype& Archetype);
+    UInstancedStaticMeshComponent* CreateProxyComponent(UStaticMesh* Mesh);
+
+    // ===== 프레임 단계 =====
+    void IntegrateMotion(float DeltaTime);
+    void ResolveCollisions(float DeltaTime);
+    void ApplyImpact(int32 Index, const FHitResult& Hit);
+    void RemovePending();
+    void UpdateProxies();
+};
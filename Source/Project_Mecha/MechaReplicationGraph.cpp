@@ -0,0 +1,173 @@
+// MechaReplicationGraph.cpp
+// 서버 복제 그래프 - 공간 그리드(적/플레이어/투사체), 전역 항상 관련(보스/미션 매니저), 연결별 항상 관련
+
+#include "MechaReplicationGraph.h"
+#include "EnemyMecha.h"
+#include "MechaCharacterBase.h"
+#include "MechaCrowdNetCell.h"
+#include "MissionManager.h"
+
+#include "Engine/NetDriver.h"
+#include "GameFramework/ProjectileMovementComponent.h"
+
+// ========================================
+// 클래스별 컬 거리 / 갱신 주기
+// ========================================
+void UMechaReplicationGraph::InitGlobalActorClassSettings()
+{
+	Super::InitGlobalActorClassSettings();
+
+	// 기본값 (등록되지 않은 클래스는 가장 가까운 부모 설정을 사용)
+	FClassReplicationInfo DefaultInfo;
+	DefaultInfo.SetCullDistanceSquared(FMath::Square(DefaultCullDistance));
+	DefaultInfo.ReplicationPeriodFrame = GetReplicationPeriodFrame(30.f);
+	GlobalActorReplicationInfoMap.SetClassInfo(AActor::StaticClass(), DefaultInfo);
+
+	// 플레이어 메카: 기본 컬 거리, 서버 틱마다
+	FClassReplicationInfo PlayerInfo;
+	PlayerInfo.SetCullDistanceSquared(FMath::Square(DefaultCullDistance));
+	PlayerInfo.ReplicationPeriodFrame = 1;
+	GlobalActorReplicationInfoMap.SetClassInfo(AMechaCharacterBase::StaticClass(), PlayerInfo);
+
+	// 적 메카
+	FClassReplicationInfo EnemyInfo;
+	EnemyInfo.SetCullDistanceSquared(FMath::Square(EnemyCullDistance));
+	EnemyInfo.ReplicationPeriodFrame = GetReplicationPeriodFrame(EnemyNetUpdateFrequency);
+	GlobalActorReplicationInfoMap.SetClassInfo(AEnemyMecha::StaticClass(), EnemyInfo);
+}
+
+// ========================================
+// 전역 노드
+// ========================================
+void UMechaReplicationGraph::InitGlobalGraphNodes()
+{
+	GridNode = CreateNewNode<UReplicationGraphNode_GridSpatialization2D>();
+	GridNode->CellSize = GridCellSize;
+	GridNode->SpatialBias = GridSpatialBias;
+	AddGlobalGraphNode(GridNode);
+
+	AlwaysRelevantNode = CreateNewNode<UReplicationGraphNode_ActorList>();
+	AddGlobalGraphNode(AlwaysRelevantNode);
+}
+
+// ========================================
+// 연결별 노드 - 자기 PlayerController / Pawn / 뷰 타겟
+// ========================================
+void UMechaReplicationGraph::InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection)
+{
+	Super::InitConnectionGraphNodes(RepGraphConnection);
+
+	UReplicationGraphNode_AlwaysRelevant_ForConnection* ConnectionNode =
+		CreateNewNode<UReplicationGraphNode_AlwaysRelevant_ForConnection>();
+	AddConnectionGraphNode(ConnectionNode, RepGraphConnection);
+}
+
+// ========================================
+// 액터 라우팅
+// ========================================
+void UMechaReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo)
+{
+	const AActor* Actor = ActorInfo.Actor;
+
+	// 투사체는 BP 클래스라 클래스 설정 대신 액터별로 지정
+	if (Actor && Actor->FindComponentByClass<UProjectileMovementComponent>())
+	{
+		GlobalInfo.Settings.SetCullDistanceSquared(FMath::Square(ProjectileCullDistance));
+		GlobalInfo.Settings.ReplicationPeriodFrame = GetReplicationPeriodFrame(ProjectileNetUpdateFrequency);
+	}
+
+	// 군중 복제 셀은 UMechaCrowdSubsystem 설정(스폰 시 액터에 지정)을 따름
+	if (Actor && Actor->IsA<AMechaCrowdNetCell>())
+	{
+		GlobalInfo.Settings.SetCullDistanceSquared(Actor->NetCullDistanceSquared);
+		GlobalInfo.Settings.ReplicationPeriodFrame = GetReplicationPeriodFrame(Actor->NetUpdateFrequency);
+	}
+
+	switch (RouteActor(Actor))
+	{
+	case EMechaRepRoute::AlwaysRelevant:
+		AlwaysRelevantNode->NotifyAddNetworkActor(ActorInfo);
+		break;
+
+	case EMechaRepRoute::SpatializeStatic:
+		GridNode->AddActor_Static(ActorInfo, GlobalInfo);
+		break;
+
+	case EMechaRepRoute::SpatializeDynamic:
+		GridNode->AddActor_Dynamic(ActorInfo, GlobalInfo);
+		break;
+
+	default:
+		break;
+	}
+}
+
+void UMechaReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo)
+{
+	switch (RouteActor(ActorInfo.Actor))
+	{
+	case EMechaRepRoute::AlwaysRelevant:
+		AlwaysRelevantNode->NotifyRemoveNetworkActor(ActorInfo);
+		break;
+
+	case EMechaRepRoute::SpatializeStatic:
+		GridNode->RemoveActor_Static(ActorInfo);
+		break;
+
+	case EMechaRepRoute::SpatializeDynamic:
+		GridNode->RemoveActor_Dynamic(ActorInfo);
+		break;
+
+	default:
+		break;
+	}
+}
+
+// ========================================
+// 내부 - 라우팅 규칙 (추가/제거가 같은 결과를 내야 함)
+// ========================================
+EMechaRepRoute UMechaReplicationGraph::RouteActor(const AActor* Actor) const
+{
+	if (!Actor)
+	{
+		return EMechaRepRoute::NotRouted;
+	}
+
+	// 소유자 전용 액터는 연결별 노드가 처리
+	if (Actor->bOnlyRelevantToOwner)
+	{
+		return EMechaRepRoute::NotRouted;
+	}
+
+	// 미션 진행 / 보스는 거리와 상관없이 모든 클라이언트에 필요
+	if (Actor->bAlwaysRelevant || Actor->IsA<AMissionManager>())
+	{
+		return EMechaRepRoute::AlwaysRelevant;
+	}
+
+	if (const AEnemyMecha* Enemy = Cast<AEnemyMecha>(Actor); Enemy && Enemy->bIsBoss)
+	{
+		return EMechaRepRoute::AlwaysRelevant;
+	}
+
+	// 군중 복제 셀은 제자리 (인스턴스 메시 루트라 Movable이지만 액터는 움직이지 않음)
+	if (Actor->IsA<AMechaCrowdNetCell>())
+	{
+		return EMechaRepRoute::SpatializeStatic;
+	}
+
+	// 이동을 복제하지 않고 루트가 고정이면 셀 재계산 불필요
+	const USceneComponent* Root = Actor->GetRootComponent();
+	if (!Actor->IsReplicatingMovement() && (!Root || Root->Mobility != EComponentMobility::Movable))
+	{
+		return EMechaRepRoute::SpatializeStatic;
+	}
+
+	return EMechaRepRoute::SpatializeDynamic;
+}
+
+uint32 UMechaReplicationGraph::GetReplicationPeriodFrame(float NetUpdateFrequency) const
+{
+	const float ServerTickRate = NetDriver ? (float)NetDriver->NetServerMaxTickRate : 30.f;
+	return (uint32)FMath::Max(1, FMath::RoundToInt(ServerTickRate / FMath::Max(NetUpdateFrequency, 1.f)));
+}
@@ -0,0 +1,80 @@
+// MechaReplicationGraph.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ReplicationGraph.h"
+// 설명:
+// - 데디케이티드/리슨 서버용 Replication Graph. DefaultEngine.ini의 IpNetDriver ReplicationDriverClassName으로 지정됩니다.
+// - 노드 구성:
+//   - 공간 그리드(GridSpatialization2D): 적 메카, 플레이어 메카, 투사체 등 움직이는 액터.
+//     군중 복제 셀(AMechaCrowdNetCell)은 정적으로 등록하고 컬 거리/주기는 셀 액터 값을 씁니다.
+//     연결(클라이언트) 시점 주변 셀만 확인하므로 액터 수가 늘어도 연결당 비용이 거의 일정합니다.
+//   - 전역 항상 관련: 보스(AEnemyMecha::bIsBoss), AMissionManager, GameState/PlayerState 등 bAlwaysRelevant 액터.
+//   - 연결별 항상 관련: 자기 PlayerController / Pawn / 뷰 타겟.
+// - 컬 거리와 갱신 주기는 클래스별(적/플레이어)로, 투사체는 ProjectileMovement 보유 여부로 액터별 설정합니다.
+// - 라우팅은 액터 추가/제거 시 같은 규칙(RouteActor)으로 다시 계산하므로 별도 맵을 두지 않습니다.
+#include "MechaReplicationGraph.generated.h"
+
+class UReplicationGraphNode_GridSpatialization2D;
+class UReplicationGraphNode_ActorList;
+
+// 액터가 들어갈 노드
+enum class EMechaRepRoute : uint8
+{
+    NotRouted,          // 소유자 전용(PlayerController 등) - 연결별 노드가 처리
+    AlwaysRelevant,     // 전역 항상 관련 목록
+    SpatializeStatic,   // 그리드 (움직이지 않음)
+    SpatializeDynamic,  // 그리드 (매 프레임 위치 갱신)
+};
+
+UCLASS(Transient, Config = Engine)
+class PROJECT_MECHA_API UMechaReplicationGraph : public UReplicationGraph
+{
+    GENERATED_BODY()
+
+public:
+    virtual void InitGlobalActorClassSettings() override;
+    virtual void InitGlobalGraphNodes() override;
+    virtual void InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection) override;
+    virtual void RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo) override;
+    virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo) override;
+
+protected:
+    // ===== 그리드 =====
+    // 셀 크기 (적 컬 거리보다 약간 작게)
+    UPROPERTY(Config)
+    float GridCellSize = 10000.f;
+
+    // 맵 최소 좌표 (그리드 원점 보정)
+    UPROPERTY(Config)
+    FVector2D GridSpatialBias = FVector2D(-200000.f, -200000.f);
+
+    // ===== 클래스별 설정 =====
+    UPROPERTY(Config)
+    float DefaultCullDistance = 15000.f;
+
+    UPROPERTY(Config)
+    float EnemyCullDistance = 15000.f;
+
+    // 투사체는 빠르게 사라지므로 가까운 것만
+    UPROPERTY(Config)
+    float ProjectileCullDistance = 8000.f;
+
+    // 초당 목표 갱신 횟수 (서버 틱레이트로 나눠 프레임 주기로 변환)
+    UPROPERTY(Config)
+    float EnemyNetUpdateFrequency = 30.f;
+
+    UPROPERTY(Config)
+    float ProjectileNetUpdateFrequency = 60.f;
+
+private:
+    UPROPERTY()
+    TObjectPtr<UReplicationGraphNode_GridSpatialization2D> GridNode;
+
+    UPROPERTY()
+    TObjectPtr<UReplicationGraphNode_ActorList> AlwaysRelevantNode;
+
+    EMechaRepRoute RouteActor(const AActor* Actor) const;
+
+    uint32 GetReplicationPeriodFrame(float NetUpdateFrequency) const;
+};
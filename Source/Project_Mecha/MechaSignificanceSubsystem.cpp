@@ -0,0 +1,234 @@
+// MechaSignificanceSubsystem.cpp
+// 적 메카 중요도(LOD) - 거리/시야/전투 상태로 단계 결정, 단계별 틱·애님·위젯·파티클 설정 적용
+
+#include "MechaSignificanceSubsystem.h"
+#include "MechaStats.h"
+#include "MechaCombatRegistrySubsystem.h"
+#include "EnemyMecha.h"
+#include "Project_Mecha.h"
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Significance Update"), STAT_Mecha_SignificanceUpdate, STATGROUP_Mecha);
+
+static TAutoConsoleVariable<int32> CVarMechaSignificanceEnable(
+	TEXT("Mecha.Significance.Enable"),
+	1,
+	TEXT("1이면 적 메카를 거리/시야/전투 상태로 단계별 LOD 처리합니다. 0이면 모든 적을 High로 유지합니다."));
+
+// 콘솔 명령: 단계별 적 수 출력
+static FAutoConsoleCommandWithWorld GMechaSignificanceDumpCmd(
+	TEXT("Mecha.Significance.Dump"),
+	TEXT("적 메카 중요도 단계별(High/Medium/Low/Off) 개수를 출력합니다."),
+	FConsoleCommandWithWorldDelegate::CreateStatic([](UWorld* World)
+		{
+			if (const UMechaSignificanceSubsystem* Significance = UMechaSignificanceSubsystem::Get(World))
+			{
+				Significance->DumpStats();
+			}
+		}));
+
+// ========================================
+// 생성자 - 단계별 기본값
+// ========================================
+UMechaSignificanceSubsystem::UMechaSignificanceSubsystem()
+{
+	// High: 기본 (모두 매 프레임)
+
+	// Medium: 애님은 보일 때만
+	MediumSettings.ActorTickInterval = 0.1f;
+	MediumSettings.AnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickPoseWhenRendered;
+	MediumSettings.bUseUpdateRateOptimizations = true;
+
+	// Low: 보이지만 멂
+	LowSettings.ActorTickInterval = 0.25f;
+	LowSettings.MovementTickInterval = 0.05f;
+	LowSettings.AIControllerTickInterval = 0.2f;
+	LowSettings.AnimTickInterval = 1.f / 15.f;
+	LowSettings.AnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickPoseWhenRendered;
+	LowSettings.bUseUpdateRateOptimizations = true;
+	LowSettings.bShowHealthWidget = false;
+	LowSettings.bAllowHoverParticles = false;
+
+	// Off: 안 보이고 멂
+	OffSettings.ActorTickInterval = 1.f;
+	OffSettings.MovementTickInterval = 0.25f;
+	OffSettings.AIControllerTickInterval = 0.5f;
+	OffSettings.bPauseBehaviorTree = true;
+	OffSettings.AnimTickInterval = 0.5f;
+	OffSettings.AnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered;
+	OffSettings.bUseUpdateRateOptimizations = true;
+	OffSettings.bShowHealthWidget = false;
+	OffSettings.bAllowHoverParticles = false;
+}
+
+// ========================================
+// 접근자
+// ========================================
+UMechaSignificanceSubsystem* UMechaSignificanceSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine || !WorldContextObject) return nullptr;
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UMechaSignificanceSubsystem>() : nullptr;
+}
+
+bool UMechaSignificanceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UMechaSignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMechaSignificanceSubsystem, STATGROUP_Tickables);
+}
+
+const FMechaSignificanceSettings& UMechaSignificanceSubsystem::GetSettings(EMechaSignificance Significance) const
+{
+	switch (Significance)
+	{
+	case EMechaSignificance::Medium: return MediumSettings;
+	case EMechaSignificance::Low:    return LowSettings;
+	case EMechaSignificance::Off:    return OffSettings;
+	default:                         return HighSettings;
+	}
+}
+
+// ========================================
+// 매 프레임 - UpdateInterval마다 전체 갱신
+// ========================================
+void UMechaSignificanceSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	TimeSinceUpdate += DeltaTime;
+	if (TimeSinceUpdate < UpdateInterval)
+	{
+		return;
+	}
+	TimeSinceUpdate = 0.f;
+
+	UpdateSignificance();
+}
+
+void UMechaSignificanceSubsystem::UpdateSignificance()
+{
+	SCOPE_CYCLE_COUNTER(STAT_Mecha_SignificanceUpdate);
+
+	const UMechaCombatRegistrySubsystem* Registry = UMechaCombatRegistrySubsystem::Get(this);
+	if (!Registry) return;
+
+	GatherViewers();
+
+	const bool bEnabled = CVarMechaSignificanceEnable.GetValueOnGameThread() != 0;
+
+	FMemory::Memzero(BucketCounts, sizeof(BucketCounts));
+
+	for (const FMechaCombatEntry& Entry : Registry->GetEntries())
+	{
+		if (Entry.Team != EMechaCombatTeam::Enemy) continue;
+
+		AEnemyMecha* Enemy = Cast<AEnemyMecha>(Entry.Actor.Get());
+		if (!Enemy) continue;
+
+		// 시점이 없으면(서버 접속자 없음 등) 판단 근거가 없으므로 그대로 둠
+		const EMechaSignificance NewSignificance = (bEnabled && Viewers.Num() > 0)
+			? Evaluate(Enemy, Entry.Location)
+			: EMechaSignificance::High;
+
+		Enemy->ApplySignificance(NewSignificance, GetSettings(NewSignificance));
+		++BucketCounts[(int32)NewSignificance];
+	}
+}
+
+// ========================================
+// 내부 - 플레이어 시점 수집
+// ========================================
+void UMechaSignificanceSubsystem::GatherViewers()
+{
+	Viewers.Reset();
+
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (!PC) continue;
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+		Viewers.Add({ ViewLocation, ViewRotation.Vector() });
+	}
+}
+
+// ========================================
+// 내부 - 단계 결정
+// ========================================
+EMechaSignificance UMechaSignificanceSubsystem::Evaluate(const AEnemyMecha* Enemy, const FVector& Location) const
+{
+	if (Enemy->bIsBoss)
+	{
+		return EMechaSignificance::High;
+	}
+
+	// 가장 가까운 시점까지 거리, 시야 원뿔 안에 있는지
+	const float ConeCos = FMath::Cos(FMath::DegreesToRadians(ViewConeHalfAngle));
+	float MinDistSq = TNumericLimits<float>::Max();
+	bool bInView = false;
+
+	for (const FViewer& Viewer : Viewers)
+	{
+		const FVector ToEnemy = Location - Viewer.Location;
+		const float DistSq = ToEnemy.SizeSquared();
+		MinDistSq = FMath::Min(MinDistSq, DistSq);
+
+		if (!bInView && DistSq > KINDA_SMALL_NUMBER)
+		{
+			bInView = FVector::DotProduct(ToEnemy * FMath::InvSqrt(DistSq), Viewer.Direction) >= ConeCos;
+		}
+	}
+
+	// 현재 단계 이상을 유지하는 쪽은 경계를 Hysteresis만큼 넓힘
+	const EMechaSignificance Current = Enemy->GetSignificance();
+	auto Within = [MinDistSq, Current, this](float Distance, EMechaSignificance Level)
+	{
+		const float Scale = (Current <= Level) ? (1.f + Hysteresis) : 1.f;
+		return MinDistSq < FMath::Square(Distance * Scale);
+	};
+
+	// 전투 중(타겟 보유)이면 최소 Medium - 단, LowDistance 이내일 때만
+	const bool bInCombat = IsValid(Enemy->CurrentTarget) && Within(LowDistance, EMechaSignificance::Medium);
+
+	if (Within(HighDistance, EMechaSignificance::High))
+	{
+		return EMechaSignificance::High;
+	}
+	if (Within(MediumDistance, EMechaSignificance::Medium))
+	{
+		return bInCombat ? EMechaSignificance::High : EMechaSignificance::Medium;
+	}
+	if (bInCombat)
+	{
+		return EMechaSignificance::Medium;
+	}
+	if (bInView && Within(LowDistance, EMechaSignificance::Low))
+	{
+		return EMechaSignificance::Low;
+	}
+	return EMechaSignificance::Off;
+}
+
+// ========================================
+// 통계
+// ========================================
+void UMechaSignificanceSubsystem::DumpStats() const
+{
+	UE_LOG(LogMecha, Log, TEXT("[Significance] Viewers=%d High=%d Medium=%d Low=%d Off=%d"),
+		Viewers.Num(), BucketCounts[0], BucketCounts[1], BucketCounts[2], BucketCounts[3]);
+}
@@ -0,0 +1,142 @@
+// MechaSignificanceSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Components/SkinnedMeshComponent.h"
+// 설명:
+// - 적 메카 중요도(LOD) 관리. 전투 등록부의 적 위치 캐시와 플레이어 시점(PlayerController 뷰포인트)으로
+//   UpdateInterval마다 적을 High / Medium / Low / Off 4단계로 나누고, 단계가 바뀐 적에만 설정을 적용합니다.
+//   - High   : 가깝거나(HighDistance) 전투 중 근거리. 모든 것을 매 프레임.
+//   - Medium : MediumDistance 이내 또는 LowDistance 이내에서 전투 중(타겟 보유). 애님은 보일 때만 포즈 갱신.
+//              LowDistance 밖이면 전투 중이어도 승격하지 않습니다 (먼 곳의 적끼리/군중 전투가 전부 Medium이 되지 않도록).
+//   - Low    : 멀지만 시야 원뿔 안(LowDistance 이내). 이동/BT/애님 틱 간격 증가, 체력 위젯·호버 파티클 끔.
+//   - Off    : 시야 밖 + MediumDistance 밖 (또는 LowDistance 밖). BT 일시정지, 이동/애님 틱 최소.
+// - 보스는 항상 High. 단계 경계에는 Hysteresis 비율만큼 여유를 두어 경계에서 깜빡이지 않습니다.
+// - 서버에서는 모든 플레이어, 클라이언트에서는 로컬 플레이어 시점 기준입니다.
+// - 콘솔: Mecha.Significance.Enable 0/1, Mecha.Significance.Dump
+#include "MechaSignificanceSubsystem.generated.h"
+
+class AEnemyMecha;
+
+UENUM(BlueprintType)
+enum class EMechaSignificance : uint8
+{
+    High,
+    Medium,
+    Low,
+    Off
+};
+
+// 단계별 적용 값
+USTRUCT(BlueprintType)
+struct FMechaSignificanceSettings
+{
+    GENERATED_BODY()
+
+    // 0이면 매 프레임
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Significance")
+    float ActorTickInterval = 0.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Significance")
+    float MovementTickInterval = 0.f;
+
+    // AI 컨트롤러 / 경로 추적 틱 간격
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Significance")
+    float AIControllerTickInterval = 0.f;
+
+    // BT 일시정지 (타겟을 잡으면 Medium 이상이 되어 다시 재개)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Significance")
+    bool bPauseBehaviorTree = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Significance")
+    float AnimTickInterval = 0.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Significance")
+    EVisibilityBasedAnimTickOption AnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPose;
+
+    // 애니메이션 Update Rate Optimization (화면 크기에 따라 평가 주기 감소)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Significance")
+    bool bUseUpdateRateOptimizations = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Significance")
+    bool bShowHealthWidget = true;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Significance")
+    bool bAllowHoverParticles = true;
+};
+
+UCLASS(Config = Game)
+class PROJECT_MECHA_API UMechaSignificanceSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    UMechaSignificanceSubsystem();
+
+    static UMechaSignificanceSubsystem* Get(const UObject* WorldContextObject);
+
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    const FMechaSignificanceSettings& GetSettings(EMechaSignificance Significance) const;
+
+    UFUNCTION(BlueprintPure, Category = "Mecha|Significance")
+    int32 GetNumInBucket(EMechaSignificance Significance) const { return BucketCounts[(int32)Significance]; }
+
+    // 단계별 적 수를 로그로 출력
+    void DumpStats() const;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+    // ===== 단계 기준 (DefaultGame.ini [/Script/Project_Mecha.MechaSignificanceSubsystem]) =====
+    UPROPERTY(Config)
+    float UpdateInterval = 0.25f;
+
+    UPROPERTY(Config)
+    float HighDistance = 2000.f;
+
+    UPROPERTY(Config)
+    float MediumDistance = 5000.f;
+
+    UPROPERTY(Config)
+    float LowDistance = 12000.f;
+
+    // 시야 원뿔 반각 (도)
+    UPROPERTY(Config)
+    float ViewConeHalfAngle = 60.f;
+
+    // 현재 단계를 유지하는 거리 여유 비율 (0.1 = 10%)
+    UPROPERTY(Config)
+    float Hysteresis = 0.1f;
+
+    // ===== 단계별 설정 =====
+    UPROPERTY(Config)
+    FMechaSignificanceSettings HighSettings;
+
+    UPROPERTY(Config)
+    FMechaSignificanceSettings MediumSettings;
+
+    UPROPERTY(Config)
+    FMechaSignificanceSettings LowSettings;
+
+    UPROPERTY(Config)
+    FMechaSignificanceSettings OffSettings;
+
+private:
+    struct FViewer
+    {
+        FVector Location;
+        FVector Direction;
+    };
+
+    float TimeSinceUpdate = 0.f;
+    int32 BucketCounts[4] = { 0, 0, 0, 0 };
+
+    TArray<FViewer> Viewers;
+
+    void GatherViewers();
+    void UpdateSignificance();
+    EMechaSignificance Evaluate(const AEnemyMecha* Enemy, const FVector& Location) const;
+};
@@ -0,0 +1,404 @@
+// MechaSpatialHash.cpp
+// 전투 참가자 공간 해시 - 균일 격자, 반경/원뿔/K-최근접 조회, 선형 탐색 대비 벤치마크
+
+#include "MechaSpatialHash.h"
+
+#include "Project_Mecha.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+// ========================================
+// 생성 / 초기화
+// ========================================
+FMechaSpatialHash::FMechaSpatialHash(float InCellSize)
+{
+	Reset(InCellSize);
+}
+
+void FMechaSpatialHash::Reset(float InCellSize)
+{
+	CellSize = FMath::Max(InCellSize, 1.f);
+	InvCellSize = 1.f / CellSize;
+
+	Items.Empty();
+	Cells.Empty();
+}
+
+FIntPoint FMechaSpatialHash::ToCell(const FVector& Location) const
+{
+	return FIntPoint(
+		FMath::FloorToInt32(Location.X * InvCellSize),
+		FMath::FloorToInt32(Location.Y * InvCellSize));
+}
+
+void FMechaSpatialHash::AddToCell(const FIntPoint& Cell, int32 ItemId)
+{
+	Cells.FindOrAdd(Cell).Add(ItemId);
+}
+
+void FMechaSpatialHash::RemoveFromCell(const FIntPoint& Cell, int32 ItemId)
+{
+	if (TArray<int32>* CellItems = Cells.Find(Cell))
+	{
+		CellItems->RemoveSingleSwap(ItemId, false);
+
+		// 빈 셀은 제거 (조회 시 방문할 셀 수를 줄이기 위함)
+		if (CellItems->Num() == 0)
+		{
+			Cells.Remove(Cell);
+		}
+	}
+}
+
+// ========================================
+// 항목 관리
+// ========================================
+int32 FMechaSpatialHash::Add(const FVector& Location, int32 UserIndex)
+{
+	FItem Item;
+	Item.Location = Location;
+	Item.Cell = ToCell(Location);
+	Item.UserIndex = UserIndex;
+
+	const int32 ItemId = Items.Add(Item);
+	AddToCell(Item.Cell, ItemId);
+	return ItemId;
+}
+
+void FMechaSpatialHash::Remove(int32 ItemId)
+{
+	if (!Items.IsValidIndex(ItemId)) return;
+
+	RemoveFromCell(Items[ItemId].Cell, ItemId);
+	Items.RemoveAt(ItemId);
+}
+
+bool FMechaSpatialHash::Update(int32 ItemId, const FVector& NewLocation)
+{
+	if (!Items.IsValidIndex(ItemId)) return false;
+
+	FItem& Item = Items[ItemId];
+	Item.Location = NewLocation;
+
+	const FIntPoint NewCell = ToCell(NewLocation);
+	if (NewCell == Item.Cell) return false;
+
+	RemoveFromCell(Item.Cell, ItemId);
+	AddToCell(NewCell, ItemId);
+	Item.Cell = NewCell;
+	return true;
+}
+
+void FMechaSpatialHash::SetUserIndex(int32 ItemId, int32 UserIndex)
+{
+	if (Items.IsValidIndex(ItemId))
+	{
+		Items[ItemId].UserIndex = UserIndex;
+	}
+}
+
+// ========================================
+// 조회
+// ========================================
+template <typename VisitorType>
+void FMechaSpatialHash::ForEachCellInRange(const FIntPoint& Min, const FIntPoint& Max, VisitorType&& Visitor) const
+{
+	const int64 RangeCells = int64(Max.X - Min.X + 1) * int64(Max.Y - Min.Y + 1);
+
+	// 범위가 점유 셀 수보다 넓으면 점유 셀만 훑는 편이 빠름
+	if (RangeCells > Cells.Num())
+	{
+		for (const TPair<FIntPoint, TArray<int32>>& Pair : Cells)
+		{
+			const FIntPoint& Cell = Pair.Key;
+			if (Cell.X >= Min.X && Cell.X <= Max.X && Cell.Y >= Min.Y && Cell.Y <= Max.Y)
+			{
+				Visitor(Pair.Value);
+			}
+		}
+		return;
+	}
+
+	for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+	{
+		for (int32 X = Min.X; X <= Max.X; ++X)
+		{
+			if (const TArray<int32>* CellItems = Cells.Find(FIntPoint(X, Y)))
+			{
+				Visitor(*CellItems);
+			}
+		}
+	}
+}
+
+void FMechaSpatialHash::QueryRadius(const FVector& Origin, float Radius, TArray<int32>& OutUserIndices, FFilter Filter) const
+{
+	OutUserIndices.Reset();
+	if (Radius <= 0.f || Items.Num() == 0) return;
+
+	const float RadiusSq = FMath::Square(Radius);
+	const FIntPoint Min = ToCell(Origin - FVector(Radius, Radius, 0.f));
+	const FIntPoint Max = ToCell(Origin + FVector(Radius, Radius, 0.f));
+
+	ForEachCellInRange(Min, Max, [&](const TArray<int32>& CellItems)
+		{
+			for (const int32 ItemId : CellItems)
+			{
+				const FItem& Item = Items[ItemId];
+				if (FVector::DistSquared(Origin, Item.Location) > RadiusSq) continue;
+				if (!Filter(Item.UserIndex)) continue;
+
+				OutUserIndices.Add(Item.UserIndex);
+			}
+		});
+}
+
+void FMechaSpatialHash::QueryCone(const FVector& Origin, const FVector& Direction, float Radius, float CosHalfAngle, TArray<int32>& OutUserIndices, FFilter Filter) const
+{
+	OutUserIndices.Reset();
+	if (Radius <= 0.f || Items.Num() == 0) return;
+
+	const float RadiusSq = FMath::Square(Radius);
+	const FIntPoint Min = ToCell(Origin - FVector(Radius, Radius, 0.f));
+	const FIntPoint Max = ToCell(Origin + FVector(Radius, Radius, 0.f));
+
+	ForEachCellInRange(Min, Max, [&](const TArray<int32>& CellItems)
+		{
+			for (const int32 ItemId : CellItems)
+			{
+				const FItem& Item = Items[ItemId];
+				const FVector ToItem = Item.Location - Origin;
+				const float DistSq = ToItem.SizeSquared();
+				if (DistSq > RadiusSq) continue;
+
+				// dot(Dir, ToItem) >= cos * |ToItem| 를 부호 보존 제곱으로 비교 (정규화/sqrt/acos 없음)
+				const float Dot = FVector::DotProduct(Direction, ToItem);
+				if (Dot * FMath::Abs(Dot) < CosHalfAngle * FMath::Abs(CosHalfAngle) * DistSq) continue;
+
+				if (!Filter(Item.UserIndex)) continue;
+
+				OutUserIndices.Add(Item.UserIndex);
+			}
+		});
+}
+
+void FMechaSpatialHash::QueryKNearest(const FVector& Origin, int32 K, float MaxRadius, TArray<int32>& OutUserIndices, FFilter Filter) const
+{
+	OutUserIndices.Reset();
+	if (K <= 0 || Items.Num() == 0) return;
+
+	struct FCandidate
+	{
+		float DistSq;
+		int32 UserIndex;
+	};
+
+	// 거리 오름차순으로 유지되는 상위 K개
+	TArray<FCandidate, TInlineAllocator<16>> Best;
+
+	const bool bLimitRadius = MaxRadius > 0.f;
+	const float MaxRadiusSq = bLimitRadius ? FMath::Square(MaxRadius) : TNumericLimits<float>::Max();
+	const FIntPoint Center = ToCell(Origin);
+
+	int32 VisitedCells = 0;
+
+	auto VisitCell = [&](int32 X, int32 Y)
+		{
+			const TArray<int32>* CellItems = Cells.Find(FIntPoint(X, Y));
+			if (!CellItems) return;
+
+			++VisitedCells;
+
+			for (const int32 ItemId : *CellItems)
+			{
+				const FItem& Item = Items[ItemId];
+				const float DistSq = FVector::DistSquared(Origin, Item.Location);
+				if (DistSq > MaxRadiusSq) continue;
+				if (Best.Num() == K && DistSq >= Best.Last().DistSq) continue;
+				if (!Filter(Item.UserIndex)) continue;
+
+				int32 InsertAt = Best.Num();
+				while (InsertAt > 0 && Best[InsertAt - 1].DistSq > DistSq)
+				{
+					--InsertAt;
+				}
+				Best.Insert(FCandidate{ DistSq, Item.UserIndex }, InsertAt);
+
+				if (Best.Num() > K)
+				{
+					Best.Pop(false);
+				}
+			}
+		};
+
+	// 중심 셀부터 바깥 링 순서로 확장
+	for (int32 Ring = 0; VisitedCells < Cells.Num(); ++Ring)
+	{
+		// 링 Ring의 모든 점은 Origin에서 최소 (Ring - 1) * CellSize 떨어져 있음
+		const float RingMinDist = FMath::Max(Ring - 1, 0) * CellSize;
+		if (bLimitRadius && RingMinDist > MaxRadius) break;
+		if (Best.Num() == K && FMath::Square(RingMinDist) > Best.Last().DistSq) break;
+
+		if (Ring == 0)
+		{
+			VisitCell(Center.X, Center.Y);
+			continue;
+		}
+
+		for (int32 X = -Ring; X <= Ring; ++X)
+		{
+			VisitCell(Center.X + X, Center.Y - Ring);
+			VisitCell(Center.X + X, Center.Y + Ring);
+		}
+		for (int32 Y = -Ring + 1; Y <= Ring - 1; ++Y)
+		{
+			VisitCell(Center.X - Ring, Center.Y + Y);
+			VisitCell(Center.X + Ring, Center.Y + Y);
+		}
+	}
+
+	OutUserIndices.Reserve(Best.Num());
+	for (const FCandidate& Candidate : Best)
+	{
+		OutUserIndices.Add(Candidate.UserIndex);
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+
+// ========================================
+// 벤치마크 - 현재 선형 탐색(등록부 전체 순회)과 비교
+// ========================================
+namespace MechaSpatialBench
+{
+	static constexpr float WorldHalfExtent = 50000.f;
+	static constexpr float LockOnRadius = 5000.f;
+	static constexpr float LockOnAngleDeg = 60.f;
+
+	static void Run(int32 NumEnemies, int32 NumQueries)
+	{
+		FRandomStream Rand(NumEnemies);
+
+		TArray<FVector> Locations;
+		Locations.SetNumUninitialized(NumEnemies);
+		for (FVector& Loc : Locations)
+		{
+			Loc = FVector(Rand.FRandRange(-WorldHalfExtent, WorldHalfExtent), Rand.FRandRange(-WorldHalfExtent, WorldHalfExtent), Rand.FRandRange(0.f, 2000.f));
+		}
+
+		FMechaSpatialHash Hash;
+		TArray<int32> ItemIds;
+		for (int32 i = 0; i < NumEnemies; ++i)
+		{
+			ItemIds.Add(Hash.Add(Locations[i], i));
+		}
+
+		TArray<FVector> Origins, Forwards;
+		for (int32 q = 0; q < NumQueries; ++q)
+		{
+			Origins.Add(FVector(Rand.FRandRange(-WorldHalfExtent, WorldHalfExtent), Rand.FRandRange(-WorldHalfExtent, WorldHalfExtent), 500.f));
+			Forwards.Add(FRotator(0.f, Rand.FRandRange(-180.f, 180.f), 0.f).Vector());
+		}
+
+		auto AcceptAll = [](int32) { return true; };
+		const float RadiusSq = FMath::Square(LockOnRadius);
+		const float CosHalfAngle = FMath::Cos(FMath::DegreesToRadians(LockOnAngleDeg));
+
+		TArray<int32> Result;
+		int64 LinearHits = 0, HashHits = 0;
+		int32 NearestMismatch = 0;
+
+		// ---- 선형: 반경 + 시야각 (현재 FindLockOnTarget과 같은 acos 비교) ----
+		double Start = FPlatformTime::Seconds();
+		for (int32 q = 0; q < NumQueries; ++q)
+		{
+			for (const FVector& Loc : Locations)
+			{
+				const FVector ToTarget = Loc - Origins[q];
+				if (ToTarget.SizeSquared() > RadiusSq) continue;
+
+				const float Dot = FVector::DotProduct(Forwards[q], ToTarget.GetSafeNormal());
+				if (FMath::RadiansToDegrees(FMath::Acos(FMath::Clamp(Dot, -1.f, 1.f))) > LockOnAngleDeg) continue;
+
+				++LinearHits;
+			}
+		}
+		const double LinearConeMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		// ---- 해시: 원뿔 ----
+		Start = FPlatformTime::Seconds();
+		for (int32 q = 0; q < NumQueries; ++q)
+		{
+			Hash.QueryCone(Origins[q], Forwards[q], LockOnRadius, CosHalfAngle, Result, AcceptAll);
+			HashHits += Result.Num();
+		}
+		const double HashConeMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		// ---- 선형: 최근접 1개 (현재 PickBestTarget) ----
+		TArray<int32> LinearNearest;
+		LinearNearest.SetNumUninitialized(NumQueries);
+
+		Start = FPlatformTime::Seconds();
+		for (int32 q = 0; q < NumQueries; ++q)
+		{
+			float BestDistSq = RadiusSq;
+			int32 Best = INDEX_NONE;
+			for (int32 i = 0; i < NumEnemies; ++i)
+			{
+				const float DistSq = FVector::DistSquared(Origins[q], Locations[i]);
+				if (DistSq < BestDistSq)
+				{
+					BestDistSq = DistSq;
+					Best = i;
+				}
+			}
+			LinearNearest[q] = Best;
+		}
+		const double LinearNearestMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		// ---- 해시: K=1 최근접 ----
+		Start = FPlatformTime::Seconds();
+		for (int32 q = 0; q < NumQueries; ++q)
+		{
+			Hash.QueryKNearest(Origins[q], 1, LockOnRadius, Result, AcceptAll);
+			const int32 Found = Result.Num() > 0 ? Result[0] : INDEX_NONE;
+			if (Found != LinearNearest[q])
+			{
+				++NearestMismatch;
+			}
+		}
+		const double HashNearestMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		// ---- 해시: 이동 갱신 (한 프레임 분량, 셀 변경 시에만 재배치) ----
+		Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumEnemies; ++i)
+		{
+			Locations[i] += FVector(Rand.FRandRange(-20.f, 20.f), Rand.FRandRange(-20.f, 20.f), 0.f);
+			Hash.Update(ItemIds[i], Locations[i]);
+		}
+		const double UpdateMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		UE_LOG(LogMecha, Log, TEXT("[SpatialHash] N=%d Queries=%d Cone: Linear=%.3fms Hash=%.3fms (x%.1f, hits %lld/%lld) | Nearest: Linear=%.3fms Hash=%.3fms (x%.1f, mismatch %d) | Update=%.3fms"),
+			NumEnemies, NumQueries,
+			LinearConeMs, HashConeMs, HashConeMs > 0.0 ? LinearConeMs / HashConeMs : 0.0, LinearHits, HashHits,
+			LinearNearestMs, HashNearestMs, HashNearestMs > 0.0 ? LinearNearestMs / HashNearestMs : 0.0, NearestMismatch,
+			UpdateMs);
+	}
+}
+
+// 콘솔: Mecha.CombatRegistry.BenchSpatial [조회 수] (적 50 / 500 / 5000)
+static FAutoConsoleCommand GMechaBenchSpatialCmd(
+	TEXT("Mecha.CombatRegistry.BenchSpatial"),
+	TEXT("공간 해시 원뿔/최근접 조회와 선형 탐색 비교 (적 50, 500, 5000). 인자: 조회 수 (기본 1000)"),
+	FConsoleCommandWithArgsDelegate::CreateStatic([](const TArray<FString>& Args)
+		{
+			const int32 NumQueries = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000;
+
+			for (const int32 NumEnemies : { 50, 500, 5000 })
+			{
+				MechaSpatialBench::Run(NumEnemies, NumQueries);
+			}
+		}));
+
+#endif // !UE_BUILD_SHIPPING
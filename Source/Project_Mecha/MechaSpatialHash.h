@@ -0,0 +1,70 @@
+// MechaSpatialHash.h
+#pragma once
+
+#include "CoreMinimal.h"
+// 설명:
+// - 전투 참가자용 2D(XY) 균일 격자 공간 해시 (CombatRegistry 서브시스템에서 사용).
+// - 항목은 고정 ItemId로 관리되며, 위치 갱신 시 셀이 바뀐 경우에만 셀 목록을 수정합니다.
+// - 반경 / 원뿔(락온 시야각) / K-최근접 조회를 지원하고, 조회 비용은 월드 전체가 아니라
+//   조회 범위 안의 셀에 있는 항목 수에 비례합니다.
+// - 결과는 항목 등록 시 넘긴 UserIndex(등록부의 엔트리 인덱스)로 돌려줍니다.
+// - 벤치마크: 콘솔 Mecha.CombatRegistry.BenchSpatial [조회 수] (비 Shipping 빌드)
+
+class PROJECT_MECHA_API FMechaSpatialHash
+{
+public:
+    // 조회 필터 (UserIndex → 포함 여부)
+    using FFilter = TFunctionRef<bool(int32 /*UserIndex*/)>;
+
+    explicit FMechaSpatialHash(float InCellSize = 2500.f);
+
+    // 모든 항목 제거 후 셀 크기 변경
+    void Reset(float InCellSize);
+
+    // ===== 항목 관리 =====
+    int32 Add(const FVector& Location, int32 UserIndex);
+    void Remove(int32 ItemId);
+
+    // 위치 갱신. 셀이 바뀐 경우에만 셀 목록 수정 (바뀌었으면 true)
+    bool Update(int32 ItemId, const FVector& NewLocation);
+
+    // 등록부에서 스왑 삭제로 인덱스가 바뀌었을 때 호출
+    void SetUserIndex(int32 ItemId, int32 UserIndex);
+
+    int32 Num() const { return Items.Num(); }
+    float GetCellSize() const { return CellSize; }
+
+    // ===== 조회 (결과: UserIndex) =====
+    // Origin에서 Radius 이내
+    void QueryRadius(const FVector& Origin, float Radius, TArray<int32>& OutUserIndices, FFilter Filter) const;
+
+    // Radius 이내이면서 Direction(단위 벡터)과의 각도 cos 값이 CosHalfAngle 이상
+    void QueryCone(const FVector& Origin, const FVector& Direction, float Radius, float CosHalfAngle, TArray<int32>& OutUserIndices, FFilter Filter) const;
+
+    // 가까운 순서로 최대 K개 (MaxRadius <= 0이면 거리 제한 없음)
+    void QueryKNearest(const FVector& Origin, int32 K, float MaxRadius, TArray<int32>& OutUserIndices, FFilter Filter) const;
+
+private:
+    struct FItem
+    {
+        FVector Location = FVector::ZeroVector;
+        FIntPoint Cell = FIntPoint::ZeroValue;
+        int32 UserIndex = INDEX_NONE;
+    };
+
+    float CellSize = 2500.f;
+    float InvCellSize = 1.f / 2500.f;
+
+    TSparseArray<FItem> Items;
+
+    // 셀 좌표 → ItemId 목록
+    TMap<FIntPoint, TArray<int32>> Cells;
+
+    FIntPoint ToCell(const FVector& Location) const;
+    void AddToCell(const FIntPoint& Cell, int32 ItemId);
+    void RemoveFromCell(const FIntPoint& Cell, int32 ItemId);
+
+    // [Min, Max] 셀 범위의 비어 있지 않은 셀마다 Visitor(ItemIds) 호출
+    template <typename VisitorType>
+    void ForEachCellInRange(const FIntPoint& Min, const FIntPoint& Max, VisitorType&& Visitor) const;
+};
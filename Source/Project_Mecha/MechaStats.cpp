@@ -0,0 +1,62 @@
+// MechaStats.cpp
+// 모듈 공용 사이클 카운터 정의 및 Insights 능력 이벤트 기록
+
+#include "MechaStats.h"
+
+#include "Abilities/GameplayAbility.h"
+
+DEFINE_STAT(STAT_Mecha_ProjectileSpawn);
+DEFINE_STAT(STAT_Mecha_PoolAcquire);
+DEFINE_STAT(STAT_Mecha_SimSpawn);
+DEFINE_STAT(STAT_Mecha_TargetQuery);
+DEFINE_STAT(STAT_Mecha_LockOnQuery);
+DEFINE_STAT(STAT_Mecha_AimQuery);
+DEFINE_STAT(STAT_Mecha_HUDUpdate);
+DEFINE_STAT(STAT_Mecha_AITick);
+
+UE_TRACE_CHANNEL_DEFINE(MechaChannel)
+
+// 능력 함수 호출 1회 (Phase: 0 = Activate, 1 = End)
+UE_TRACE_EVENT_BEGIN(Mecha, AbilityScope)
+	UE_TRACE_EVENT_FIELD(uint64, StartCycle)
+	UE_TRACE_EVENT_FIELD(uint64, EndCycle)
+	UE_TRACE_EVENT_FIELD(uint8, Phase)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Ability)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Owner)
+UE_TRACE_EVENT_END()
+
+// ========================================
+// 능력 트레이스 스코프
+// ========================================
+FMechaAbilityTraceScope::FMechaAbilityTraceScope(const UGameplayAbility* Ability, const FGameplayAbilityActorInfo* ActorInfo, EMechaAbilityTracePhase InPhase)
+	: Phase(InPhase)
+{
+	// 채널이 꺼져 있으면 이름 문자열도 만들지 않음
+	bEnabled = UE_TRACE_CHANNELEXPR_IS_ENABLED(MechaChannel);
+	if (!bEnabled)
+	{
+		return;
+	}
+
+	AbilityName = Ability ? Ability->GetClass()->GetName() : FString();
+
+	const AActor* Owner = (ActorInfo && ActorInfo->AvatarActor.IsValid()) ? ActorInfo->AvatarActor.Get() : nullptr;
+	OwnerName = Owner ? Owner->GetName() : FString();
+
+	StartCycle = FPlatformTime::Cycles64();
+}
+
+FMechaAbilityTraceScope::~FMechaAbilityTraceScope()
+{
+	if (!bEnabled)
+	{
+		return;
+	}
+
+	UE_TRACE_LOG(Mecha, AbilityScope, MechaChannel)
+		<< AbilityScope.StartCycle(StartCycle)
+		<< AbilityScope.EndCycle(FPlatformTime::Cycles64())
+		<< AbilityScope.Phase((uint8)Phase)
+		<< AbilityScope.Ability(*AbilityName, AbilityName.Len())
+		<< AbilityScope.Owner(*OwnerName, OwnerName.Len());
+}
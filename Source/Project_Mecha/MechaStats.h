@@ -0,0 +1,58 @@
+// MechaStats.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+// 설명:
+// - 모듈 공용 성능 계측 (stat Mecha / Unreal Insights).
+// - STATGROUP_Mecha: 능력 활성화/종료(능력별), 투사체 스폰, 타겟 조회, HUD 갱신, AI 틱 사이클 카운터.
+//   능력별 카운터는 각 GA_*.cpp에서 DECLARE_CYCLE_STAT으로 선언하고 MECHA_ABILITY_SCOPE로 감쌉니다.
+// - Insights 채널 "Mecha": 능력 ActivateAbility/EndAbility 호출마다 능력 이름, 소유 액터, 시작/끝 사이클을
+//   Mecha.AbilityScope 이벤트로 남깁니다. 캡처 시 -trace=cpu,frame,mecha 로 채널을 켭니다.
+
+class UGameplayAbility;
+struct FGameplayAbilityActorInfo;
+
+// ===== Stat Group =====
+DECLARE_STATS_GROUP(TEXT("Mecha"), STATGROUP_Mecha, STATCAT_Advanced);
+
+// ===== 공용 카운터 =====
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Projectile Spawn"), STAT_Mecha_ProjectileSpawn, STATGROUP_Mecha, PROJECT_MECHA_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Pool Acquire"), STAT_Mecha_PoolAcquire, STATGROUP_Mecha, PROJECT_MECHA_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Sim Projectile Spawn"), STAT_Mecha_SimSpawn, STATGROUP_Mecha, PROJECT_MECHA_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Target Query"), STAT_Mecha_TargetQuery, STATGROUP_Mecha, PROJECT_MECHA_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("LockOn Query"), STAT_Mecha_LockOnQuery, STATGROUP_Mecha, PROJECT_MECHA_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Aim Query"), STAT_Mecha_AimQuery, STATGROUP_Mecha, PROJECT_MECHA_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("HUD Update"), STAT_Mecha_HUDUpdate, STATGROUP_Mecha, PROJECT_MECHA_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AI Tick"), STAT_Mecha_AITick, STATGROUP_Mecha, PROJECT_MECHA_API);
+
+// ===== Insights 채널 =====
+UE_TRACE_CHANNEL_EXTERN(MechaChannel, PROJECT_MECHA_API);
+
+enum class EMechaAbilityTracePhase : uint8
+{
+    Activate,
+    End
+};
+
+// 능력 함수 한 번의 호출 구간을 Insights 이벤트로 기록 (채널이 꺼져 있으면 아무것도 하지 않음)
+class PROJECT_MECHA_API FMechaAbilityTraceScope
+{
+public:
+    FMechaAbilityTraceScope(const UGameplayAbility* Ability, const FGameplayAbilityActorInfo* ActorInfo, EMechaAbilityTracePhase InPhase);
+    ~FMechaAbilityTraceScope();
+
+private:
+    uint64 StartCycle = 0;
+    EMechaAbilityTracePhase Phase;
+    bool bEnabled = false;
+
+    FString AbilityName;
+    FString OwnerName;
+};
+
+// ActivateAbility / EndAbility 첫 줄에서 사용 (사이클 카운터 + Insights 이벤트)
+#define MECHA_ABILITY_SCOPE(StatId, TracePhase) \
+    SCOPE_CYCLE_COUNTER(StatId); \
+    FMechaAbilityTraceScope PREPROCESSOR_JOIN(MechaAbilityTraceScope_, __LINE__)(this, ActorInfo, EMechaAbilityTracePhase::TracePhase)
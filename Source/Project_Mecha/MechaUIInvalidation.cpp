@@ -0,0 +1,92 @@
+// MechaUIInvalidation.cpp
+// HUD 위젯 Slate 캐싱 - 루트 InvalidationBox 감싸기, 계속 변하는 위젯만 volatile 처리
+
+#include "MechaUIInvalidation.h"
+
+#include "Blueprint/UserWidget.h"
+#include "Blueprint/WidgetTree.h"
+#include "Components/InvalidationBox.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarMechaUIInvalidation(
+	TEXT("Mecha.UI.Invalidation"),
+	1,
+	TEXT("1이면 플레이어 HUD/보스 체력바 루트를 InvalidationBox로 감싸 바뀐 위젯만 다시 그립니다. 0이면 매 프레임 전체를 그립니다 (이후 생성되는 위젯부터 적용)."));
+
+static int32 GMechaUINumWrappedRoots = 0;
+static int32 GMechaUINumUnwrappedRoots = 0;
+
+bool FMechaUIInvalidation::IsEnabled()
+{
+	return CVarMechaUIInvalidation.GetValueOnGameThread() != 0;
+}
+
+void FMechaUIInvalidation::SetEnabled(bool bEnabled)
+{
+	CVarMechaUIInvalidation->Set(bEnabled ? 1 : 0, ECVF_SetByCommandline);
+}
+
+int32 FMechaUIInvalidation::GetNumWrappedRoots()
+{
+	return GMechaUINumWrappedRoots;
+}
+
+int32 FMechaUIInvalidation::GetNumUnwrappedRoots()
+{
+	return GMechaUINumUnwrappedRoots;
+}
+
+void FMechaUIInvalidation::ResetCounters()
+{
+	GMechaUINumWrappedRoots = 0;
+	GMechaUINumUnwrappedRoots = 0;
+}
+
+// ========================================
+// 루트 감싸기
+// ========================================
+void FMechaUIInvalidation::WrapRoot(UUserWidget& Widget)
+{
+	if (Widget.IsDesignTime())
+	{
+		return;
+	}
+
+	UWidgetTree* WidgetTree = Widget.WidgetTree;
+	UWidget* OldRoot = WidgetTree ? WidgetTree->RootWidget : nullptr;
+	if (!OldRoot)
+	{
+		return;
+	}
+
+	if (OldRoot->IsA<UInvalidationBox>())
+	{
+		++GMechaUINumWrappedRoots;
+		return;
+	}
+
+	if (!IsEnabled())
+	{
+		++GMechaUINumUnwrappedRoots;
+		return;
+	}
+
+	UInvalidationBox* Box = WidgetTree->ConstructWidget<UInvalidationBox>(UInvalidationBox::StaticClass(), TEXT("MechaInvalidationRoot"));
+	Box->SetCanCache(true);
+	Box->SetContent(OldRoot);
+	WidgetTree->RootWidget = Box;
+	++GMechaUINumWrappedRoots;
+}
+
+// ========================================
+// volatile 전환
+// ========================================
+void FMechaUIInvalidation::SetVolatile(UWidget* Widget, bool bVolatile)
+{
+	if (!Widget)
+	{
+		return;
+	}
+
+	Widget->ForceVolatile(bVolatile);
+}
@@ -0,0 +1,34 @@
+// MechaUIInvalidation.h
+#pragma once
+
+#include "CoreMinimal.h"
+// 설명:
+// - HUD 위젯 Slate 캐싱. 위젯 루트를 UInvalidationBox로 감싸서, 값이 바뀌지 않은 프레임에는
+//   배치/그리기를 다시 하지 않고 캐시된 결과를 씁니다.
+//   - 체력/에너지 바(SetPercent), 탄약 텍스트(SetText)는 값이 바뀔 때 자기 자신만 무효화하므로 그 부분만 다시 그립니다.
+//   - 계속 변하는 위젯(경고 깜빡임 등)은 SetVolatile로 재생 중에만 캐시에서 빼서 트리 전체가 무효화되지 않게 합니다.
+// - 위젯 클래스의 RebuildWidget에서 WrapRoot를 호출합니다 (디자이너 미리보기는 감싸지 않음).
+// - Mecha.UI.Invalidation 0 으로 끌 수 있습니다 (이후 생성되는 위젯부터, 벤치마크 전후 비교용).
+//   HUD는 맵 로드 중 폰 BeginPlay에서 만들어지므로 처음부터 끄려면 -dpcvars=Mecha.UI.Invalidation=0
+//   또는 벤치마크의 -MechaBenchNoUIInvalidation을 씁니다 (-ExecCmds는 첫 틱에 실행되어 늦음).
+// - 실제로 감싼/감싸지 않은 루트 수를 세어 벤치마크 리포트에 남깁니다.
+
+class UUserWidget;
+class UWidget;
+
+struct PROJECT_MECHA_API FMechaUIInvalidation
+{
+    static bool IsEnabled();
+    static void SetEnabled(bool bEnabled);
+
+    // WrapRoot 결과 집계 (감쌌거나 이미 감싸져 있음 / 꺼져 있어서 그대로 둠)
+    static int32 GetNumWrappedRoots();
+    static int32 GetNumUnwrappedRoots();
+    static void ResetCounters();
+
+    // 위젯 트리 루트를 캐싱 InvalidationBox로 한 번 감쌈 (이미 감싸져 있으면 무시)
+    static void WrapRoot(UUserWidget& Widget);
+
+    // 매 프레임 바뀌는 위젯을 캐시에서 제외/복귀
+    static void SetVolatile(UWidget* Widget, bool bVolatile);
+};
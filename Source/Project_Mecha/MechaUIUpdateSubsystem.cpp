@@ -0,0 +1,95 @@
+// MechaUIUpdateSubsystem.cpp
+// HUD 갱신 합치기 - 위젯당 프레임 1회 갱신 예약/실행
+
+#include "MechaUIUpdateSubsystem.h"
+#include "MechaStats.h"
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("UI Update Requests"), STAT_Mecha_UIUpdateRequests, STATGROUP_Mecha);
+DECLARE_DWORD_COUNTER_STAT(TEXT("UI Updates Flushed"), STAT_Mecha_UIUpdatesFlushed, STATGROUP_Mecha);
+
+// ========================================
+// 접근자
+// ========================================
+UMechaUIUpdateSubsystem* UMechaUIUpdateSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine || !WorldContextObject) return nullptr;
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UMechaUIUpdateSubsystem>() : nullptr;
+}
+
+bool UMechaUIUpdateSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UMechaUIUpdateSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMechaUIUpdateSubsystem, STATGROUP_Tickables);
+}
+
+void UMechaUIUpdateSubsystem::Deinitialize()
+{
+	Pending.Empty();
+	PendingOwners.Empty();
+	Flushing.Empty();
+
+	Super::Deinitialize();
+}
+
+// ========================================
+// 예약
+// ========================================
+void UMechaUIUpdateSubsystem::Schedule(UObject* Owner, TFunction<void()>&& Flush)
+{
+	if (!Owner || !Flush)
+	{
+		return;
+	}
+
+	UMechaUIUpdateSubsystem* Subsystem = Get(Owner);
+	if (!Subsystem)
+	{
+		Flush();
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_Mecha_UIUpdateRequests);
+
+	bool bAlreadyPending = false;
+	Subsystem->PendingOwners.Add(Owner, &bAlreadyPending);
+	if (!bAlreadyPending)
+	{
+		Subsystem->Pending.Add({ Owner, MoveTemp(Flush) });
+	}
+}
+
+// ========================================
+// 매 프레임 - 예약된 갱신 실행
+// ========================================
+void UMechaUIUpdateSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (Pending.Num() == 0)
+	{
+		return;
+	}
+
+	Swap(Flushing, Pending);
+	PendingOwners.Reset();
+
+	for (FPendingFlush& Entry : Flushing)
+	{
+		if (Entry.Owner.IsValid())
+		{
+			Entry.Flush();
+		}
+	}
+
+	SET_DWORD_STAT(STAT_Mecha_UIUpdatesFlushed, Flushing.Num());
+	Flushing.Reset();
+}
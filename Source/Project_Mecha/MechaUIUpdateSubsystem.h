@@ -0,0 +1,46 @@
+// MechaUIUpdateSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+// 설명:
+// - HUD 갱신 합치기. 미사일 다단히트/도트처럼 한 프레임에 Attribute 변경이 여러 번 와도
+//   위젯당 한 번만 UI를 갱신하도록, 위젯은 Schedule로 갱신 함수를 예약하고 값은 자기 멤버에 최신으로만 보관합니다.
+// - 예약은 위젯(Owner)당 프레임에 하나. 월드 틱 끝(액터/네트워크 처리 후, Slate 그리기 전)에 한 번 실행합니다.
+// - 일시정지 중에도 실행합니다 (게임 오버 화면 등).
+// - 월드가 없는 경우(디자이너 미리보기 등)는 바로 실행합니다.
+#include "MechaUIUpdateSubsystem.generated.h"
+
+UCLASS()
+class PROJECT_MECHA_API UMechaUIUpdateSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    static UMechaUIUpdateSubsystem* Get(const UObject* WorldContextObject);
+
+    // Owner의 갱신을 이번 프레임 끝에 한 번 실행 (이미 예약돼 있으면 무시)
+    static void Schedule(UObject* Owner, TFunction<void()>&& Flush);
+
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+    virtual bool IsTickableWhenPaused() const override { return true; }
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    struct FPendingFlush
+    {
+        TWeakObjectPtr<UObject> Owner;
+        TFunction<void()> Flush;
+    };
+
+    TArray<FPendingFlush> Pending;
+    TSet<TObjectKey<UObject>> PendingOwners;
+
+    // Flush 중에 들어온 예약은 다음 프레임으로
+    TArray<FPendingFlush> Flushing;
+};
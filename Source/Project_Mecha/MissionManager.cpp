@@ -3,7 +3,9 @@
 
 #include "MissionManager.h"
 #include "EnemyMecha.h"
+#include "MechaCombatRegistrySubsystem.h"
 #include "Engine/World.h"
+#include "Net/UnrealNetwork.h"
 
 // ========================================
 // 생성자
@@ -11,6 +13,48 @@
 AMissionManager::AMissionManager()
 {
 	PrimaryActorTick.bCanEverTick = false;
+
+	// 모든 클라이언트가 진행도를 알아야 하므로 항상 관련
+	bReplicates = true;
+	bAlwaysRelevant = true;
+	// 값이 바뀔 때 ForceNetUpdate로 즉시 보내므로 평소 갱신은 드물게
+	NetUpdateFrequency = 2.f;
+}
+
+void AMissionManager::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(AMissionManager, CurrentKillCount);
+	DOREPLIFETIME(AMissionManager, bMissionActive);
+	DOREPLIFETIME(AMissionManager, BossInstance);
+	DOREPLIFETIME(AMissionManager, bBossPhaseStarted);
+	DOREPLIFETIME(AMissionManager, bBossDefeated);
+	DOREPLIFETIME(AMissionManager, MissionStartTime);
+	DOREPLIFETIME(AMissionManager, MissionEndTime);
+}
+
+// ========================================
+// BeginPlay / EndPlay - 전투 등록부에 등록 (적이 월드 검색 없이 찾도록)
+// ========================================
+void AMissionManager::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (UMechaCombatRegistrySubsystem* Registry = UMechaCombatRegistrySubsystem::Get(this))
+	{
+		Registry->RegisterMissionManager(this);
+	}
+}
+
+void AMissionManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UMechaCombatRegistrySubsystem* Registry = UMechaCombatRegistrySubsystem::Get(this))
+	{
+		Registry->UnregisterMissionManager(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 // ========================================
@@ -18,6 +62,11 @@ AMissionManager::AMissionManager()
 // ========================================
 void AMissionManager::StartMission()
 {
+	if (!HasAuthority())
+	{
+		return;
+	}
+
 	// 카운터 초기화
 	CurrentKillCount = 0;
 	bMissionActive = true;
@@ -28,6 +77,7 @@ void AMissionManager::StartMission()
 	// 시간 기록
 	MissionStartTime = GetWorld()->GetTimeSeconds();
 	MissionEndTime = 0.f;
+	ForceNetUpdate();
 
 	// 블루프린트 이벤트 호출
 	OnMissionStartedBP(RequiredKillCount);
@@ -38,14 +88,15 @@ void AMissionManager::StartMission()
 // ========================================
 void AMissionManager::NotifyEnemyKilled(AEnemyMecha* KilledEnemy)
 {
-	// 미션 활성화 상태에서만 처리
-	if (!bMissionActive)
+	// 서버에서, 미션 활성화 상태에서만 처리
+	if (!HasAuthority() || !bMissionActive)
 	{
 		return;
 	}
 
 	// 킬 카운트 증가
 	++CurrentKillCount;
+	ForceNetUpdate();
 
 	// 진행도 업데이트 이벤트
 	OnMissionProgressBP(CurrentKillCount, RequiredKillCount);
@@ -79,8 +130,8 @@ void AMissionManager::StartBossPhase()
 // ========================================
 void AMissionManager::NotifyBossDefeated(AEnemyMecha* DefeatedBoss)
 {
-	// 등록된 보스가 아니면 무시
-	if (DefeatedBoss != BossInstance)
+	// 서버가 아니거나 등록된 보스가 아니면 무시
+	if (!HasAuthority() || DefeatedBoss != BossInstance)
 	{
 		return;
 	}
@@ -95,7 +146,24 @@ void AMissionManager::NotifyBossDefeated(AEnemyMecha* DefeatedBoss)
 	bBossDefeated = true;
 	bMissionActive = false;
 	MissionEndTime = GetWorld()->GetTimeSeconds();
+	ForceNetUpdate();
 
 	// 블루프린트 이벤트 호출 (승리 화면, 보상 지급 등)
 	OnMissionClearedBP();
 }
+
+// ========================================
+// 복제 콜백 (클라이언트)
+// ========================================
+void AMissionManager::OnRep_CurrentKillCount()
+{
+	OnMissionProgressBP(CurrentKillCount, RequiredKillCount);
+}
+
+void AMissionManager::OnRep_bBossDefeated()
+{
+	if (bBossDefeated)
+	{
+		OnMissionClearedBP();
+	}
+}
@@ -21,10 +21,11 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mission")
     int32 RequiredKillCount = 10;
 
-    UPROPERTY(BlueprintReadOnly, Category = "Mission")
+    // 진행 상태는 서버가 바꾸고 클라이언트로 복제 (bAlwaysRelevant)
+    UPROPERTY(ReplicatedUsing = OnRep_CurrentKillCount, BlueprintReadOnly, Category = "Mission")
     int32 CurrentKillCount = 0;
 
-    UPROPERTY(BlueprintReadOnly, Category = "Mission")
+    UPROPERTY(Replicated, BlueprintReadOnly, Category = "Mission")
     bool bMissionActive = false;
 
     // === 보스 페이즈 설정 ===
@@ -34,19 +35,20 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Boss")
     AActor* BossSpawnPoint = nullptr;
 
-    UPROPERTY(BlueprintReadWrite, Category = "Boss")
+    UPROPERTY(Replicated, BlueprintReadWrite, Category = "Boss")
     AEnemyMecha* BossInstance = nullptr;
 
-    UPROPERTY(BlueprintReadOnly, Category = "Boss")
+    UPROPERTY(Replicated, BlueprintReadOnly, Category = "Boss")
     bool bBossPhaseStarted = false;
 
-    UPROPERTY(BlueprintReadOnly, Category = "Boss")
+    UPROPERTY(ReplicatedUsing = OnRep_bBossDefeated, BlueprintReadOnly, Category = "Boss")
     bool bBossDefeated = false;
 
     // === 미션 함수 ===
     UFUNCTION(BlueprintCallable, Category = "Mission")
     void StartMission();
 
+    // 군중(Mass) 개체가 액터 없이 죽으면 KilledEnemy는 nullptr
     UFUNCTION(BlueprintCallable, Category = "Mission")
     void NotifyEnemyKilled(AEnemyMecha* KilledEnemy);
 
@@ -62,10 +64,27 @@ public:
             : 0.f;
     }
 
+    virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
 protected:
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+    // 서버 시간 기준 (클리어 시간은 두 값의 차이만 사용)
+    UPROPERTY(Replicated)
     float MissionStartTime = 0.f;
+
+    UPROPERTY(Replicated)
     float MissionEndTime = 0.f;
 
+    // 클라이언트: 진행도/클리어 UI 이벤트만 다시 호출
+    // (미션 시작/보스 페이즈 BP 이벤트는 스폰을 하므로 서버에서만 호출)
+    UFUNCTION()
+    void OnRep_CurrentKillCount();
+
+    UFUNCTION()
+    void OnRep_bBossDefeated();
+
     // === 내부: 보스 페이즈 시작 ===
     void StartBossPhase();
 
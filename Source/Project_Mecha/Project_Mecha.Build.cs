@@ -8,9 +8,10 @@ public class Project_Mecha : ModuleRules
 
         PublicDependencyModuleNames.AddRange(new string[] {
             "Core","CoreUObject","Engine","InputCore","EnhancedInput",
-            "GameplayAbilities","GameplayTasks","GameplayTags", "UMG", "Slate", "SlateCore"
+            "GameplayAbilities","GameplayTasks","GameplayTags", "UMG", "Slate", "SlateCore",
+            "NetCore", "ReplicationGraph", "MassEntity", "MassCommon"
         });
 
-        PrivateDependencyModuleNames.AddRange(new string[] { });
+        PrivateDependencyModuleNames.AddRange(new string[] { "TraceLog", "Json", "RenderCore" });
     }
 }
@@ -4,7 +4,23 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Project_Mecha.h"
+#include "MechaNativeTags.h"
 #include "Modules/ModuleManager.h"
 
+DEFINE_LOG_CATEGORY(LogMecha);
+
+// 게임 모듈 - 시작 시 네이티브 태그 검증
+class FProjectMechaModule : public FDefaultGameModuleImpl
+{
+public:
+	virtual void StartupModule() override
+	{
+		FDefaultGameModuleImpl::StartupModule();
+
+		// DefaultGameplayTags.ini의 태그가 모두 MechaTags에 선언되어 있는지 확인
+		FMechaNativeTags::ValidateAgainstConfig();
+	}
+};
+
 // 주 게임 모듈 구현
-IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, Project_Mecha, "Project_Mecha" );
+IMPLEMENT_PRIMARY_GAME_MODULE( FProjectMechaModule, Project_Mecha, "Project_Mecha" );
@@ -3,3 +3,6 @@
 #pragma once
 
 #include "CoreMinimal.h"
+
+// 모듈 공용 로그 카테고리
+PROJECT_MECHA_API DECLARE_LOG_CATEGORY_EXTERN(LogMecha, Log, All);
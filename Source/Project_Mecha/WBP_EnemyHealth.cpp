@@ -2,6 +2,8 @@
 // 적 체력바 위젯 - 월드 스페이스 체력바
 
 #include "WBP_EnemyHealth.h"
+#include "MechaStats.h"
+#include "MechaUIUpdateSubsystem.h"
 #include "AbilitySystemComponent.h"
 #include "MechaAttributeSet.h"
 #include "Components/ProgressBar.h"
@@ -18,6 +20,7 @@ void UWBP_EnemyHealth::InitWithASC(UAbilitySystemComponent* InASC, const UMechaA
 	// 델리게이트 바인딩
 	UnbindHealth();
 	BindHealth();
+	HealthText.Invalidate();
 	RefreshOnce();  // 초기값 즉시 반영
 }
 
@@ -71,6 +74,8 @@ void UWBP_EnemyHealth::RefreshOnce() const
 // ========================================
 void UWBP_EnemyHealth::ApplyHealthToUI(float Health, float MaxHealth) const
 {
+	SCOPE_CYCLE_COUNTER(STAT_Mecha_HUDUpdate);
+
 	const float Ratio = (MaxHealth > 0.f) ? (Health / MaxHealth) : 0.f;
 
 	// ========== 체력바 ==========
@@ -83,12 +88,7 @@ void UWBP_EnemyHealth::ApplyHealthToUI(float Health, float MaxHealth) const
 	}
 
 	// ========== 체력 텍스트 ==========
-	if (TxtHealth)
-	{
-		const int32 H = FMath::RoundToInt(Health);
-		const int32 M = FMath::RoundToInt(MaxHealth);
-		TxtHealth->SetText(FText::FromString(FString::Printf(TEXT("%d / %d"), H, M)));
-	}
+	HealthText.SetRatio(TxtHealth, FMath::RoundToInt(Health), FMath::RoundToInt(MaxHealth));
 }
 
 // ========================================
@@ -97,8 +97,7 @@ void UWBP_EnemyHealth::ApplyHealthToUI(float Health, float MaxHealth) const
 void UWBP_EnemyHealth::OnHealthChanged(const FOnAttributeChangeData& Data)
 {
 	if (!ASC) return;
-	
-	const float H = Data.NewValue;
-	const float M = ASC->GetNumericAttribute(UMechaAttributeSet::GetMaxHealthAttribute());
-	ApplyHealthToUI(H, M);
+
+	// 같은 프레임의 여러 변경은 ASC 최신 값으로 한 번만 반영
+	UMechaUIUpdateSubsystem::Schedule(this, [this]() { RefreshOnce(); });
 }
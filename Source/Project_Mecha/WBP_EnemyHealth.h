@@ -1,6 +1,7 @@
 #pragma once
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "MechaNumericText.h"
 #include "WBP_EnemyHealth.generated.h"
 
 class UProgressBar;
@@ -47,4 +48,7 @@ private:
     void ApplyHealthToUI(float Health, float MaxHealth) const;
 
     void OnHealthChanged(const struct FOnAttributeChangeData& Data);
+
+    // 값이 바뀔 때만 SetText
+    mutable FMechaNumericText HealthText;
 };
@@ -2,6 +2,10 @@
 // 플레이어 HUD 위젯 - 에너지, 체력, 탄약 표시
 
 #include "WBP_MechaHUD.h"
+#include "MechaStats.h"
+#include "Project_Mecha.h"
+#include "MechaAttributeObserverComponent.h"
+#include "MechaUIInvalidation.h"
 #include "AbilitySystemComponent.h"
 #include "MechaAttributeSet.h"
 #include "Components/ProgressBar.h"
@@ -18,10 +22,17 @@ void UWBP_MechaHUD::InitWithASC(UAbilitySystemComponent* InASC, const UMechaAttr
 	// 에너지 바인딩은 블루프린트에서 처리 (기존 흐름 유지)
 	BP_BindAttributeListeners();
 
-	// ========== 탄약 바인딩 ==========
-	UnbindAmmoListeners();   // 중복 방지
-	BindAmmoListeners();
-	RefreshAmmoOnce();       // 초기값 즉시 표시
+	// ========== 체력/탄약: Attribute 관찰 컴포넌트 구독 ==========
+	UnbindAttributeObserver();   // 중복 방지
+	BindAttributeObserver();
+	AmmoMagText.Invalidate();
+	AmmoReserveText.Invalidate();
+
+	// 초기값 즉시 표시
+	if (UMechaAttributeObserverComponent* Observer = AttributeObserver.Get())
+	{
+		OnAttributesFlushed(Observer->ReadSnapshot());
+	}
 }
 
 // ========================================
@@ -29,6 +40,8 @@ void UWBP_MechaHUD::InitWithASC(UAbilitySystemComponent* InASC, const UMechaAttr
 // ========================================
 void UWBP_MechaHUD::SetEnergyPercent(float Ratio)
 {
+	SCOPE_CYCLE_COUNTER(STAT_Mecha_HUDUpdate);
+
 	if (!PB_Energy) return;
 
 	PB_Energy->SetPercent(Ratio);
@@ -47,6 +60,8 @@ void UWBP_MechaHUD::SetEnergyPercent(float Ratio)
 // ========================================
 void UWBP_MechaHUD::SetHealthPercent(float InPercent)
 {
+	SCOPE_CYCLE_COUNTER(STAT_Mecha_HUDUpdate);
+
 	if (!PB_Health) return;
 
 	const float Clamped = FMath::Clamp(InPercent, 0.f, 1.f);
@@ -61,136 +76,137 @@ void UWBP_MechaHUD::SetHealthPercent(float InPercent)
 	PB_Health->SetFillColorAndOpacity(HPColor);
 
 	// ========== LOW HP 경고 표시 ==========
-	if (Txt_LowHPWarning)
+	// 경고 임계값(기본 0.3) 이하면 경고 표시
+	SetLowHPWarningActive(Clamped <= HealthWarningThreshold);
+}
+
+// ========================================
+// 저체력 경고 on/off (상태가 바뀔 때만)
+// ========================================
+void UWBP_MechaHUD::SetLowHPWarningActive(bool bActive)
+{
+	if (!Txt_LowHPWarning)
+	{
+		return;
+	}
+
+	const ESlateVisibility WantedVisibility = bActive ? ESlateVisibility::Visible : ESlateVisibility::Hidden;
+	if (bActive == bLowHPWarningActive && Txt_LowHPWarning->GetVisibility() == WantedVisibility)
 	{
-		const float WarningThresholdHP = HealthWarningThreshold;  // 기본 0.3
+		return;
+	}
+	bLowHPWarningActive = bActive;
+
+	// 깜빡이는 동안만 경고 텍스트를 캐시에서 빼서 나머지 HUD는 캐시 유지
+	FMechaUIInvalidation::SetVolatile(Txt_LowHPWarning, bActive);
+
+	if (bActive)
+	{
+		Txt_LowHPWarning->SetVisibility(WantedVisibility);
 
-		// 경고 임계값 이하면 경고 표시
-		if (Clamped <= WarningThresholdHP)
+		// 깜빡이는 애니메이션 재생
+		if (LowHP_WarningPulse)
 		{
-			Txt_LowHPWarning->SetVisibility(ESlateVisibility::Visible);
-			
-			// 깜빡이는 애니메이션 재생
-			if (LowHP_WarningPulse)
-			{
-				PlayAnimation(LowHP_WarningPulse, 0.f, 0);  // 무한 루프
-			}
+			PlayAnimation(LowHP_WarningPulse, 0.f, 0);  // 무한 루프
 		}
-		else
+	}
+	else
+	{
+		// 경고 해제
+		if (LowHP_WarningPulse)
 		{
-			// 경고 해제
-			if (LowHP_WarningPulse)
-			{
-				StopAnimation(LowHP_WarningPulse);
-			}
-			Txt_LowHPWarning->SetVisibility(ESlateVisibility::Hidden);
+			StopAnimation(LowHP_WarningPulse);
 		}
+		Txt_LowHPWarning->SetVisibility(WantedVisibility);
 	}
 }
 
 // ========================================
-// 탄약 Attribute 리스너 바인딩
+// Attribute 관찰 컴포넌트 구독 / 해제
 // ========================================
-void UWBP_MechaHUD::BindAmmoListeners()
+void UWBP_MechaHUD::BindAttributeObserver()
 {
-	if (!ASC) return;
-
-	// 탄창 변경 감지
-	HandleMag = ASC->GetGameplayAttributeValueChangeDelegate(
-		UMechaAttributeSet::GetAmmoMagazineAttribute())
-		.AddUObject(this, &UWBP_MechaHUD::OnMagChanged);
-
-	// 최대 탄창 변경 감지
-	HandleMaxMag = ASC->GetGameplayAttributeValueChangeDelegate(
-		UMechaAttributeSet::GetMaxMagazineAttribute())
-		.AddUObject(this, &UWBP_MechaHUD::OnMaxMagChanged);
-
-	// 예비탄 변경 감지
-	HandleReserve = ASC->GetGameplayAttributeValueChangeDelegate(
-		UMechaAttributeSet::GetAmmoReserveAttribute())
-		.AddUObject(this, &UWBP_MechaHUD::OnReserveChanged);
+	AActor* Owner = ASC ? ASC->GetOwner() : nullptr;
+	UMechaAttributeObserverComponent* Observer =
+		Owner ? Owner->FindComponentByClass<UMechaAttributeObserverComponent>() : nullptr;
+	if (!Observer)
+	{
+		UE_LOG(LogMecha, Warning, TEXT("WBP_MechaHUD: %s에 AttributeObserver가 없어 체력/탄약 자동 갱신을 하지 않습니다."),
+			*GetNameSafe(Owner));
+		return;
+	}
+
+	AttributeObserver = Observer;
+	AttributesFlushedHandle = Observer->OnAttributesFlushedNative.AddUObject(this, &UWBP_MechaHUD::OnAttributesFlushed);
 }
 
-// ========================================
-// 탄약 Attribute 리스너 해제
-// ========================================
-void UWBP_MechaHUD::UnbindAmmoListeners()
+void UWBP_MechaHUD::UnbindAttributeObserver()
 {
-	if (!ASC) return;
-
-	ASC->GetGameplayAttributeValueChangeDelegate(
-		UMechaAttributeSet::GetAmmoMagazineAttribute()).Remove(HandleMag);
-	ASC->GetGameplayAttributeValueChangeDelegate(
-		UMechaAttributeSet::GetMaxMagazineAttribute()).Remove(HandleMaxMag);
-	ASC->GetGameplayAttributeValueChangeDelegate(
-		UMechaAttributeSet::GetAmmoReserveAttribute()).Remove(HandleReserve);
-
-	HandleMag.Reset();
-	HandleMaxMag.Reset();
-	HandleReserve.Reset();
+	if (UMechaAttributeObserverComponent* Observer = AttributeObserver.Get())
+	{
+		Observer->OnAttributesFlushedNative.Remove(AttributesFlushedHandle);
+	}
+
+	AttributeObserver.Reset();
+	AttributesFlushedHandle.Reset();
+}
+
+void UWBP_MechaHUD::NativeDestruct()
+{
+	UnbindAttributeObserver();
+
+	Super::NativeDestruct();
 }
 
 // ========================================
-// 초기 탄약 값 표시
+// Slate 생성 - 루트를 InvalidationBox로 감쌈
 // ========================================
-void UWBP_MechaHUD::RefreshAmmoOnce() const
+TSharedRef<SWidget> UWBP_MechaHUD::RebuildWidget()
 {
-	if (!ASC) return;
-
-	const int32 Mag = FMath::RoundToInt(ASC->GetNumericAttribute(UMechaAttributeSet::GetAmmoMagazineAttribute()));
-	const int32 MaxMag = FMath::RoundToInt(ASC->GetNumericAttribute(UMechaAttributeSet::GetMaxMagazineAttribute()));
-	const int32 Res = FMath::RoundToInt(ASC->GetNumericAttribute(UMechaAttributeSet::GetAmmoReserveAttribute()));
+	FMechaUIInvalidation::WrapRoot(*this);
 
-	ApplyAmmoToUI(Mag, MaxMag, Res);
+	return Super::RebuildWidget();
 }
 
 // ========================================
-// UI에 탄약 표시
+// 스냅샷 반영 (프레임당 한 번, 바뀐 항목만)
 // ========================================
-void UWBP_MechaHUD::ApplyAmmoToUI(int32 Mag, int32 MaxMag, int32 Reserve) const
+void UWBP_MechaHUD::OnAttributesFlushed(const FMechaAttributeSnapshot& Snapshot)
 {
-	// ========== 탄창 텍스트 ==========
-	if (TxtAmmoMag)
+	// ========== 체력 ==========
+	if (Snapshot.IsDirty(EMechaObservedAttribute::Health) || Snapshot.IsDirty(EMechaObservedAttribute::MaxHealth))
 	{
-		TxtAmmoMag->SetText(FText::FromString(FString::Printf(TEXT("%d / %d"), Mag, MaxMag)));
+		SetHealthPercent(Snapshot.GetHealthPercent());
 	}
 
-	// ========== 예비탄 텍스트 ==========
-	if (TxtAmmoReserve)
+	// 한 프레임에 여러 번 맞아도 피격 연출은 합산해서 한 번
+	if (Snapshot.DamageTaken > 0.f)
 	{
-		TxtAmmoReserve->SetText(FText::AsNumber(Reserve));
+		PlayDamageOverlay(Snapshot.DamageTaken);
 	}
 
-	// ========== 블루프린트 이벤트 호출 (추가 연출용) ==========
-	const_cast<UWBP_MechaHUD*>(this)->BP_UpdateAmmoUI(Mag, MaxMag, Reserve);
+	// ========== 탄약 ==========
+	if (Snapshot.IsDirty(EMechaObservedAttribute::AmmoMagazine)
+		|| Snapshot.IsDirty(EMechaObservedAttribute::MaxMagazine)
+		|| Snapshot.IsDirty(EMechaObservedAttribute::AmmoReserve))
+	{
+		ApplyAmmoToUI(Snapshot.AmmoMagazine, Snapshot.MaxMagazine, Snapshot.AmmoReserve);
+	}
 }
 
 // ========================================
-// Attribute 변경 콜백들
+// UI에 탄약 표시
 // ========================================
-void UWBP_MechaHUD::OnMagChanged(const FOnAttributeChangeData& Data)
+void UWBP_MechaHUD::ApplyAmmoToUI(int32 Mag, int32 MaxMag, int32 Reserve) const
 {
-	if (!ASC) return;
-	const int32 Mag = FMath::RoundToInt(Data.NewValue);
-	const int32 MaxMag = FMath::RoundToInt(ASC->GetNumericAttribute(UMechaAttributeSet::GetMaxMagazineAttribute()));
-	const int32 Res = FMath::RoundToInt(ASC->GetNumericAttribute(UMechaAttributeSet::GetAmmoReserveAttribute()));
-	ApplyAmmoToUI(Mag, MaxMag, Res);
-}
+	SCOPE_CYCLE_COUNTER(STAT_Mecha_HUDUpdate);
 
-void UWBP_MechaHUD::OnMaxMagChanged(const FOnAttributeChangeData& Data)
-{
-	if (!ASC) return;
-	const int32 Mag = FMath::RoundToInt(ASC->GetNumericAttribute(UMechaAttributeSet::GetAmmoMagazineAttribute()));
-	const int32 MaxMag = FMath::RoundToInt(Data.NewValue);
-	const int32 Res = FMath::RoundToInt(ASC->GetNumericAttribute(UMechaAttributeSet::GetAmmoReserveAttribute()));
-	ApplyAmmoToUI(Mag, MaxMag, Res);
-}
+	// ========== 탄창 텍스트 ==========
+	AmmoMagText.SetRatio(TxtAmmoMag, Mag, MaxMag);
 
-void UWBP_MechaHUD::OnReserveChanged(const FOnAttributeChangeData& Data)
-{
-	if (!ASC) return;
-	const int32 Mag = FMath::RoundToInt(ASC->GetNumericAttribute(UMechaAttributeSet::GetAmmoMagazineAttribute()));
-	const int32 MaxMag = FMath::RoundToInt(ASC->GetNumericAttribute(UMechaAttributeSet::GetMaxMagazineAttribute()));
-	const int32 Res = FMath::RoundToInt(Data.NewValue);
-	ApplyAmmoToUI(Mag, MaxMag, Res);
+	// ========== 예비탄 텍스트 ==========
+	AmmoReserveText.SetNumber(TxtAmmoReserve, Reserve);
+
+	// ========== 블루프린트 이벤트 호출 (추가 연출용) ==========
+	const_cast<UWBP_MechaHUD*>(this)->BP_UpdateAmmoUI(Mag, MaxMag, Reserve);
 }
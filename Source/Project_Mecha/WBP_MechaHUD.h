@@ -3,11 +3,15 @@
 // - 플레이어 HUD 위젯 클래스.
 // - 에너지 바, 체력 바, 탄약 정보(탄창/예비탄)를 표시한다.
 // - ASC와 AttributeSet을 통해 Attribute 변화를 자동 감지하여 UI를 갱신한다.
+// - 체력/탄약은 ASC 소유 액터의 UMechaAttributeObserverComponent 스냅샷을 프레임당 한 번 받아 갱신한다.
+// - 루트는 InvalidationBox로 감싸 캐시하고(FMechaUIInvalidation), 저체력 경고 깜빡임은 재생 중에만 volatile.
 
 #pragma once
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "MechaNumericText.h"
+#include "MechaAttributeObserverComponent.h"
 #include "WBP_MechaHUD.generated.h"
 
 class UProgressBar;
@@ -15,6 +19,7 @@ class UTextBlock;
 class UAbilitySystemComponent;
 class UMechaAttributeSet;
 class UWidgetAnimation;
+class UMechaAttributeObserverComponent;
 
 
 // 설명:
@@ -70,8 +75,11 @@ public:
         BP_ShowMissionClear(MissionTime);
     }
 
+    virtual void NativeDestruct() override;
 
 protected:
+    virtual TSharedRef<SWidget> RebuildWidget() override;
+
     // ===================== 에너지 / 체력 UI =====================
     /** UMG에서 이름 "PB_Energy"로 바인딩 */
     UPROPERTY(meta = (BindWidget))
@@ -145,21 +153,22 @@ protected:
     void BP_UpdateAmmoUI(int32 Mag, int32 MaxMag, int32 Reserve);
 
 private:
-    // 델리게이트 핸들
-    FDelegateHandle HandleMag;
-    FDelegateHandle HandleMaxMag;
-    FDelegateHandle HandleReserve;
+    // Attribute 관찰 컴포넌트 구독 (프레임당 스냅샷 1회)
+    TWeakObjectPtr<UMechaAttributeObserverComponent> AttributeObserver;
+    FDelegateHandle AttributesFlushedHandle;
 
-    // 탄약 리스너 바인딩/해제
-    void BindAmmoListeners();
-    void UnbindAmmoListeners();
+    void BindAttributeObserver();
+    void UnbindAttributeObserver();
 
-    // 초기 1회 쿼리 & UI 반영
-    void RefreshAmmoOnce() const;
+    // 스냅샷에서 바뀐 항목만 UI 반영
+    void OnAttributesFlushed(const FMechaAttributeSnapshot& Snapshot);
     void ApplyAmmoToUI(int32 Mag, int32 MaxMag, int32 Reserve) const;
 
-    // 콜백
-    void OnMagChanged(const struct FOnAttributeChangeData& Data);
-    void OnMaxMagChanged(const struct FOnAttributeChangeData& Data);
-    void OnReserveChanged(const struct FOnAttributeChangeData& Data);
+    // 저체력 경고 표시 중 (깜빡임 애니메이션을 매 갱신마다 다시 시작하지 않도록)
+    bool bLowHPWarningActive = false;
+    void SetLowHPWarningActive(bool bActive);
+
+    // 값이 바뀔 때만 SetText
+    mutable FMechaNumericText AmmoMagText;
+    mutable FMechaNumericText AmmoReserveText;
 };